@@ -49,6 +49,26 @@ IF( BUILD_TESTING )
       endforeach()
     endforeach()
 
+    # same with the space-filling curve partitioner instead of metis
+    foreach( NP 2 6 8 )
+      add_test( NAME cube-unit-coarse-int_sphere-sfc-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-int_sphere.sol
+        -out ${CI_DIR_RESULTS}/int_sphere-sfc-${NP}-out.mesh
+        -sfc -mesh-size ${mesh_size} ${myargs} )
+    endforeach()
+
+    # same with the output group partition computed in background by 2 processes
+    foreach( NP 4 8 )
+      add_test( NAME cube-unit-coarse-int_sphere-partitioners-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-int_sphere.sol
+        -out ${CI_DIR_RESULTS}/int_sphere-partitioners-${NP}-out.mesh
+        -partitioners 2 -mesh-size ${mesh_size} ${myargs} )
+    endforeach()
+
     # remesh a non constant anisotropic test case: a torus with a planar shock
     # on 1,2,4,6,8 processors
     foreach( TYPE anisotropic-test )
@@ -207,6 +227,68 @@ IF( BUILD_TESTING )
       ${myargs}
       )
 
+    ###############################################################################
+    #####
+    #####        Checkpoint at each iteration and restart on 4, 2 and 6 procs
+    #####
+    ###############################################################################
+    add_test( NAME checkpoint-cube-unit-coarse-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Cube/cube-unit-coarse.mesh
+      -sol ${CI_DIR}/Cube/cube-unit-coarse-int_sphere.sol
+      -out ${CI_DIR_RESULTS}/checkpoint-cube-unit-coarse-4-out.mesh
+      -checkpoint ${CI_DIR_RESULTS}/cube-unit-coarse.pmmgchk
+      -niter 3 -mesh-size ${mesh_size} -v 5
+      )
+
+    foreach( NP 4 2 6 )
+      add_test( NAME restart-cube-unit-coarse-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -restart ${CI_DIR_RESULTS}/cube-unit-coarse.pmmgchk
+        -out ${CI_DIR_RESULTS}/restart-cube-unit-coarse-${NP}-out.mesh
+        -centralized-output -v 5
+        )
+      set_tests_properties(restart-cube-unit-coarse-${NP}
+        PROPERTIES DEPENDS checkpoint-cube-unit-coarse-4 )
+    endforeach()
+
+    ###############################################################################
+    #####
+    #####        Save the initial partition and reuse it in a second run
+    #####
+    ###############################################################################
+    foreach( RUN save reuse )
+      add_test( NAME partition-${RUN}-cube-unit-coarse-4
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-int_sphere.sol
+        -out ${CI_DIR_RESULTS}/partition-${RUN}-cube-unit-coarse-4-out.mesh
+        -part ${CI_DIR_RESULTS}/cube-unit-coarse-4.pmmgpart
+        -mesh-size ${mesh_size} ${myargs}
+        )
+    endforeach()
+    # the reuse run must read the partition saved by the first one (printed
+    # with -v 5)
+    set_tests_properties(partition-reuse-cube-unit-coarse-4
+      PROPERTIES DEPENDS partition-save-cube-unit-coarse-4
+      PASS_REGULAR_EXPRESSION "initial partition read from" )
+
+    ###############################################################################
+    #####
+    #####        Parallel reading of the centralized input mesh and metric
+    #####
+    ###############################################################################
+    foreach( NP 2 6 )
+      add_test( NAME parallel-input-cube-unit-coarse-${NP}
+        COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} ${NP} $<TARGET_FILE:${PROJECT_NAME}>
+        ${CI_DIR}/Cube/cube-unit-coarse.mesh
+        -sol ${CI_DIR}/Cube/cube-unit-coarse-int_sphere.sol
+        -out ${CI_DIR_RESULTS}/parallel-input-cube-unit-coarse-${NP}-out.mesh
+        -parallel-input -mesh-size ${mesh_size} ${myargs}
+        )
+    endforeach()
+
     ###############################################################################
     #####
     #####        Tests fields interpolation with or without metric
@@ -240,6 +322,31 @@ IF( BUILD_TESTING )
       -out ${CI_DIR_RESULTS}/InterpolationFields-refinement-4-out.mesh
       -field ${CI_DIR}/Interpolation/cube-unit-coarse-field.sol ${myargs} )
 
+    # same with the metric and fields migrated in single precision
+    add_test( NAME InterpolationFields-withMet-float-sol-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.mesh
+      -out ${CI_DIR_RESULTS}/InterpolationFields-withMet-float-sol-4-out.mesh
+      -field ${CI_DIR}/Interpolation/sol-fields-coarse.sol
+      -sol field3_iso-coarse.sol
+      -float-sol -mesh-size 60000 ${myargs} )
+
+    # fields saved and reloaded at distributed format
+    add_test( NAME InterpolationFields-distrib-4
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR}/Interpolation/coarse.mesh
+      -out ${CI_DIR_RESULTS}/InterpolationFields-distrib-4-out.mesh
+      -field ${CI_DIR}/Interpolation/sol-fields-coarse.sol
+      -distributed-output -mesh-size 60000 ${myargs} )
+    add_test( NAME InterpolationFields-distrib-4-rerun
+      COMMAND ${MPIEXEC} ${MPI_ARGS} ${MPIEXEC_NUMPROC_FLAG} 4 $<TARGET_FILE:${PROJECT_NAME}>
+      ${CI_DIR_RESULTS}/InterpolationFields-distrib-4-out.mesh
+      -out ${CI_DIR_RESULTS}/InterpolationFields-distrib-4-rerun-out.mesh
+      -field ${CI_DIR_RESULTS}/sol-fields-coarse.o.sol
+      -centralized-output ${myargs} )
+    set_tests_properties(InterpolationFields-distrib-4-rerun
+      PROPERTIES DEPENDS InterpolationFields-distrib-4 )
+
     ###############################################################################
     #####
     #####        Tests distributed surface adaptation
@@ -397,6 +397,16 @@ int PMMG_Set_outputMetName(PMMG_pParMesh parmesh, const char* metout) {
   return ier;
 }
 
+int PMMG_Set_outputCheckpointName(PMMG_pParMesh parmesh, const char* chkptout) {
+
+  return PMMG_Set_name(parmesh,&parmesh->chkptout,chkptout,NULL);
+}
+
+int PMMG_Set_partitionName(PMMG_pParMesh parmesh, const char* partname) {
+
+  return PMMG_Set_name(parmesh,&parmesh->partname,partname,NULL);
+}
+
 void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   MMG5_pMesh mesh;
   size_t     mem;
@@ -410,6 +420,7 @@ void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   parmesh->ddebug                  = PMMG_NUL;
   parmesh->iter                    = PMMG_UNSET;
   parmesh->niter                   = PMMG_NITER;
+  parmesh->nretry                  = 0;
   parmesh->info.fem                = MMG5_FEM;
   parmesh->info.repartitioning     = PMMG_REDISTRIBUTION_mode;
   parmesh->info.ifc_layers         = PMMG_MVIFCS_NLAYERS;
@@ -423,6 +434,7 @@ void PMMG_Init_parameters(PMMG_pParMesh parmesh,MPI_Comm comm) {
   parmesh->info.globalNum          = PMMG_NUL;
   parmesh->info.sethmin            = PMMG_NUL;
   parmesh->info.sethmax            = PMMG_NUL;
+  parmesh->info.setniter           = PMMG_NUL;
   parmesh->info.fmtout             = PMMG_FMT_Unknown;
 
   /* Init MPI data */
@@ -471,6 +483,10 @@ int PMMG_Set_meshSize(PMMG_pParMesh parmesh, int np, int ne, int nprism, int nt,
   ier = 1;
   mesh = parmesh->listgrp[0].mesh;
 
+  /* A new mesh is provided: the analysis of a previous persistent call is
+   * outdated */
+  parmesh->analysed = 0;
+
   /* Check input data and set mesh->ne/na/np/nt to the suitable values */
   if ( !MMG3D_setMeshSize_initData(mesh,np,ne,nprism,nt,nquad,na) )
     return 0;
@@ -597,6 +613,44 @@ int PMMG_Set_iparameter(PMMG_pParMesh parmesh, int iparam,int val) {
     break;
   case PMMG_IPARAM_niter :
     parmesh->niter = val;
+    parmesh->info.setniter = 1;
+    break;
+  case PMMG_IPARAM_persistent :
+    parmesh->info.persistent = val ? 1 : 0;
+    if ( !val ) {
+      parmesh->analysed = 0;
+    }
+    break;
+  case PMMG_IPARAM_parallelInput :
+    parmesh->info.parallelInput = val ? 1 : 0;
+    break;
+  case PMMG_IPARAM_loadbalancingMode :
+    if ( val != PMMG_LOADBALANCING_metis && val != PMMG_LOADBALANCING_sfc
+#ifdef USE_PARMETIS
+         && val != PMMG_LOADBALANCING_parmetis
+#endif
+      ) {
+      fprintf(stderr,"  ## Error: %s: unexpected load balancing mode %d.\n",
+              __func__,val);
+      return 0;
+    }
+    parmesh->info.loadbalancing_mode = val;
+    break;
+  case PMMG_IPARAM_partitioners :
+    if ( val < 0 ) {
+      fprintf(stderr,"  ## Error: %s: unexpected number of partitioners %d.\n",
+              __func__,val);
+      return 0;
+    }
+    parmesh->info.npartitioners = val;
+    break;
+  case PMMG_IPARAM_solPrecision :
+    if ( val != PMMG_SOLPREC_double && val != PMMG_SOLPREC_float ) {
+      fprintf(stderr,"  ## Error: %s: unexpected solution precision %d.\n",
+              __func__,val);
+      return 0;
+    }
+    parmesh->info.solPrecision = val;
     break;
 
 #ifndef PATTERN
@@ -1148,6 +1202,218 @@ int PMMG_Get_tensorMets(PMMG_pParMesh parmesh, double *mets){
   return(MMG3D_Get_tensorSols(parmesh->listgrp[0].met, mets));
 }
 
+int PMMG_Get_verticesPtr(PMMG_pParMesh parmesh, double **coor, int *cstride,
+                         int **refs, int *rstride){
+  MMG5_pMesh mesh;
+
+  assert ( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( !mesh->point || !mesh->np ) {
+    fprintf(stderr,"\n  ## Error: %s: vertices array is not allocated.\n"
+            "     Please call the PMMG_Set_meshSize function first.\n",__func__);
+    return 0;
+  }
+
+  /* Coordinates and references are read through the stride of the point
+   * structure so the user can fill or read them in place */
+  if ( sizeof(MMG5_Point) % sizeof(double) ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected point structure size.\n",
+            __func__);
+    return 0;
+  }
+
+  *coor    = mesh->point[1].c;
+  *cstride = sizeof(MMG5_Point)/sizeof(double);
+
+  if ( refs ) {
+    *refs    = &mesh->point[1].ref;
+    *rstride = sizeof(MMG5_Point)/sizeof(int);
+  }
+
+  return 1;
+}
+
+int PMMG_Get_tetrahedraPtr(PMMG_pParMesh parmesh, int **tetra, int **refs,
+                           int *stride){
+  MMG5_pMesh mesh;
+
+  assert ( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( !mesh->tetra || !mesh->ne ) {
+    fprintf(stderr,"\n  ## Error: %s: tetrahedra array is not allocated.\n"
+            "     Please call the PMMG_Set_meshSize function first.\n",__func__);
+    return 0;
+  }
+
+  if ( sizeof(MMG5_Tetra) % sizeof(int) ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected tetra structure size.\n",
+            __func__);
+    return 0;
+  }
+
+  *tetra  = mesh->tetra[1].v;
+  *stride = sizeof(MMG5_Tetra)/sizeof(int);
+
+  if ( refs ) {
+    *refs = &mesh->tetra[1].ref;
+  }
+
+  return 1;
+}
+
+int PMMG_Get_trianglesPtr(PMMG_pParMesh parmesh, int **tria, int **refs,
+                          int *stride){
+  MMG5_pMesh mesh;
+
+  assert ( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( !mesh->tria || !mesh->nt ) {
+    fprintf(stderr,"\n  ## Error: %s: triangles array is not allocated.\n"
+            "     Please call the PMMG_Set_meshSize function first.\n",__func__);
+    return 0;
+  }
+
+  if ( sizeof(MMG5_Tria) % sizeof(int) ) {
+    fprintf(stderr,"\n  ## Error: %s: unexpected tria structure size.\n",
+            __func__);
+    return 0;
+  }
+
+  *tria   = mesh->tria[1].v;
+  *stride = sizeof(MMG5_Tria)/sizeof(int);
+
+  if ( refs ) {
+    *refs = &mesh->tria[1].ref;
+  }
+
+  return 1;
+}
+
+int PMMG_Get_metPtr(PMMG_pParMesh parmesh, double **mets, int *size){
+  MMG5_pSol met;
+
+  assert ( parmesh->ngrp == 1 );
+  met = parmesh->listgrp[0].met;
+
+  if ( !met->m || !met->np ) {
+    fprintf(stderr,"\n  ## Error: %s: metric array is not allocated.\n"
+            "     Please call the PMMG_Set_metSize function first.\n",__func__);
+    return 0;
+  }
+
+  /* Mmg stores the solution at vertex k at m[size*k]: skip the unused first
+   * slot to provide a 0-indexed array */
+  *mets = met->m + met->size;
+  *size = met->size;
+
+  return 1;
+}
+
+int PMMG_Get_ithSolsPtr(PMMG_pParMesh parmesh, int i, double **s, int *size){
+  MMG5_pMesh mesh;
+  MMG5_pSol  psl;
+
+  assert ( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  if ( i < 1 || i > mesh->nsols ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to get the field %d: the mesh"
+            " has %d fields.\n",__func__,i,mesh->nsols);
+    return 0;
+  }
+
+  psl = parmesh->listgrp[0].field + (i-1);
+
+  if ( !psl->m || !psl->np ) {
+    fprintf(stderr,"\n  ## Error: %s: field array is not allocated.\n"
+            "     Please call the PMMG_Set_solsAtVerticesSize function first.\n",
+            __func__);
+    return 0;
+  }
+
+  /* Same layout than the metric array */
+  *s    = psl->m + psl->size;
+  *size = psl->size;
+
+  return 1;
+}
+
+int PMMG_Set_meshFromPtr(PMMG_pParMesh parmesh){
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  double      vol;
+  int         k,i,tmp,nreorient,nnull;
+
+  assert ( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  /* Vertices are unused until a tetra or a triangle refers to them */
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    ppt->tag  = MG_NUL;
+    ppt->flag = 0;
+    ppt->tmp  = 0;
+  }
+
+  nreorient = nnull = 0;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+
+    for ( i=0; i<4; ++i ) {
+      if ( pt->v[i] < 1 || pt->v[i] > mesh->np ) {
+        fprintf(stderr,"\n  ## Error: %s: tetra %d: vertex %d out of range"
+                " (%d vertices).\n",__func__,k,pt->v[i],mesh->np);
+        return 0;
+      }
+      mesh->point[pt->v[i]].tag &= ~MG_NUL;
+    }
+    pt->ref = abs(pt->ref);
+
+    vol = MMG5_orvol(mesh->point,pt->v);
+    if ( fabs(vol) <= MMG5_EPSD2 ) {
+      ++nnull;
+    }
+    else if ( vol < 0 ) {
+      /* Possibly switch 2 vertices number so that each tet is positively
+       * oriented */
+      tmp      = pt->v[2];
+      pt->v[2] = pt->v[3];
+      pt->v[3] = tmp;
+      ++nreorient;
+    }
+  }
+
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+
+    for ( i=0; i<3; ++i ) {
+      if ( ptt->v[i] < 1 || ptt->v[i] > mesh->np ) {
+        fprintf(stderr,"\n  ## Error: %s: triangle %d: vertex %d out of range"
+                " (%d vertices).\n",__func__,k,ptt->v[i],mesh->np);
+        return 0;
+      }
+      mesh->point[ptt->v[i]].tag &= ~MG_NUL;
+    }
+    ptt->ref = abs(ptt->ref);
+  }
+
+  if ( nnull && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stderr,"\n  ## Warning: %s: %d tetrahedra with null volume.\n",
+            __func__,nnull);
+  }
+  if ( nreorient && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stderr,"\n  ## Warning: %s: %d tetrahedra reoriented.\n",
+            __func__,nreorient);
+  }
+
+  return 1;
+}
+
 int PMMG_Set_numberOfNodeCommunicators(PMMG_pParMesh parmesh, int next_comm) {
 
   PMMG_CALLOC(parmesh,parmesh->ext_node_comm,next_comm,PMMG_Ext_comm,
@@ -2450,6 +2716,9 @@ int PMMG_Free_names(PMMG_pParMesh parmesh)
   PMMG_DEL_MEM ( parmesh, parmesh->dispin,char,"dispin" );
   PMMG_DEL_MEM ( parmesh, parmesh->fieldin,char,"fieldin" );
   PMMG_DEL_MEM ( parmesh, parmesh->fieldout,char,"fieldout" );
+  PMMG_DEL_MEM ( parmesh, parmesh->chkptin,char,"chkptin" );
+  PMMG_DEL_MEM ( parmesh, parmesh->chkptout,char,"chkptout" );
+  PMMG_DEL_MEM ( parmesh, parmesh->partname,char,"partname" );
   return 1;
 }
 
@@ -156,6 +156,40 @@ FORTRAN_NAME(PMMG_SET_OUTPUTMESHNAME,pmmg_set_outputmeshname,
   return;
 }
 
+/**
+ * See \ref PMMG_Set_outputCheckpointName function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SET_OUTPUTCHECKPOINTNAME,pmmg_set_outputcheckpointname,
+             (PMMG_pParMesh *parmesh, char* chkptout, int* strlen,int* retval),
+             (parmesh,chkptout,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,chkptout,*strlen);
+  tmp[*strlen] = '\0';
+  *retval = PMMG_Set_outputCheckpointName(*parmesh, tmp);
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_Set_partitionName function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SET_PARTITIONNAME,pmmg_set_partitionname,
+             (PMMG_pParMesh *parmesh, char* partname, int* strlen,int* retval),
+             (parmesh,partname,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,partname,*strlen);
+  tmp[*strlen] = '\0';
+  *retval = PMMG_Set_partitionName(*parmesh, tmp);
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_Set_outputSolsName function in \ref libparmmg.h file.
  */
@@ -813,6 +847,69 @@ FORTRAN_NAME(PMMG_GET_TENSORMETS,pmmg_get_tensormets,
   return;
 }
 
+/**
+ * See \ref PMMG_Get_verticesPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_VERTICESPTR,pmmg_get_verticesptr,
+             (PMMG_pParMesh *parmesh, double** coor, int* cstride,
+              int** refs, int* rstride, int* retval),
+             (parmesh,coor,cstride,refs,rstride,retval)) {
+  *retval = PMMG_Get_verticesPtr(*parmesh,coor,cstride,refs,rstride);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_tetrahedraPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_TETRAHEDRAPTR,pmmg_get_tetrahedraptr,
+             (PMMG_pParMesh *parmesh, int** tetra, int** refs, int* stride,
+              int* retval),
+             (parmesh,tetra,refs,stride,retval)) {
+  *retval = PMMG_Get_tetrahedraPtr(*parmesh,tetra,refs,stride);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_trianglesPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_TRIANGLESPTR,pmmg_get_trianglesptr,
+             (PMMG_pParMesh *parmesh, int** tria, int** refs, int* stride,
+              int* retval),
+             (parmesh,tria,refs,stride,retval)) {
+  *retval = PMMG_Get_trianglesPtr(*parmesh,tria,refs,stride);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_metPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_METPTR,pmmg_get_metptr,
+             (PMMG_pParMesh *parmesh, double** mets, int* size, int* retval),
+             (parmesh,mets,size,retval)) {
+  *retval = PMMG_Get_metPtr(*parmesh,mets,size);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_ithSolsPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_ITHSOLSPTR,pmmg_get_ithsolsptr,
+             (PMMG_pParMesh *parmesh, int* i, double** s, int* size, int* retval),
+             (parmesh,i,s,size,retval)) {
+  *retval = PMMG_Get_ithSolsPtr(*parmesh,*i,s,size);
+  return;
+}
+
+/**
+ * See \ref PMMG_Set_meshFromPtr function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SET_MESHFROMPTR,pmmg_set_meshfromptr,
+             (PMMG_pParMesh *parmesh, int* retval),
+             (parmesh,retval)) {
+  *retval = PMMG_Set_meshFromPtr(*parmesh);
+  return;
+}
+
 /**
  * See \ref PMMG_Set_numberOfNodeCommunicators function in \ref libparmmg.h file.
  */
@@ -879,6 +976,26 @@ FORTRAN_NAME(PMMG_SET_ITHFACECOMMUNICATOR_FACES, pmmg_set_ithfacecommunicator_fa
   return;
 }
 
+/**
+ * See \ref PMMG_Get_numberOfNodeCommunicators function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_NUMBEROFNODECOMMUNICATORS, pmmg_get_numberofnodecommunicators,
+    (PMMG_pParMesh *parmesh, int *next_comm, int* retval),
+    (parmesh, next_comm, retval)) {
+  *retval = PMMG_Get_numberOfNodeCommunicators(*parmesh,next_comm);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_numberOfFaceCommunicators function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_NUMBEROFFACECOMMUNICATORS, pmmg_get_numberoffacecommunicators,
+    (PMMG_pParMesh *parmesh, int *next_comm, int* retval),
+    (parmesh, next_comm, retval)) {
+  *retval = PMMG_Get_numberOfFaceCommunicators(*parmesh,next_comm);
+  return;
+}
+
 /**
  * See \ref PMMG_Get_ithNodeCommunicatorSize function in \ref libparmmg.h file.
  */
@@ -990,6 +1107,39 @@ FORTRAN_NAME(PMMG_GET_VERTEXGLONUM, pmmg_get_vertexglonum,
   return;
 }
 
+/**
+ * See \ref PMMG_Get_verticesGloNum function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_VERTICESGLONUM, pmmg_get_verticesglonum,
+    (PMMG_pParMesh *parmesh,int* idx_glob,int* owner,
+     int* retval),
+    (parmesh,idx_glob,owner,retval)) {
+  *retval = PMMG_Get_verticesGloNum(*parmesh,idx_glob,owner);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_triangleGloNum function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_TRIANGLEGLONUM, pmmg_get_triangleglonum,
+    (PMMG_pParMesh *parmesh,int* idx_glob,int* owner,
+     int* retval),
+    (parmesh,idx_glob,owner,retval)) {
+  *retval = PMMG_Get_triangleGloNum(*parmesh,idx_glob,owner);
+  return;
+}
+
+/**
+ * See \ref PMMG_Get_trianglesGloNum function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_GET_TRIANGLESGLONUM, pmmg_get_trianglesglonum,
+    (PMMG_pParMesh *parmesh,int* idx_glob,int* owner,
+     int* retval),
+    (parmesh,idx_glob,owner,retval)) {
+  *retval = PMMG_Get_trianglesGloNum(*parmesh,idx_glob,owner);
+  return;
+}
+
 /**
  * See \ref PMMG_Free_all function in \ref mmg3d/libmmg3d.h file.
  */
@@ -1048,6 +1198,31 @@ FORTRAN_NAME(PMMG_LOADMESH_CENTRALIZED,pmmg_loadmesh_centralized,
   return;
 }
 
+/**
+ * See \ref PMMG_loadMesh_parallel function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADMESH_PARALLEL,pmmg_loadmesh_parallel,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen0,
+              char* metname, int *strlen1,int* retval),
+             (parmesh,filename,strlen0,metname,strlen1,retval)){
+  char *tmp0 = NULL, *tmp1 = NULL;
+
+  MMG5_SAFE_MALLOC(tmp0,(*strlen0+1),char,);
+  strncpy(tmp0,filename,*strlen0);
+  tmp0[*strlen0] = '\0';
+
+  MMG5_SAFE_MALLOC(tmp1,(*strlen1+1),char,MMG5_SAFE_FREE(tmp0));
+  strncpy(tmp1,metname,*strlen1);
+  tmp1[*strlen1] = '\0';
+
+  *retval = PMMG_loadMesh_parallel(*parmesh,tmp0,*strlen1 ? tmp1 : NULL);
+
+  MMG5_SAFE_FREE(tmp0);
+  MMG5_SAFE_FREE(tmp1);
+
+  return;
+}
+
 /**
  * See \ref PMMG_loadMesh function in \ref libparmmg.h file.
  */
@@ -1179,6 +1354,82 @@ FORTRAN_NAME(PMMG_LOADALLSOLS_CENTRALIZED,pmmg_loadallsols_centralized,
   return;
 }
 
+/**
+ * See \ref PMMG_loadLs_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADLS_DISTRIBUTED,pmmg_loadls_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadLs_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_loadDisp_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADDISP_DISTRIBUTED,pmmg_loaddisp_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadDisp_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_loadSol_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADSOL_DISTRIBUTED,pmmg_loadsol_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadSol_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_loadAllSols_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADALLSOLS_DISTRIBUTED,pmmg_loadallsols_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadAllSols_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_saveMesh_centralized function in \ref libparmmg.h file.
  */
@@ -1274,6 +1525,139 @@ FORTRAN_NAME(PMMG_SAVEALLSOLS_CENTRALIZED,pmmg_saveallsols_centralized,
   return;
 }
 
+/**
+ * See \ref PMMG_saveLs_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVELS_DISTRIBUTED,pmmg_savels_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveLs_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveDisp_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEDISP_DISTRIBUTED,pmmg_savedisp_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveDisp_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveAllSols_distributed function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEALLSOLS_DISTRIBUTED,pmmg_saveallsols_distributed,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveAllSols_distributed(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveMesh_hdf5 function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVEMESH_HDF5,pmmg_savemesh_hdf5,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveMesh_hdf5(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_loadMesh_hdf5 function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADMESH_HDF5,pmmg_loadmesh_hdf5,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadMesh_hdf5(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_saveCheckpoint function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_SAVECHECKPOINT,pmmg_savecheckpoint,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_saveCheckpoint(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
+/**
+ * See \ref PMMG_loadCheckpoint function in \ref libparmmg.h file.
+ */
+FORTRAN_NAME(PMMG_LOADCHECKPOINT,pmmg_loadcheckpoint,
+             (PMMG_pParMesh *parmesh,char* filename, int *strlen,int* retval),
+             (parmesh,filename,strlen,retval)){
+  char *tmp = NULL;
+
+  MMG5_SAFE_MALLOC(tmp,(*strlen+1),char,);
+  strncpy(tmp,filename,*strlen);
+  tmp[*strlen] = '\0';
+
+  *retval = PMMG_loadCheckpoint(*parmesh,tmp);
+
+  MMG5_SAFE_FREE(tmp);
+
+  return;
+}
+
 /**
  * See \ref PMMG_Free_names function in \ref libparmmg.h file.
  */
@@ -902,9 +902,10 @@ int PMMG_hn_sumnor( PMMG_pParMesh parmesh,PMMG_hn_loopvar *var ) {
  * been consistently colored.
  */
 int PMMG_hashNorver_normals( PMMG_pParMesh parmesh, PMMG_hn_loopvar *var ){
+  PMMG_pGrp    grp = &parmesh->listgrp[0];
   MMG5_pxPoint pxp;
   double *doublevalues,dd,l[2],*c[2];
-  int    *intvalues,idx,d,j;
+  int    *intvalues,idx,d,i,j;
 
   intvalues    = parmesh->int_node_comm->intvalues;
   doublevalues = parmesh->int_node_comm->doublevalues;
@@ -915,8 +916,10 @@ int PMMG_hashNorver_normals( PMMG_pParMesh parmesh, PMMG_hn_loopvar *var ){
   if( !PMMG_hashNorver_loop( parmesh, var, MG_CRN, &PMMG_hn_sumnor ) )
     return 0;
 
-  /* Load communicator */
-  for( var->ip = 1; var->ip <= var->mesh->np; var->ip++ ) {
+  /* Load communicator (only the points of the internal communicator are
+   * initialized by PMMG_hashNorver) */
+  for( i = 0; i < grp->nitem_int_node_comm; i++ ) {
+    var->ip  = grp->node2int_node_comm_index1[i];
     var->ppt = &var->mesh->point[var->ip];
 
     /* Loop on parallel, non-singular points (they have been flagged in
@@ -988,94 +991,90 @@ int PMMG_hashNorver_normals( PMMG_pParMesh parmesh, PMMG_hn_loopvar *var ){
     return 0;
 
   /* Unload communicator */
-  for( var->ip = 1; var->ip <= var->mesh->np; var->ip++ ) {
+  for( i = 0; i < grp->nitem_int_node_comm; i++ ) {
+    var->ip  = grp->node2int_node_comm_index1[i];
     var->ppt = &var->mesh->point[var->ip];
     idx = PMMG_point2int_comm_index_get( var->ppt );
 
-    /* Loop on parallel, non-corner points (check for valid index before
-     * accessing the internal communicator, not allocated on 1 proc) */
-    if( idx != PMMG_UNSET ) {
-      if( intvalues[idx] ) {
+    /* Loop on parallel, non-corner points */
+    if( intvalues[idx] ) {
 
-        /* Create xpoint if needed */
-        if( !var->ppt->xp ) {
-          ++var->mesh->xp;
-          if(var->mesh->xp > var->mesh->xpmax){
-            MMG5_TAB_RECALLOC(var->mesh,var->mesh->xpoint,var->mesh->xpmax,
-                              MMG5_GAP,MMG5_xPoint,
-                              "larger xpoint table",
-                              var->mesh->xp--;return 0;);
-          }
-          var->ppt->xp = var->mesh->xp;
+      /* Create xpoint if needed */
+      if( !var->ppt->xp ) {
+        ++var->mesh->xp;
+        if(var->mesh->xp > var->mesh->xpmax){
+          MMG5_TAB_RECALLOC(var->mesh,var->mesh->xpoint,var->mesh->xpmax,
+                            MMG5_GAP,MMG5_xPoint,
+                            "larger xpoint table",
+                            var->mesh->xp--;return 0;);
         }
-        pxp = &var->mesh->xpoint[var->ppt->xp];
-        if( intvalues[idx] & (1 << 1) ) /* has normal */
-          pxp->nnor = 0;
+        var->ppt->xp = var->mesh->xp;
+      }
+      pxp = &var->mesh->xpoint[var->ppt->xp];
+      if( intvalues[idx] & (1 << 1) ) /* has normal */
+        pxp->nnor = 0;
 
-        /* Get normals from communicator if manifold or non-manifold exterior
-         * point */
-        if( !pxp->nnor ) {
-          for( d = 0; d < 3; d++ )
-            pxp->n1[d] = doublevalues[6*idx+d];
-          for( d = 0; d < 3; d++ )
-            pxp->n2[d] = doublevalues[6*idx+3+d];
-        }
+      /* Get normals from communicator if manifold or non-manifold exterior
+       * point */
+      if( !pxp->nnor ) {
+        for( d = 0; d < 3; d++ )
+          pxp->n1[d] = doublevalues[6*idx+d];
+        for( d = 0; d < 3; d++ )
+          pxp->n2[d] = doublevalues[6*idx+3+d];
       }
     }
   }
 
   /* Normalize vectors */
-  for( var->ip = 1; var->ip <= var->mesh->np; var->ip++ ) {
+  for( i = 0; i < grp->nitem_int_node_comm; i++ ) {
+    var->ip  = grp->node2int_node_comm_index1[i];
     var->ppt = &var->mesh->point[var->ip];
     idx = PMMG_point2int_comm_index_get( var->ppt );
 
-    /* Loop on parallel, non-corner points (check for valid index before
-     * accessing the internal communicator, not allocated on 1 proc) */
-    if( idx != PMMG_UNSET ) {
-      if( intvalues[idx] ) {
-        pxp = &var->mesh->xpoint[var->ppt->xp];
+    /* Loop on parallel, non-corner points */
+    if( intvalues[idx] ) {
+      pxp = &var->mesh->xpoint[var->ppt->xp];
+
+      if( var->ppt->tag & MG_OPNBDY ) continue;
 
-        if( var->ppt->tag & MG_OPNBDY ) continue;
+      /* Loop on manifold or non-manifold exterior points */
+      if( !pxp->nnor ) {
+        /* Normalize first normal */
+        dd = 0.0;
+        for( d = 0; d < 3; d++ )
+          dd += pxp->n1[d]*pxp->n1[d];
+        dd = 1.0 / sqrt(dd);
+        /* if this fail, check surface color in PMMG_hn_sumnor */
+        assert(isfinite(dd));
+        if( dd > MMG5_EPSD2 )
+          for( d = 0; d < 3; d++ )
+            pxp->n1[d] *= dd;
 
-        /* Loop on manifold or non-manifold exterior points */
-        if( !pxp->nnor ) {
-          /* Normalize first normal */
+        if( (var->ppt->tag & MG_GEO) ) {
+          /* Normalize second normal */
           dd = 0.0;
           for( d = 0; d < 3; d++ )
-            dd += pxp->n1[d]*pxp->n1[d];
+            dd += pxp->n2[d]*pxp->n2[d];
           dd = 1.0 / sqrt(dd);
           /* if this fail, check surface color in PMMG_hn_sumnor */
           assert(isfinite(dd));
           if( dd > MMG5_EPSD2 )
             for( d = 0; d < 3; d++ )
-              pxp->n1[d] *= dd;
+              pxp->n2[d] *= dd;
 
-          if( (var->ppt->tag & MG_GEO) ) {
-            /* Normalize second normal */
+          if( !(var->ppt->tag & MG_NOM) ) {
+            /* compute tangent as intersection of n1 + n2 */
+            var->ppt->n[0] = pxp->n1[1]*pxp->n2[2] - pxp->n1[2]*pxp->n2[1];
+            var->ppt->n[1] = pxp->n1[2]*pxp->n2[0] - pxp->n1[0]*pxp->n2[2];
+            var->ppt->n[2] = pxp->n1[0]*pxp->n2[1] - pxp->n1[1]*pxp->n2[0];
             dd = 0.0;
             for( d = 0; d < 3; d++ )
-              dd += pxp->n2[d]*pxp->n2[d];
+              dd += var->ppt->n[d]*var->ppt->n[d];
             dd = 1.0 / sqrt(dd);
-            /* if this fail, check surface color in PMMG_hn_sumnor */
             assert(isfinite(dd));
             if( dd > MMG5_EPSD2 )
               for( d = 0; d < 3; d++ )
-                pxp->n2[d] *= dd;
-
-            if( !(var->ppt->tag & MG_NOM) ) {
-              /* compute tangent as intersection of n1 + n2 */
-              var->ppt->n[0] = pxp->n1[1]*pxp->n2[2] - pxp->n1[2]*pxp->n2[1];
-              var->ppt->n[1] = pxp->n1[2]*pxp->n2[0] - pxp->n1[0]*pxp->n2[2];
-              var->ppt->n[2] = pxp->n1[0]*pxp->n2[1] - pxp->n1[1]*pxp->n2[0];
-              dd = 0.0;
-              for( d = 0; d < 3; d++ )
-                dd += var->ppt->n[d]*var->ppt->n[d];
-              dd = 1.0 / sqrt(dd);
-              assert(isfinite(dd));
-              if( dd > MMG5_EPSD2 )
-                for( d = 0; d < 3; d++ )
-                  var->ppt->n[d] *= dd;
-            }
+                var->ppt->n[d] *= dd;
           }
         }
       }
@@ -1106,6 +1105,10 @@ int PMMG_hashNorver_xp_init( PMMG_pParMesh parmesh,PMMG_hn_loopvar *var ) {
     if( !var->pt->xt ) continue;
     var->pxt = &var->mesh->xtetra[var->pt->xt];
 
+    /* Reset the surface colors of the tetra (only read and written on
+     * boundary tetra by PMMG_hashNorver_loop) */
+    var->pt->mark = 0;
+
     /* Loop on faces */
     for( var->ifac = 0; var->ifac < 4; var->ifac++ ) {
       /* Get face tag */
@@ -1278,9 +1281,8 @@ int PMMG_hashNorver( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *hash,
                      MMG5_HGeom *hpar,PMMG_hn_loopvar *var ){
   PMMG_pGrp      grp = &parmesh->listgrp[0];
   PMMG_pInt_comm int_node_comm,int_edge_comm;
-  MMG5_pTetra    pt;
   MMG5_pPoint    ppt;
-  int            ie,i,ip,idx;
+  int            i,ip,idx;
 
   assert( parmesh->ngrp == 1 );
   assert( mesh = grp->mesh );
@@ -1294,20 +1296,18 @@ int PMMG_hashNorver( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *hash,
   memset(int_node_comm->intvalues,0x00,2*int_node_comm->nitem*sizeof(int));
   memset(int_edge_comm->intvalues,0x00,2*int_edge_comm->nitem*sizeof(int));
 
-  /* Store internal communicator index on the point itself */
-  for( ip = 1; ip <= mesh->np; ip++ ) {
-    ppt = &mesh->point[ip];
-    ppt->flag = 0;
-    PMMG_point2int_comm_index_reset( ppt );
-  }
+  /* Store internal communicator index on the point itself. Only the parallel
+   * points are visited by the loops of the normal computation, so there is no
+   * need to reset the other points. */
   for( i = 0; i < grp->nitem_int_node_comm; i++ ) {
     ip  = grp->node2int_node_comm_index1[i];
     idx = grp->node2int_node_comm_index2[i];
     ppt = &mesh->point[ip];
+    ppt->flag = 0;
     PMMG_point2int_comm_index_set( ppt,idx );
   }
 
-  /* Create xpoints */
+  /* Create xpoints and reset the surface colors stored in the tetra mark */
   if( !PMMG_hashNorver_xp_init( parmesh,var ) )
     return 0;
 
@@ -1333,13 +1333,6 @@ int PMMG_hashNorver( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *hash,
    *       - propagate colors through local iterations.
    */
 
-  /* Reset tetra mark */
-  for( ie = 1; ie <= mesh->ne; ie++ ) {
-    pt = &mesh->tetra[ie];
-    if( !MG_EOK(pt) ) continue;
-    pt->mark = 0;
-  }
-
   /* 3.1) Local update iterations */
   if( !PMMG_hashNorver_locIter( parmesh,var ) ) return 0;
 
@@ -1490,19 +1483,15 @@ static inline
 int PMMG_update_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh) {
   MMG5_pTetra         ptet;
   MMG5_pPoint         ppt;
-  MMG5_Hash           hash;
-  int                 k,i;
+  int                 k,i,base;
   int                 nc, nre, ng, nrp,ier;
 
   /* Second: seek the non-required non-manifold points and try to analyse
    * whether they are corner or required. */
 
-  /* Hash table used by boulernm to store the special edges passing through
-   * a given point */
-  if ( ! MMG5_hashNew(mesh,&hash,mesh->np,(int)(3.71*mesh->np)) ) return 0;
-
+  /* The ball travel increments mesh->base, so keep the point stamp locally */
   nc = nre = 0;
-  ++mesh->base;
+  base = ++mesh->base;
   for (k=1; k<=mesh->ne; ++k) {
     ptet = &mesh->tetra[k];
     if ( !MG_EOK(ptet) ) continue;
@@ -1513,12 +1502,12 @@ int PMMG_update_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh) {
       /* Skip non-previously-parallel points */
       if ( !(ppt->tag & MG_OLDPARBDY) ) continue;
 
-      if ( (!MG_VOK(ppt)) || (ppt->flag==mesh->base)  ) continue;
-      ppt->flag = mesh->base;
+      if ( (!MG_VOK(ppt)) || (ppt->flag==base)  ) continue;
+      ppt->flag = base;
 
       if ( (!MG_EDG(ppt->tag)) || MG_SIN(ppt->tag) ) continue;
 
-      ier = MMG5_boulernm(mesh,&hash, k, i, &ng, &nrp);
+      ier = PMMG_boulernm(parmesh,mesh, k, i, 0, &ng, &nrp);
       if ( ier < 0 ) return 0;
       else if ( !ier ) continue;
 
@@ -1548,9 +1537,6 @@ int PMMG_update_singul(PMMG_pParMesh parmesh,MMG5_pMesh mesh) {
     }
   }
 
-  /* Free the edge hash table */
-  MMG5_DEL_MEM(mesh,hash.item);
-
   if ( mesh->info.ddebug || abs(mesh->info.imprim) > 3 )
     fprintf(stdout,"     %d corner and %d required vertices added\n",nc,nre);
 
@@ -80,43 +80,56 @@ int PMMG_Analys_Get_SurfNormalIndex( MMG5_pTetra pt,int ifac,int iloc ) {
 }
 
 /**
+ * \param edg list of the extremities of the special edges already seen.
+ * \param ns number of edges in the list.
+ * \param ib extremity to seek.
+ * \return 1 if \a ib is already in the list, 0 otherwise.
+ *
+ * All the edges counted by a ball travel share the ball vertex, thus an edge is
+ * identified by its second extremity and the list of seen edges is local to the
+ * ball (no mesh-sized hash table to reset).
+ *
+ */
+static inline
+int PMMG_boulernm_seen( int *edg,int ns,int ib ) {
+  int k;
+
+  for ( k=0; k<ns; ++k ) {
+    if ( edg[k] == ib ) return 1;
+  }
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
  * \param mesh pointer toward the mesh structure.
- * \param hash pointer toward an allocated hash table.
  * \param start index of the starting tetrahedra.
  * \param ip local index of the point in the tetrahedra \a start.
+ * \param skipPar 1 if we skip the parallel edges analyzed by another process.
  * \param ng pointer toward the number of ridges.
  * \param nr pointer toward the number of reference edges.
- * \return ns the number of special edges passing through ip, -1 if fail.
+ * \return ns the number of special edges passing through ip, 0 if the ball
+ * overflows.
  *
  * Count the number of ridges and reference edges incident to
  * the vertex \a ip when ip is non-manifold.
- * \remark Same as MMG5_boulernm(), but skip edges whose extremity is flagged with
- * a rank lower than myrank.
+ *
+ * \remark Same as MMG5_boulernm(), but the special edges are deduplicated in a
+ * ball-local list instead of a hash table that has to be cleared at each call,
+ * so the cost only depends on the ball size. If \a skipPar is set, skip edges
+ * whose extremity is flagged with a rank lower than myrank.
  *
  */
-int PMMG_boulernm(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_Hash *hash,int start,int ip,int *ng,int *nr){
+int PMMG_boulernm(PMMG_pParMesh parmesh,MMG5_pMesh mesh,int start,int ip,
+                  int8_t skipPar,int *ng,int *nr){
   MMG5_pTetra    pt,pt1;
   MMG5_pxTetra   pxt;
-  MMG5_hedge    *ph;
   int            *adja,nump,ilist,base,cur,k,k1,ns;
-  int            list[MMG3D_LMAX+2];
-  int            key,ia,ib,jj,a,b;
+  int            list[MMG3D_LMAX+2],edg[MMG3D_LMAX+2];
+  int            ib;
   int8_t         j,l,i,i1;
   uint8_t        ie;
 
-  /* reset the hash table */
-  for ( k=0;  k<=hash->max; ++k ) {
-    hash->item[k].a = 0;
-    hash->item[k].b = 0;
-  }
-
-  for ( k=0;  k<=hash->siz; ++k ) {
-    hash->item[k].nxt = 0;
-  }
-  for (k=hash->siz; k<hash->max; k++) {
-    hash->item[k].nxt = k+1;
-  }
-
   base = ++mesh->base;
   pt   = &mesh->tetra[start];
   nump = pt->v[ip];
@@ -148,47 +161,19 @@ int PMMG_boulernm(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_Hash *hash,int star
         /* Skip parallel boundaries that will be analyzed by another process. No
          * need to skip simple parallel edges, as there is no adjacent through
          * them. */
-        if( (pxt->tag[ie] & MG_PARBDYBDY) &&
+        if( skipPar && (pxt->tag[ie] & MG_PARBDYBDY) &&
             (mesh->point[pt->v[i]].flag < parmesh->myrank) ) {
            /* do nothing */
         } else if ( MG_EDG(pxt->tag[ie]) ) {
-          /* Seek if we have already seen the edge. If not, hash it and
+          /* Seek if we have already seen the edge. If not, store it and
            * increment ng or nr.*/
-          a = pt->v[MMG5_iare[ie][0]];
-          b = pt->v[MMG5_iare[ie][1]];
-          ia  = MG_MIN(a,b);
-          ib  = MG_MAX(a,b);
-          key = (MMG5_KA*ia + MMG5_KB*ib) % hash->siz;
-          ph  = &hash->item[key];
-
-          if ( ph->a == ia && ph->b == ib )
-            continue;
-          else if ( ph->a ) {
-            while ( ph->nxt && ph->nxt < hash->max ) {
-              ph = &hash->item[ph->nxt];
-              if ( ph->a == ia && ph->b == ib )  continue;
-            }
-            ph->nxt   = hash->nxt;
-            ph        = &hash->item[hash->nxt];
-
-            if ( hash->nxt >= hash->max-1 ) {
-              if ( mesh->info.ddebug )
-                fprintf(stderr,"\n  ## Warning: %s: memory alloc problem (edge):"
-                        " %d\n",__func__,hash->max);
-              MMG5_TAB_RECALLOC(mesh,hash->item,hash->max,MMG5_GAP,MMG5_hedge,
-                                 "MMG5_edge",return -1);
-              /* ph pointer may be false after realloc */
-              ph        = &hash->item[hash->nxt];
-
-              for (jj=ph->nxt; jj<hash->max; jj++)  hash->item[jj].nxt = jj+1;
-            }
-            hash->nxt = ph->nxt;
-          }
-
-          /* insert new edge */
-          ph->a = ia;
-          ph->b = ib;
-          ph->nxt = 0;
+          ib = pt->v[i1];
+          if ( PMMG_boulernm_seen( edg,ns,ib ) ) continue;
+
+          /* A ball of ilist tetra has less than ilist+2 distinct edges through
+           * nump, so ns cannot overflow before list does. */
+          assert ( ns < MMG3D_LMAX+2 );
+          edg[ns] = ib;
 
           if ( pxt->tag[ie] & MG_GEO )
             ++(*ng);
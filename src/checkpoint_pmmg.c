@@ -0,0 +1,904 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file checkpoint_pmmg.c
+ * \brief checkpoint and restart of the parmesh between adaptation iterations
+ * \copyright GNU Lesser General Public License.
+ *
+ * The checkpoint file is shared by all the processes and written with MPI-IO:
+ *   - a header: magic string, version, number of writing processes, iteration
+ *     to resume, run parameters and size of the data of each process;
+ *   - the data of each process: its groups (packed by \ref PMMG_mpipack_grp),
+ *     the sizes of its internal communicators and its external node and face
+ *     communicators.
+ * Old groups are not stored as they are rebuilt at the beginning of each
+ * iteration.
+ *
+ * On restart, the data of the old process \a o is loaded on the process
+ * \a o % nprocs. Processes that host several old processes merge their groups
+ * and communicators, extra processes start without groups and are filled by
+ * the load balancing of the first iteration.
+ *
+ */
+
+#include "parmmg.h"
+#include "mpipack_pmmg.h"
+#include "mpiunpack_pmmg.h"
+
+#define PMMG_CHKPT_MAGIC   "PMMGCHK"
+#define PMMG_CHKPT_VERSION 2
+
+/** Number of integers stored in the checkpoint header */
+#define PMMG_CHKPT_NHEAD  16
+
+/** Maximal number of bytes read or written by one MPI-IO call */
+#define PMMG_CHKPT_CHUNK  (1<<30)
+
+/**
+ * \struct PMMG_chkptComm
+ * \brief External communicator of an old process read from a checkpoint.
+ */
+typedef struct {
+  int  color_in;  /*!< old process that stores the items */
+  int  color_out; /*!< old remote process */
+  int  dest;      /*!< new remote process */
+  int  key[2];    /*!< sort key shared by both sides of the communicator */
+  int  nitem;     /*!< number of items */
+  int *idx;       /*!< position of the items in the merged internal communicator */
+} PMMG_chkptComm;
+
+/**
+ * \param ncomm number of external communicators.
+ * \param ext_comm array of external communicators.
+ *
+ * \return the size of the buffer needed to pack the external communicators.
+ *
+ */
+static
+size_t PMMG_chkpt_sizeofExtComm ( int ncomm,PMMG_pExt_comm ext_comm ) {
+  size_t siz;
+  int    k;
+
+  siz = sizeof(int);
+  for ( k=0; k<ncomm; ++k ) {
+    siz += (3 + ext_comm[k].nitem)*sizeof(int);
+  }
+  return siz;
+}
+
+/**
+ * \param ncomm number of external communicators.
+ * \param ext_comm array of external communicators.
+ * \param buffer pointer toward the buffer in which we pack the communicators.
+ *
+ * Pack the external communicators and shift the buffer pointer at the end of
+ * the written area.
+ *
+ */
+static
+void PMMG_chkpt_packExtComm ( int ncomm,PMMG_pExt_comm ext_comm,char **buffer ) {
+  char *tmp;
+  int   k,i;
+
+  tmp = *buffer;
+
+  *( (int *) tmp) = ncomm; tmp += sizeof(int);
+
+  for ( k=0; k<ncomm; ++k ) {
+    *( (int *) tmp) = ext_comm[k].color_in;  tmp += sizeof(int);
+    *( (int *) tmp) = ext_comm[k].color_out; tmp += sizeof(int);
+    *( (int *) tmp) = ext_comm[k].nitem;     tmp += sizeof(int);
+    for ( i=0; i<ext_comm[k].nitem; ++i ) {
+      *( (int *) tmp) = ext_comm[k].int_comm_index[i]; tmp += sizeof(int);
+    }
+  }
+
+  *buffer = tmp;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param buffer pointer toward the buffer from which we unpack the communicators.
+ * \param shift shift to apply to the internal communicator indices.
+ * \param ncomm pointer toward the number of communicators already read.
+ * \param comms pointer toward the array of communicators already read.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Unpack the external communicators of an old process, append them to the
+ * \a comms array and shift the buffer pointer at the end of the read area.
+ *
+ */
+static
+int PMMG_chkpt_unpackExtComm ( PMMG_pParMesh parmesh,char **buffer,int shift,
+                               int *ncomm,PMMG_chkptComm **comms ) {
+  PMMG_chkptComm *comm;
+  char           *tmp;
+  int            k,i,nc;
+
+  tmp = *buffer;
+
+  nc = *( (int *) tmp); tmp += sizeof(int);
+
+  if ( nc ) {
+    if ( *comms ) {
+      PMMG_REALLOC(parmesh,*comms,*ncomm+nc,*ncomm,PMMG_chkptComm,
+                   "checkpoint communicators",return 0);
+    }
+    else {
+      PMMG_CALLOC(parmesh,*comms,nc,PMMG_chkptComm,"checkpoint communicators",
+                  return 0);
+    }
+  }
+
+  for ( k=0; k<nc; ++k ) {
+    comm = &(*comms)[*ncomm];
+
+    comm->color_in  = *( (int *) tmp); tmp += sizeof(int);
+    comm->color_out = *( (int *) tmp); tmp += sizeof(int);
+    comm->nitem     = *( (int *) tmp); tmp += sizeof(int);
+    comm->idx       = NULL;
+
+    ++(*ncomm);
+
+    PMMG_MALLOC(parmesh,comm->idx,comm->nitem,int,"checkpoint comm items",
+                return 0);
+    for ( i=0; i<comm->nitem; ++i ) {
+      comm->idx[i] = shift + *( (int *) tmp); tmp += sizeof(int);
+    }
+  }
+
+  *buffer = tmp;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param ncomm number of communicators.
+ * \param comms array of communicators.
+ *
+ * Free the communicators read from a checkpoint.
+ *
+ */
+static
+void PMMG_chkpt_freeComms ( PMMG_pParMesh parmesh,int ncomm,PMMG_chkptComm **comms ) {
+  int k;
+
+  if ( !*comms ) return;
+
+  for ( k=0; k<ncomm; ++k ) {
+    PMMG_DEL_MEM(parmesh,(*comms)[k].idx,int,"checkpoint comm items");
+  }
+  PMMG_DEL_MEM(parmesh,*comms,PMMG_chkptComm,"checkpoint communicators");
+}
+
+/**
+ * \param a pointer toward a PMMG_chkptComm structure.
+ * \param b pointer toward a PMMG_chkptComm structure.
+ *
+ * \return -1 if a is before b, 1 if a is after b, 0 otherwise.
+ *
+ * Compare two communicators with respect to their new remote process then to
+ * their sort key (used by qsort).
+ *
+ */
+static
+int PMMG_chkpt_compComm ( const void *a,const void *b ) {
+  const PMMG_chkptComm *ca = (const PMMG_chkptComm *)a;
+  const PMMG_chkptComm *cb = (const PMMG_chkptComm *)b;
+
+  if ( ca->dest   != cb->dest   ) return ( ca->dest   < cb->dest   ) ? -1 : 1;
+  if ( ca->key[0] != cb->key[0] ) return ( ca->key[0] < cb->key[0] ) ? -1 : 1;
+  if ( ca->key[1] != cb->key[1] ) return ( ca->key[1] < cb->key[1] ) ? -1 : 1;
+  return 0;
+}
+
+/**
+ * \param parent union-find array.
+ * \param i item index.
+ *
+ * \return the representative of the class of \a i.
+ *
+ */
+static inline
+int PMMG_chkpt_find ( int *parent,int i ) {
+  while ( parent[i] != i ) {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param ncomm number of external communicators of the hosted old processes.
+ * \param comms external communicators of the hosted old processes.
+ * \param nitem number of items of the concatenated internal communicators.
+ * \param map array of size \a nitem filled with the new item positions.
+ * \param nitem_new pointer toward the size of the merged internal communicator.
+ * \param next pointer toward the number of new external communicators.
+ * \param ext_comm pointer toward the array of new external communicators.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Merge the communicators of the old processes hosted by this process:
+ *   1. items shared by two hosted old processes are identified (the \a i^th
+ *      item of the communicator from \a o to \a c is the \a i^th item of the
+ *      communicator from \a c to \a o) and numbered once;
+ *   2. the communicators toward the same new process are concatenated,
+ *      following an order shared by both sides, and repeated items are removed
+ *      (keeping the first occurrence on both sides as the node communicators
+ *      are complete).
+ *
+ */
+static
+int PMMG_chkpt_mergeComms ( PMMG_pParMesh parmesh,int ncomm,
+                            PMMG_chkptComm *comms,int nitem,int *map,
+                            int *nitem_new,int *next,PMMG_pExt_comm *ext_comm ) {
+  PMMG_chkptComm *comm,*pair;
+  PMMG_pExt_comm pext;
+  const int      nprocs = parmesh->nprocs;
+  const int      myrank = parmesh->myrank;
+  int            *parent,*stamp;
+  int            k,l,i,ia,ib,nc,dest,ier;
+
+  parent = stamp = NULL;
+  ier = 0;
+
+  assert ( !*ext_comm );
+
+  PMMG_MALLOC(parmesh,parent,nitem,int,"union-find",goto end);
+  for ( i=0; i<nitem; ++i ) parent[i] = i;
+
+  /** Step 1: identify the items shared by two hosted old processes */
+  for ( k=0; k<ncomm; ++k ) {
+    comm       = &comms[k];
+    comm->dest = comm->color_out % nprocs;
+
+    if ( comm->dest != myrank || comm->color_in > comm->color_out ) continue;
+
+    pair = NULL;
+    for ( l=0; l<ncomm; ++l ) {
+      if ( comms[l].color_in == comm->color_out &&
+           comms[l].color_out == comm->color_in ) {
+        pair = &comms[l];
+        break;
+      }
+    }
+    if ( (!pair) || pair->nitem != comm->nitem ) {
+      fprintf(stderr,"\n  ## Error: %s: rank %d: non matching communicators"
+              " between old processes %d and %d.\n",__func__,myrank,
+              comm->color_in,comm->color_out);
+      goto end;
+    }
+    for ( i=0; i<comm->nitem; ++i ) {
+      ia = PMMG_chkpt_find(parent,comm->idx[i]);
+      ib = PMMG_chkpt_find(parent,pair->idx[i]);
+      if ( ia != ib ) parent[MG_MAX(ia,ib)] = MG_MIN(ia,ib);
+    }
+  }
+
+  /* Number the classes */
+  *nitem_new = 0;
+  for ( i=0; i<nitem; ++i ) {
+    ia = PMMG_chkpt_find(parent,i);
+    map[i] = ( ia == i ) ? (*nitem_new)++ : map[ia];
+  }
+
+  /** Step 2: concatenate the communicators toward a same new process */
+  for ( k=0; k<ncomm; ++k ) {
+    comm = &comms[k];
+    if ( comm->dest == myrank ) {
+      comm->dest = nprocs;
+      continue;
+    }
+    if ( myrank < comm->dest ) {
+      comm->key[0] = comm->color_in;
+      comm->key[1] = comm->color_out;
+    }
+    else {
+      comm->key[0] = comm->color_out;
+      comm->key[1] = comm->color_in;
+    }
+  }
+  qsort(comms,ncomm,sizeof(PMMG_chkptComm),PMMG_chkpt_compComm);
+
+  *next = 0;
+  for ( k=0; k<ncomm && comms[k].dest<nprocs; ++k ) {
+    if ( !k || comms[k].dest != comms[k-1].dest ) ++(*next);
+  }
+
+  if ( *next ) {
+    PMMG_CALLOC(parmesh,*ext_comm,*next,PMMG_Ext_comm,"ext comm",goto end);
+    PMMG_MALLOC(parmesh,stamp,MG_MAX(*nitem_new,1),int,"stamp",goto end);
+    for ( i=0; i<*nitem_new; ++i ) stamp[i] = PMMG_UNSET;
+  }
+
+  k  = 0;
+  nc = 0;
+  while ( k<ncomm && comms[k].dest<nprocs ) {
+    dest = comms[k].dest;
+    pext = &(*ext_comm)[nc++];
+    pext->color_in  = myrank;
+    pext->color_out = dest;
+
+    pext->nitem = 0;
+    for ( l=k; l<ncomm && comms[l].dest==dest; ++l ) {
+      pext->nitem += comms[l].nitem;
+    }
+    PMMG_MALLOC(parmesh,pext->int_comm_index,pext->nitem,int,"int_comm_index",
+                goto end);
+
+    pext->nitem = 0;
+    for ( ; k<ncomm && comms[k].dest==dest; ++k ) {
+      for ( i=0; i<comms[k].nitem; ++i ) {
+        ia = map[comms[k].idx[i]];
+        if ( stamp[ia] == dest ) continue;
+        stamp[ia] = dest;
+        pext->int_comm_index[pext->nitem++] = ia;
+      }
+    }
+  }
+  assert ( nc == *next );
+
+  ier = 1;
+
+end:
+  if ( !ier && *ext_comm ) {
+    PMMG_parmesh_ext_comm_free(parmesh,*ext_comm,*next);
+    PMMG_DEL_MEM(parmesh,*ext_comm,PMMG_Ext_comm,"ext comm");
+    *next = 0;
+  }
+  PMMG_DEL_MEM(parmesh,stamp,int,"stamp");
+  PMMG_DEL_MEM(parmesh,parent,int,"union-find");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handler.
+ * \param offset position in the file.
+ * \param buf data buffer.
+ * \param size number of bytes.
+ * \param wrt 1 to write the buffer, 0 to read it.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Independent read or write of a large buffer (by chunks of
+ * PMMG_CHKPT_CHUNK bytes).
+ *
+ */
+static
+int PMMG_chkpt_io ( PMMG_pParMesh parmesh,MPI_File fh,MPI_Offset offset,
+                    char *buf,size_t size,int wrt ) {
+  MPI_Status status;
+  size_t     done;
+  int        count,ier;
+
+  ier  = 1;
+  done = 0;
+  while ( done < size ) {
+    count = (int)MG_MIN(size-done,(size_t)PMMG_CHKPT_CHUNK);
+    if ( wrt ) {
+      MPI_CHECK( MPI_File_write_at(fh,offset+done,buf+done,count,MPI_CHAR,&status),
+                 ier = 0; break );
+    }
+    else {
+      MPI_CHECK( MPI_File_read_at(fh,offset+done,buf+done,count,MPI_CHAR,&status),
+                 ier = 0; break );
+    }
+    done += count;
+  }
+  return ier;
+}
+
+/**
+ * \param nprocs number of processes that have written the checkpoint.
+ *
+ * \return the size of the checkpoint header.
+ *
+ */
+static inline
+size_t PMMG_chkpt_headerSize ( int nprocs ) {
+  return 8*sizeof(char) + PMMG_CHKPT_NHEAD*sizeof(int) + sizeof(double)
+    + nprocs*sizeof(long long);
+}
+
+int PMMG_saveCheckpoint(PMMG_pParMesh parmesh,const char *filename) {
+  PMMG_pGrp  grp;
+  MPI_File   fh;
+  MPI_Offset offset;
+  long long  blobsize,*blobsizes;
+  size_t     hdrsize;
+  char       *buffer,*ptr,*header,*tmpname;
+  int        head[PMMG_CHKPT_NHEAD];
+  int        k,ier,ieresult,isopen;
+
+  buffer = header = tmpname = NULL;
+  blobsizes = NULL;
+  isopen = 0;
+
+  if ( (!filename) || !(*filename) ) {
+    filename = parmesh->chkptout;
+  }
+  if ( (!filename) || !(*filename) ) {
+    if ( !parmesh->myrank ) {
+      fprintf(stderr,"  ## Error: %s: no checkpoint file name.\n",__func__);
+    }
+    return 0;
+  }
+
+  /** Step 1: pack the groups and the communicators of this process */
+  blobsize = 2*sizeof(int);
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    blobsize += PMMG_mpisizeof_grp(&parmesh->listgrp[k],PMMG_SOLPREC_double);
+  }
+  blobsize += PMMG_chkpt_sizeofExtComm(parmesh->next_node_comm,parmesh->ext_node_comm);
+  blobsize += PMMG_chkpt_sizeofExtComm(parmesh->next_face_comm,parmesh->ext_face_comm);
+  blobsize += sizeof(int);
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,buffer,blobsize,char,"checkpoint buffer",ier = 0);
+
+  /* The checkpoint is written in a temporary file that replaces the previous
+   * checkpoint only once complete: a job killed during the writing keeps its
+   * last restart point */
+  PMMG_MALLOC(parmesh,tmpname,strlen(filename)+5,char,"checkpoint file name",
+              ier = 0);
+  if ( tmpname ) {
+    strcpy(tmpname,filename);
+    strcat(tmpname,".tmp");
+  }
+
+  hdrsize = PMMG_chkpt_headerSize(parmesh->nprocs);
+  if ( parmesh->myrank == parmesh->info.root ) {
+    PMMG_MALLOC(parmesh,header,hdrsize,char,"checkpoint header",ier = 0);
+    PMMG_MALLOC(parmesh,blobsizes,parmesh->nprocs,long long,"blob sizes",ier = 0);
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+  if ( !ieresult ) goto end;
+
+  ptr = buffer;
+  *( (int *) ptr) = parmesh->ngrp; ptr += sizeof(int);
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    grp = &parmesh->listgrp[k];
+    PMMG_mpipack_grp(grp,PMMG_SOLPREC_double,&ptr);
+  }
+  *( (int *) ptr) = parmesh->int_node_comm ? parmesh->int_node_comm->nitem : 0;
+  ptr += sizeof(int);
+  *( (int *) ptr) = parmesh->int_face_comm ? parmesh->int_face_comm->nitem : 0;
+  ptr += sizeof(int);
+  PMMG_chkpt_packExtComm(parmesh->next_node_comm,parmesh->ext_node_comm,&ptr);
+  PMMG_chkpt_packExtComm(parmesh->next_face_comm,parmesh->ext_face_comm,&ptr);
+  assert ( ptr - buffer <= blobsize );
+  blobsize = ptr - buffer;
+
+  /** Step 2: compute the position of the data of each process */
+  MPI_CHECK( MPI_Gather(&blobsize,1,MPI_LONG_LONG,blobsizes,1,MPI_LONG_LONG,
+                        parmesh->info.root,parmesh->comm), ier = 0 );
+
+  offset = 0;
+  MPI_CHECK( MPI_Exscan(&blobsize,&offset,1,MPI_LONG_LONG,MPI_SUM,parmesh->comm),
+             ier = 0 );
+  if ( !parmesh->myrank ) offset = 0;
+  offset += hdrsize;
+
+  /** Step 3: fill the header */
+  if ( parmesh->myrank == parmesh->info.root ) {
+    grp = parmesh->ngrp ? &parmesh->listgrp[0] : NULL;
+
+    head[0]  = PMMG_CHKPT_VERSION;
+    head[1]  = parmesh->nprocs;
+    head[2]  = parmesh->iter+1;
+    head[3]  = parmesh->niter;
+    head[4]  = ( grp && grp->met ) ? grp->met->size : 1;
+    head[5]  = parmesh->info.inputMet;
+    head[6]  = parmesh->info.repartitioning;
+    head[7]  = parmesh->info.ifc_layers;
+    head[8]  = parmesh->info.nobalancing;
+    head[9]  = parmesh->info.loadbalancing_mode;
+    head[10] = parmesh->info.contiguous_mode;
+    head[11] = parmesh->info.metis_ratio;
+    head[12] = parmesh->info.target_mesh_size;
+    head[13] = parmesh->info.fem;
+    head[14] = parmesh->info.sethmin;
+    head[15] = parmesh->info.sethmax;
+
+    ptr = header;
+    memcpy(ptr,PMMG_CHKPT_MAGIC,8*sizeof(char));          ptr += 8*sizeof(char);
+    memcpy(ptr,head,PMMG_CHKPT_NHEAD*sizeof(int));        ptr += PMMG_CHKPT_NHEAD*sizeof(int);
+    memcpy(ptr,&parmesh->info.grps_ratio,sizeof(double)); ptr += sizeof(double);
+    memcpy(ptr,blobsizes,parmesh->nprocs*sizeof(long long));
+  }
+
+  /** Step 4: write the file */
+  MPI_CHECK( MPI_File_open(parmesh->comm,tmpname,MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                           MPI_INFO_NULL,&fh), ier = 0 );
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+  if ( !ieresult ) {
+    if ( !parmesh->myrank ) {
+      fprintf(stderr,"  ## Error: %s: unable to open file %s.\n",__func__,tmpname);
+    }
+    goto end;
+  }
+  isopen = 1;
+
+  MPI_CHECK( MPI_File_set_size(fh,0), ier = 0 );
+
+  if ( parmesh->myrank == parmesh->info.root ) {
+    ier = MG_MIN( ier, PMMG_chkpt_io(parmesh,fh,0,header,hdrsize,1) );
+  }
+  ier = MG_MIN( ier, PMMG_chkpt_io(parmesh,fh,offset,buffer,blobsize,1) );
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+
+  /** Step 5: replace the previous checkpoint by the complete file */
+  MPI_File_close(&fh);
+  isopen = 0;
+
+  if ( ieresult ) {
+    ier = 1;
+    if ( parmesh->myrank == parmesh->info.root ) {
+      if ( rename(tmpname,filename) ) {
+        fprintf(stderr,"  ## Error: %s: unable to rename %s into %s.\n",
+                __func__,tmpname,filename);
+        ier = 0;
+      }
+    }
+    MPI_CHECK( MPI_Bcast(&ier,1,MPI_INT,parmesh->info.root,parmesh->comm),
+               ier = 0 );
+    ieresult = ier;
+  }
+
+  if ( ieresult && parmesh->info.imprim > PMMG_VERB_STEPS ) {
+    fprintf(stdout,"       checkpoint of iteration %d saved in %s\n",
+            parmesh->iter+1,filename);
+  }
+
+end:
+  if ( isopen ) {
+    MPI_File_close(&fh);
+  }
+  PMMG_DEL_MEM(parmesh,blobsizes,long long,"blob sizes");
+  PMMG_DEL_MEM(parmesh,header,char,"checkpoint header");
+  PMMG_DEL_MEM(parmesh,buffer,char,"checkpoint buffer");
+  PMMG_DEL_MEM(parmesh,tmpname,char,"checkpoint file name");
+
+  return ieresult;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param metsize size of the metric.
+ *
+ * Set the function pointers depending on the metric type (processes without
+ * groups use the metric size stored in the checkpoint header).
+ *
+ */
+static
+void PMMG_chkpt_setfunc ( PMMG_pParMesh parmesh,int metsize ) {
+  MMG5_Mesh mesh;
+  MMG5_Sol  met;
+
+  MMG3D_Set_commonFunc();
+
+  if ( parmesh->ngrp ) {
+    MMG3D_setfunc(parmesh->listgrp[0].mesh,parmesh->listgrp[0].met);
+    PMMG_setfunc(parmesh);
+    return;
+  }
+
+  memset(&mesh,0,sizeof(MMG5_Mesh));
+  memset(&met,0,sizeof(MMG5_Sol));
+  met.size = metsize;
+  MMG3D_setfunc(&mesh,&met);
+
+  if ( metsize == 6 ) {
+    PMMG_interp4bar = PMMG_interp4bar_ani;
+    PMMG_interp3bar = PMMG_interp3bar_ani;
+    PMMG_interp2bar = PMMG_interp2bar_ani;
+  }
+  else {
+    PMMG_interp4bar = PMMG_interp4bar_iso;
+    PMMG_interp3bar = PMMG_interp3bar_iso;
+    PMMG_interp2bar = PMMG_interp2bar_iso;
+  }
+}
+
+int PMMG_loadCheckpoint(PMMG_pParMesh parmesh,const char *filename) {
+  PMMG_pGrp      grp;
+  PMMG_chkptComm *ncomms,*fcomms;
+  MPI_File       fh;
+  MPI_Offset     offset;
+  long long      *blobsizes;
+  size_t         hdrsize,maxsize;
+  char           magic[8],*buffer,*ptr;
+  int            head[PMMG_CHKPT_NHEAD];
+  int            *nmap,*fmap,nncomm,nfcomm,nitem_node,nitem_face;
+  int            nprocs_old,o,k,i,ngrp_o,ngrp,nitem;
+  int            ier,ieresult,isopen;
+
+  buffer    = NULL;
+  blobsizes = NULL;
+  ncomms = fcomms = NULL;
+  nmap = fmap = NULL;
+  nncomm = nfcomm = 0;
+  isopen = 0;
+  ieresult = 0;
+
+  if ( (!filename) || !(*filename) ) {
+    filename = parmesh->chkptin;
+  }
+  if ( (!filename) || !(*filename) ) {
+    if ( !parmesh->myrank ) {
+      fprintf(stderr,"  ## Error: %s: no checkpoint file name.\n",__func__);
+    }
+    return 0;
+  }
+
+  ier = 1;
+  MPI_CHECK( MPI_File_open(parmesh->comm,filename,MPI_MODE_RDONLY,
+                           MPI_INFO_NULL,&fh), ier = 0 );
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+  if ( !ieresult ) {
+    if ( !parmesh->myrank ) {
+      fprintf(stderr,"  ** %s  NOT FOUND.\n",filename);
+    }
+    return 0;
+  }
+  isopen = 1;
+
+  /** Step 1: read the header */
+  MPI_CHECK( MPI_File_read_at_all(fh,0,magic,8,MPI_CHAR,MPI_STATUS_IGNORE),
+             ier = 0 );
+  MPI_CHECK( MPI_File_read_at_all(fh,8,head,PMMG_CHKPT_NHEAD,MPI_INT,
+                                  MPI_STATUS_IGNORE), ier = 0 );
+  if ( ier && ( strncmp(magic,PMMG_CHKPT_MAGIC,8) ||
+                head[0] != PMMG_CHKPT_VERSION || head[1] < 1 ) ) {
+    if ( !parmesh->myrank ) {
+      fprintf(stderr,"  ## Error: %s: %s is not a valid checkpoint file.\n",
+              __func__,filename);
+    }
+    ier = 0;
+  }
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+  if ( !ieresult ) goto end;
+
+  nprocs_old = head[1];
+  hdrsize    = PMMG_chkpt_headerSize(nprocs_old);
+
+  PMMG_MALLOC(parmesh,blobsizes,nprocs_old,long long,"blob sizes",ier = 0);
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+  if ( !ieresult ) goto end;
+
+  offset = 8 + PMMG_CHKPT_NHEAD*sizeof(int);
+  MPI_CHECK( MPI_File_read_at_all(fh,offset,&parmesh->info.grps_ratio,1,MPI_DOUBLE,
+                                  MPI_STATUS_IGNORE), ier = 0 );
+  offset += sizeof(double);
+  MPI_CHECK( MPI_File_read_at_all(fh,offset,blobsizes,nprocs_old,MPI_LONG_LONG,
+                                  MPI_STATUS_IGNORE), ier = 0 );
+
+  parmesh->iter                    = head[2];
+  if ( !parmesh->info.setniter ) {
+    /* Keep the number of iterations given by the user for the restart */
+    parmesh->niter                 = head[3];
+  }
+  parmesh->info.inputMet           = head[5];
+  parmesh->info.repartitioning     = head[6];
+  parmesh->info.ifc_layers         = head[7];
+  parmesh->info.nobalancing        = head[8];
+  parmesh->info.loadbalancing_mode = head[9];
+  parmesh->info.contiguous_mode    = head[10];
+  parmesh->info.metis_ratio        = head[11];
+  parmesh->info.target_mesh_size   = head[12];
+  parmesh->info.fem                = head[13];
+  parmesh->info.sethmin            = head[14];
+  parmesh->info.sethmax            = head[15];
+
+  if ( parmesh->nprocs > nprocs_old ) {
+    if ( parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_parmetis ) {
+      /* Parmetis doesn't support processes without graph vertices */
+      if ( !parmesh->myrank ) {
+        fprintf(stdout,"  ## Warning: %s: restart on more processes than"
+                " checkpointed ones: use metis for load balancing.\n",__func__);
+      }
+      parmesh->info.loadbalancing_mode = PMMG_LOADBALANCING_metis;
+    }
+  }
+  else if ( parmesh->nprocs < nprocs_old && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  %% Restart of %d processes on %d processes.\n",
+            nprocs_old,parmesh->nprocs);
+  }
+
+  /** Step 2: free the current groups and communicators */
+  PMMG_listgrp_free(parmesh,&parmesh->listgrp,parmesh->ngrp);
+  parmesh->ngrp = 0;
+  PMMG_listgrp_free(parmesh,&parmesh->old_listgrp,parmesh->nold_grp);
+  parmesh->nold_grp = 0;
+
+  PMMG_parmesh_ext_comm_free(parmesh,parmesh->ext_node_comm,parmesh->next_node_comm);
+  PMMG_DEL_MEM(parmesh,parmesh->ext_node_comm,PMMG_Ext_comm,"ext node comm");
+  parmesh->next_node_comm = 0;
+  PMMG_parmesh_ext_comm_free(parmesh,parmesh->ext_face_comm,parmesh->next_face_comm);
+  PMMG_DEL_MEM(parmesh,parmesh->ext_face_comm,PMMG_Ext_comm,"ext face comm");
+  parmesh->next_face_comm = 0;
+
+  if ( parmesh->int_node_comm ) {
+    PMMG_parmesh_int_comm_free(parmesh,parmesh->int_node_comm);
+  }
+  else {
+    PMMG_CALLOC(parmesh,parmesh->int_node_comm,1,PMMG_Int_comm,"int node comm",ier = 0);
+  }
+  if ( parmesh->int_face_comm ) {
+    PMMG_parmesh_int_comm_free(parmesh,parmesh->int_face_comm);
+  }
+  else {
+    PMMG_CALLOC(parmesh,parmesh->int_face_comm,1,PMMG_Int_comm,"int face comm",ier = 0);
+  }
+
+  /** Step 3: read the data of the hosted old processes */
+  maxsize = 0;
+  for ( o=parmesh->myrank; o<nprocs_old; o+=parmesh->nprocs ) {
+    maxsize = MG_MAX(maxsize,(size_t)blobsizes[o]);
+  }
+  if ( ier && maxsize ) {
+    PMMG_MALLOC(parmesh,buffer,maxsize,char,"checkpoint buffer",ier = 0);
+  }
+
+  nitem_node = nitem_face = 0;
+  offset = hdrsize;
+  for ( o=0; o<nprocs_old && ier; ++o ) {
+    if ( o % parmesh->nprocs != parmesh->myrank ) {
+      offset += blobsizes[o];
+      continue;
+    }
+
+    if ( !PMMG_chkpt_io(parmesh,fh,offset,buffer,blobsizes[o],0) ) {
+      ier = 0;
+      break;
+    }
+    offset += blobsizes[o];
+
+    ptr    = buffer;
+    ngrp_o = *( (int *) ptr); ptr += sizeof(int);
+    ngrp   = parmesh->ngrp;
+
+    if ( ngrp_o ) {
+      if ( ngrp ) {
+        PMMG_RECALLOC(parmesh,parmesh->listgrp,ngrp+ngrp_o,ngrp,PMMG_Grp,"listgrp",
+                      ier = 0; break);
+      }
+      else {
+        PMMG_CALLOC(parmesh,parmesh->listgrp,ngrp_o,PMMG_Grp,"listgrp",
+                    ier = 0; break);
+      }
+      parmesh->ngrp += ngrp_o;
+    }
+
+    for ( k=ngrp; k<ngrp+ngrp_o; ++k ) {
+      ier = MG_MIN( ier, PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,k,&ptr) );
+
+      /* Shift the positions in the internal communicators */
+      grp = &parmesh->listgrp[k];
+      for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+        grp->node2int_node_comm_index2[i] += nitem_node;
+      }
+      for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
+        grp->face2int_face_comm_index2[i] += nitem_face;
+      }
+    }
+    if ( !ier ) break;
+
+    if ( !PMMG_chkpt_unpackExtComm(parmesh,&ptr,nitem_node,&nncomm,&ncomms) ||
+         !PMMG_chkpt_unpackExtComm(parmesh,&ptr,nitem_face,&nfcomm,&fcomms) ) {
+      ier = 0;
+      break;
+    }
+    nitem_node += *( (int *) ptr); ptr += sizeof(int);
+    nitem_face += *( (int *) ptr); ptr += sizeof(int);
+  }
+  PMMG_DEL_MEM(parmesh,buffer,char,"checkpoint buffer");
+
+  /** Step 4: merge the communicators of the hosted old processes */
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,nmap,MG_MAX(nitem_node,1),int,"node map",ier = 0);
+    PMMG_MALLOC(parmesh,fmap,MG_MAX(nitem_face,1),int,"face map",ier = 0);
+  }
+  if ( ier ) {
+    ier = PMMG_chkpt_mergeComms(parmesh,nncomm,ncomms,nitem_node,nmap,
+                                &nitem,&parmesh->next_node_comm,
+                                &parmesh->ext_node_comm);
+    parmesh->int_node_comm->nitem = nitem;
+  }
+  if ( ier ) {
+    ier = PMMG_chkpt_mergeComms(parmesh,nfcomm,fcomms,nitem_face,fmap,
+                                &nitem,&parmesh->next_face_comm,
+                                &parmesh->ext_face_comm);
+    parmesh->int_face_comm->nitem = nitem;
+  }
+  if ( ier ) {
+    for ( k=0; k<parmesh->ngrp; ++k ) {
+      grp = &parmesh->listgrp[k];
+      for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+        grp->node2int_node_comm_index2[i] = nmap[grp->node2int_node_comm_index2[i]];
+      }
+      for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
+        grp->face2int_face_comm_index2[i] = fmap[grp->face2int_face_comm_index2[i]];
+      }
+    }
+  }
+
+  PMMG_DEL_MEM(parmesh,fmap,int,"face map");
+  PMMG_DEL_MEM(parmesh,nmap,int,"node map");
+  PMMG_chkpt_freeComms(parmesh,nfcomm,&fcomms);
+  PMMG_chkpt_freeComms(parmesh,nncomm,&ncomms);
+
+  /** Step 5: update the tags of the merged interfaces, the memory repartition
+   * and the mesh analysis as at the end of an iteration */
+  if ( ier && parmesh->nprocs < nprocs_old ) {
+    ier = PMMG_updateTag(parmesh);
+  }
+  if ( ier ) {
+    ier = PMMG_updateMeshSize(parmesh,1);
+  }
+  if ( ier ) {
+    PMMG_chkpt_setfunc(parmesh,head[4]);
+    ier = PMMG_update_analys(parmesh);
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ieresult,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ieresult = 0 );
+
+  if ( ieresult ) {
+    assert ( PMMG_check_extFaceComm(parmesh) );
+    assert ( PMMG_check_extNodeComm(parmesh) );
+
+    parmesh->restart = 1;
+    if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+      fprintf(stdout,"  %% Restart at iteration %d from %s.\n",
+              parmesh->iter+1,filename);
+    }
+  }
+  else if ( !parmesh->myrank ) {
+    fprintf(stderr,"  ## Error: %s: unable to restart from %s.\n",__func__,
+            filename);
+  }
+
+end:
+  if ( isopen ) {
+    MPI_File_close(&fh);
+  }
+  PMMG_DEL_MEM(parmesh,blobsizes,long long,"blob sizes");
+
+  return ieresult;
+}
@@ -1233,8 +1233,17 @@ int PMMG_build_nodeCommFromFaces( PMMG_pParMesh parmesh ) {
   MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
   if ( !ier_glob ) return 0;
 
-  /** Fill the external node communicator */
-  ier = PMMG_build_completeExtNodeComm(parmesh);
+  /** Fill the external node communicator: try the rendezvous algorithm (fixed
+   * number of communications), fall back on the iterative propagation of the
+   * procs lists if it fails (the result is the same on all the procs). */
+  ier = PMMG_build_completeExtNodeComm_rdv(parmesh);
+  if ( !ier ) {
+    if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"       rendezvous node matching failed:"
+              " iterative completion of the node communicators.\n");
+    }
+    ier = PMMG_build_completeExtNodeComm(parmesh);
+  }
   MPI_Allreduce( &ier, &ier_glob, 1, MPI_INT, MPI_MIN, parmesh->comm);
   if ( !ier ) {
     fprintf(stderr,"\n  ## Error: %s: unable to complete the external node"
@@ -1429,6 +1438,144 @@ end:
   return ier;
 }
 
+/**
+ * \struct PMMG_nodeKey
+ *
+ * \brief Global key of a node and its position in the internal node
+ * communicator.
+ *
+ */
+typedef struct {
+  int key; /*!< global key of the node */
+  int pos; /*!< position of the node in the internal communicator */
+} PMMG_nodeKey;
+
+/**
+ * \param parmesh pointer toward a parmesh structure
+ * \param list array of node keys
+ * \param n size of the list
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Sort the list by increasing keys (the keys must be non-negative) with a
+ * least-significant-digit radix sort on the 4 bytes of the keys.
+ *
+ */
+static
+int PMMG_radixSort_nodeKeys( PMMG_pParMesh parmesh,PMMG_nodeKey *list,int n ) {
+  PMMG_nodeKey *buf,*src,*dst,*swp;
+  int          count[256],shift,i,b,sum,tmp;
+
+  PMMG_MALLOC(parmesh,buf,n,PMMG_nodeKey,"sorted node keys",return 0);
+
+  src = list;
+  dst = buf;
+  for ( shift=0; shift<32; shift+=8 ) {
+    memset(count,0,256*sizeof(int));
+    for ( i=0; i<n; ++i )
+      ++count[ ((unsigned int)src[i].key >> shift) & 0xff ];
+
+    sum = 0;
+    for ( b=0; b<256; ++b ) {
+      tmp      = count[b];
+      count[b] = sum;
+      sum     += tmp;
+    }
+    for ( i=0; i<n; ++i )
+      dst[ count[((unsigned int)src[i].key >> shift) & 0xff]++ ] = src[i];
+
+    swp = src;
+    src = dst;
+    dst = swp;
+  }
+  /* After an even number of passes, the sorted list is in list */
+  assert ( src == list );
+
+  PMMG_DEL_MEM(parmesh,buf,PMMG_nodeKey,"sorted node keys");
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward a parmesh structure
+ * \param posKey global key of each position of the internal node communicator
+ * \param nitem_node number of positions in the internal node communicator,
+ * updated with the number of unique nodes.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Merge the positions of the internal node communicator that share the same
+ * global node key and pack the node2int_node_comm_index2 arrays of the groups.
+ *
+ */
+static
+int PMMG_build_intNodeCommFromKeys( PMMG_pParMesh parmesh,int *posKey,
+                                    int *nitem_node ) {
+  PMMG_pGrp    grp;
+  PMMG_nodeKey *list;
+  int          *new_pos,n,grpid,i,j,idx;
+
+  n    = *nitem_node;
+  list = NULL;
+
+  PMMG_MALLOC(parmesh,new_pos,n,int,"new pos in int_node_comm",return 0);
+  PMMG_MALLOC(parmesh,list,n,PMMG_nodeKey,"node keys",goto end);
+
+  for ( i=0; i<n; ++i ) {
+    list[i].key = posKey[i];
+    list[i].pos = i;
+  }
+
+  if ( !PMMG_radixSort_nodeKeys(parmesh,list,n) ) goto end;
+
+  /* Give the same position to the occurences of a same key */
+  idx = 0;
+  if ( n ) {
+    new_pos[list[0].pos] = 0;
+    for ( i=1; i<n; ++i ) {
+      if ( list[i].key != list[i-1].key ) ++idx;
+      new_pos[list[i].pos] = idx;
+    }
+  }
+
+  /* Update node2int_node_comm arrays */
+  for ( grpid=0; grpid<parmesh->ngrp; ++grpid ) {
+    grp  = &parmesh->listgrp[grpid];
+
+    for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+      idx = grp->node2int_node_comm_index2[i];
+      grp->node2int_node_comm_index2[i] = new_pos[idx];
+    }
+  }
+
+  /* Number the positions in the order of the groups */
+  for ( i=0; i<n; ++i )
+    new_pos[i] = PMMG_UNSET;
+
+  j = 0;
+  for ( grpid=0; grpid<parmesh->ngrp; ++grpid ) {
+    grp  = &parmesh->listgrp[grpid];
+
+    for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+
+      idx = grp->node2int_node_comm_index2[i];
+      if ( new_pos[idx]<0 ) new_pos[idx] = j++;
+
+      grp->node2int_node_comm_index2[i] = new_pos[idx];
+    }
+  }
+  *nitem_node = j;
+
+  PMMG_DEL_MEM(parmesh,list,PMMG_nodeKey,"node keys");
+  PMMG_DEL_MEM(parmesh,new_pos,int,"new pos in int_node_comm");
+  return 1;
+
+end:
+  PMMG_DEL_MEM(parmesh,list,PMMG_nodeKey,"node keys");
+  PMMG_DEL_MEM(parmesh,new_pos,int,"new pos in int_node_comm");
+  return 0;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure
  *
@@ -1436,6 +1583,12 @@ end:
  *
  * Build the internal node communicators from the faces ones.
  *
+ * If the groups own node2int_node_comm arrays when entering the function, their
+ * index2 arrays are expected to store the global keys of the nodes (see \ref
+ * PMMG_nodeComm2keys): the nodes shared by several groups are then matched by
+ * their keys in linear time. The matching through the faces and the
+ * coordinates is only used if some interface nodes have no key.
+ *
  */
 int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
   PMMG_pGrp       grp;
@@ -1448,7 +1601,8 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
   int             *node2int_node_comm_index1,*node2int_node_comm_index2;
   int             *shared_fac,*new_pos,nitem_node,first_nitem_node,pos;
   int             *face_vertices,ier,i,j,iel,ifac,ip,iploc,grpid,idx,fac_idx;
-  int             nitem_node_init;
+  int             nitem_node_init,nitem_max,nkeys,nitem_old;
+  int             *posKey,*old_index1,*old_keys;
   int8_t          update;
 #ifndef NDEBUG
   double dd,dist[3];
@@ -1456,12 +1610,27 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
 
   ier = 0;
 
+  shared_fac    = NULL;
+  new_pos       = NULL;
+  face_vertices = NULL;
+  coor_list     = NULL;
+  posKey        = NULL;
+
   /** Step 1: give a unique position in the internal communicator for each mesh
    * point but don't care about the unicity of the position for a point shared
    * by multiple groups */
   assert ( !parmesh->int_node_comm->nitem );
   nitem_node = 0;
 
+  /* Global keys of the positions (if provided by the groups) */
+  nitem_max = 0;
+  for ( grpid=0; grpid<parmesh->ngrp; ++grpid )
+    nitem_max += 3*parmesh->listgrp[grpid].nitem_int_face_comm;
+
+  PMMG_MALLOC(parmesh,posKey,nitem_max,int,"node keys",goto end);
+  for ( i=0; i<nitem_max; ++i )
+    posKey[i] = PMMG_UNSET;
+
   PMMG_MALLOC(parmesh,shared_fac,parmesh->int_face_comm->nitem,int,
               "Faces shared by 2 groups",goto end);
   for ( i=0; i<parmesh->int_face_comm->nitem; ++i )
@@ -1502,6 +1671,22 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
       ++shared_fac[grp->face2int_face_comm_index2[i]];
     }
 
+    /* Previous node communicator storing the global node keys */
+    old_index1 = grp->node2int_node_comm_index1;
+    old_keys   = grp->node2int_node_comm_index2;
+    nitem_old  = grp->nitem_int_node_comm;
+    grp->node2int_node_comm_index1 = NULL;
+    grp->node2int_node_comm_index2 = NULL;
+
+    if ( old_index1 && old_keys ) {
+      for ( i=0; i<nitem_old; ++i ) {
+        ppt = &mesh->point[old_index1[i]];
+        if ( ppt->tmp >= 0 ) posKey[ppt->tmp] = old_keys[i];
+      }
+    }
+    PMMG_DEL_MEM(parmesh,old_index1,int,"node2int_node_comm_index1");
+    PMMG_DEL_MEM(parmesh,old_keys,int,"node2int_node_comm_index2");
+
     /* Allocations of the node2int_node arrays */
     PMMG_CALLOC(parmesh,grp->node2int_node_comm_index1,nitem_node-first_nitem_node,
                 int,"node2int_node_comm_index1",goto end);
@@ -1525,8 +1710,21 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
     assert ( idx == nitem_node-first_nitem_node && "missing item");
   }
 
+  /** Step 2: if all the positions have a global key, merge the positions with
+   * same key */
+  nkeys = 0;
+  for ( i=0; i<nitem_node; ++i ) {
+    if ( posKey[i] >= 0 ) ++nkeys;
+  }
 
-  /** Step 2: remove some of the multiple positions and pack communicators */
+  if ( nitem_node && nkeys == nitem_node ) {
+    if ( !PMMG_build_intNodeCommFromKeys(parmesh,posKey,&nitem_node) ) goto end;
+    goto nitem_update;
+  }
+
+
+  /** Step 2 bis: otherwise, remove some of the multiple positions through the
+   * shared faces and pack communicators */
   nitem_node_init = nitem_node;
   PMMG_MALLOC(parmesh,new_pos,nitem_node_init,int,"new pos in int_node_comm",goto end);
   PMMG_MALLOC(parmesh,face_vertices,3*parmesh->int_face_comm->nitem,int,
@@ -1788,6 +1986,7 @@ int PMMG_build_intNodeComm( PMMG_pParMesh parmesh ) {
   nitem_node = j;
 
   /** Step 4: Update the number of items in the internal node communicator */
+nitem_update:
   parmesh->int_node_comm->nitem = nitem_node;
 
   /* Success */
@@ -1810,10 +2009,77 @@ end:
   PMMG_DEL_MEM(parmesh,face_vertices,int,"pos of face vertices in int_node_comm");
   PMMG_DEL_MEM(parmesh,shared_fac,int,"Faces shared by 2 groups");
   PMMG_DEL_MEM(parmesh,coor_list,PMMG_coorCell,"node coordinates");
+  PMMG_DEL_MEM(parmesh,posKey,int,"node keys");
 
   return ier;
 }
 
+/**
+ * \struct PMMG_procList
+ *
+ * \brief List of the (rank,position in the internal communicator) couples of
+ * an interface node: slice of the CSR array of couples built by \ref
+ * PMMG_build_completeExtNodeComm.
+ *
+ */
+typedef struct {
+  int nitem; /*!< number of couples */
+  int *item; /*!< first couple of the list (val1 at 2*i, val2 at 2*i+1) */
+} PMMG_procList;
+
+/**
+ * \param a  pointer toward a couple of integers.
+ * \param b  pointer toward a couple of integers.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than 1, 0 if they are
+ * equals.
+ *
+ * Compare 2 (rank,position) couples (lexicographic order).
+ *
+ */
+static
+int PMMG_compare_procCouple (const void * a, const void * b) {
+  const int *c1,*c2;
+
+  c1 = (const int*)a;
+  c2 = (const int*)b;
+
+  if ( c1[0] != c2[0] ) return c1[0] > c2[0] ? 1 : -1;
+  if ( c1[1] != c2[1] ) return c1[1] > c2[1] ? 1 : -1;
+
+  return 0;
+}
+
+/**
+ * \param a  pointer toward a PMMG_procList structure.
+ * \param b  pointer toward a PMMG_procList structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than 1, 0 if they are
+ * equals.
+ *
+ * Compare 2 lists of couples: first on the length, then on the couples (same
+ * order as \ref PMMG_compare_cellLnkdList).
+ *
+ */
+static
+int PMMG_compare_procList (const void * a, const void * b) {
+  const PMMG_procList *list1,*list2;
+  int                 k;
+
+  list1 = (const PMMG_procList*)a;
+  list2 = (const PMMG_procList*)b;
+
+  if ( list1->nitem > list2->nitem ) return 1;
+  if ( list1->nitem < list2->nitem ) return -1;
+
+  for ( k=0; k<2*list1->nitem; ++k ) {
+    if ( list1->item[k] > list2->item[k] ) return 1;
+    if ( list1->item[k] < list2->item[k] ) return -1;
+  }
+
+  return 0;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure
  *
@@ -1822,15 +2088,22 @@ end:
  * Complete the external communicators by travelling through the processors and
  * faces to detect all the processors to which each node belongs.
  *
+ * The lists of (rank,position) couples of the nodes are stored in a CSR array
+ * (the couples of the node \a idx of the internal communicator are stored
+ * between \a proc_idx[idx] and \a proc_idx[idx+1]) and kept sorted. At each
+ * round, the received lists are appended to the list of each node in a new
+ * CSR array, then each list is sorted and its duplicates are removed.
+ *
  */
 int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
   PMMG_pExt_comm    ext_node_comm,*comm_ptr;
   PMMG_pInt_comm    int_node_comm;
-  PMMG_cellLnkdList **proclists,list;
-  int               *intvalues,nitem,nproclists,ier,ier2,k,i,j,idx,pos,rank,color;
+  PMMG_procList     *proclists;
+  int               *intvalues,nitem,nproclists,ier,k,i,j,idx,pos,rank,color;
   int               *itosend,*itorecv,*i2send_size,*i2recv_size,nitem2comm;
   int               *nitem_ext_comm,next_comm,val1_i,val2_i,val1_j,val2_j;
-  int               alloc_size;
+  int               *proc_idx,*proc_val,*new_idx,*new_val,*tmp;
+  int               alloc_size,val_size,new_size,nval,nold,start,end,ncpl;
   int8_t            glob_update,loc_update;
   MPI_Request       *request;
   MPI_Status        *status;
@@ -1848,7 +2121,12 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
   i2send_size     = NULL;
   i2recv_size     = NULL;
   nitem_ext_comm  = NULL;
-  list.item       = NULL;
+  proc_idx        = NULL;
+  proc_val        = NULL;
+  new_idx         = NULL;
+  new_val         = NULL;
+  val_size        = 0;
+  new_size        = 0;
 
   PMMG_CALLOC(parmesh,int_node_comm->intvalues,nitem,int,"node communicator",
     return 0);
@@ -1858,8 +2136,8 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
    * initialization to 0.  */
   for ( k=0; k<nitem; ++k ) intvalues[k] = 0;
 
-  PMMG_CALLOC(parmesh,proclists,nitem,PMMG_cellLnkdList*,"array of linked lists",
-              goto end);
+  PMMG_CALLOC(parmesh,proc_idx,nitem+1,int,"proc lists index",goto end);
+  PMMG_CALLOC(parmesh,new_idx,nitem+1,int,"proc lists index",goto end);
 
   /* Reallocation of the list of external comms at maximal size (nprocs) to
    * avoid tricky treatment when filling it.*/
@@ -1897,19 +2175,20 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
 
     for ( i=0; i<ext_node_comm->nitem; ++i ) {
       idx = ext_node_comm->int_comm_index[i];
-
-      if ( intvalues[idx] ) continue;
-
-      PMMG_CALLOC(parmesh,proclists[idx],1,PMMG_cellLnkdList,"linked list pointer",
-                  goto end);
-      if ( !PMMG_cellLnkdListNew(parmesh,proclists[idx],idx,PMMG_LISTSIZE) ) goto end;
-
-      if ( !PMMG_add_cell2lnkdList( parmesh,proclists[idx],rank,idx ) )
-        goto end;
-
       intvalues[idx] = 1;
     }
   }
+  for ( idx=0; idx<nitem; ++idx ) {
+    proc_idx[idx+1] = proc_idx[idx] + intvalues[idx];
+  }
+  val_size = 2*proc_idx[nitem];
+  PMMG_MALLOC(parmesh,proc_val,val_size,int,"proc lists",goto end);
+  for ( idx=0; idx<nitem; ++idx ) {
+    if ( !intvalues[idx] ) continue;
+    proc_val[2*proc_idx[idx]  ] = rank;
+    proc_val[2*proc_idx[idx]+1] = idx;
+  }
+
   /* Fill the missing pointer toward the empty external communicators */
   for ( k=0; k<parmesh->nprocs; ++k ) {
     if ( !comm_ptr[k] ) {
@@ -1931,8 +2210,6 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
   PMMG_CALLOC(parmesh,i2send_size,alloc_size,int,"size of the i2send array",goto end);
   PMMG_CALLOC(parmesh,i2recv_size,alloc_size,int,"size of the i2recv array",goto end);
 
-  if ( !PMMG_cellLnkdListNew(parmesh,&list,0,PMMG_LISTSIZE) ) goto end;
-
   do {
     glob_update = loc_update = 0;
 
@@ -1943,14 +2220,14 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
       ext_node_comm = &parmesh->ext_node_comm[k];
 
       /* Computation of the number of data to send to the other procs (we want
-       * to send the the size of the linked list and the val1 and val2 fields of
-       * each cell ) */
+       * to send the the size of the list and the val1 and val2 fields of
+       * each couple ) */
       nitem2comm = 0;
       if ( !ext_node_comm->nitem ) continue;
 
       for ( i=0; i<ext_node_comm->nitem; ++i ) {
         idx         = ext_node_comm->int_comm_index[i];
-        nitem2comm += proclists[idx]->nitem*2+1;
+        nitem2comm += 2*(proc_idx[idx+1]-proc_idx[idx])+1;
       }
 
       if ( i2send_size[k] < nitem2comm ) {
@@ -1959,13 +2236,16 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
         i2send_size[k] = nitem2comm;
       }
 
-      /* Filling of the array to send */
+      /* Filling of the array to send: copy of the slice of each node */
       pos     = 0;
       itosend = ext_node_comm->itosend;
       color   = ext_node_comm->color_out;
       for ( i=0; i<ext_node_comm->nitem; ++i ) {
         idx  = ext_node_comm->int_comm_index[i];
-        pos += PMMG_packInArray_cellLnkdList(proclists[idx],&itosend[pos]);
+        ncpl = proc_idx[idx+1]-proc_idx[idx];
+        itosend[pos++] = ncpl;
+        memcpy(&itosend[pos],&proc_val[2*proc_idx[idx]],2*ncpl*sizeof(int));
+        pos += 2*ncpl;
       }
       assert ( pos==nitem2comm );
 
@@ -1974,7 +2254,12 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
                            &request[color]),goto end );
     }
 
-    /** Recv the list of procs to which belong each point of the communicator */
+    /** Recv the list of procs to which belong each point of the communicator
+     * and count the maximal size of the merged lists */
+    for ( idx=0; idx<nitem; ++idx ) {
+      intvalues[idx] = proc_idx[idx+1]-proc_idx[idx];
+    }
+
     for ( k=0; k<parmesh->next_node_comm; ++k ) {
       ext_node_comm = &parmesh->ext_node_comm[k];
 
@@ -1993,7 +2278,6 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
       }
 
       if ( nitem2comm ) {
-
         itorecv       = ext_node_comm->itorecv;
         MPI_CHECK( MPI_Recv(itorecv,nitem2comm,MPI_INT,color,
                             MPI_COMMUNICATORS_NODE_TAG,parmesh->comm,
@@ -2003,20 +2287,84 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
         for ( i=0; i<ext_node_comm->nitem; ++i ) {
           idx  = ext_node_comm->int_comm_index[i];
           assert ( idx>=0 );
+          intvalues[idx] += itorecv[pos];
+          pos            += 2*itorecv[pos]+1;
+        }
+        assert ( pos==nitem2comm );
+      }
+    }
 
-          PMMG_reset_cellLnkdList( parmesh,&list );
-          ier2 = PMMG_unpackArray_inCellLnkdList(parmesh,&list,&itorecv[pos]);
+    /** Merge the received lists: concatenation of the current list of each
+     * node and of the lists received for this node in a new CSR array... */
+    new_idx[0] = 0;
+    for ( idx=0; idx<nitem; ++idx ) {
+      new_idx[idx+1] = new_idx[idx] + intvalues[idx];
+    }
+    if ( new_size < 2*new_idx[nitem] ) {
+      PMMG_REALLOC(parmesh,new_val,2*new_idx[nitem],new_size,int,
+                   "proc lists",goto end);
+      new_size = 2*new_idx[nitem];
+    }
 
-          if ( ier2 < 0 ) goto end;
-          pos += ier2;
+    for ( idx=0; idx<nitem; ++idx ) {
+      nval = 2*(proc_idx[idx+1]-proc_idx[idx]);
+      if ( nval ) {
+        memcpy(&new_val[2*new_idx[idx]],&proc_val[2*proc_idx[idx]],nval*sizeof(int));
+      }
+      intvalues[idx] = 2*new_idx[idx] + nval;
+    }
 
-          ier2 = PMMG_merge_cellLnkdList(parmesh,proclists[idx],&list);
-          if ( !ier2 ) goto end;
+    for ( k=0; k<parmesh->next_node_comm; ++k ) {
+      ext_node_comm = &parmesh->ext_node_comm[k];
 
-          loc_update |= (ier2%2);
+      if ( !ext_node_comm->nitem ) continue;
+
+      pos     = 0;
+      itorecv = ext_node_comm->itorecv;
+      for ( i=0; i<ext_node_comm->nitem; ++i ) {
+        idx  = ext_node_comm->int_comm_index[i];
+        nval = 2*itorecv[pos++];
+        memcpy(&new_val[intvalues[idx]],&itorecv[pos],nval*sizeof(int));
+        intvalues[idx] += nval;
+        pos            += nval;
+      }
+    }
+
+    /* ... then sort each list, remove the duplicated couples and pack the CSR
+     * array (in place as the packed lists never overlap the next ones). */
+    pos   = 0;
+    start = 0;
+    for ( idx=0; idx<nitem; ++idx ) {
+      end  = new_idx[idx+1];
+      nold = proc_idx[idx+1]-proc_idx[idx];
+
+      new_idx[idx] = pos;
+      if ( end > start ) {
+        qsort(&new_val[2*start],end-start,2*sizeof(int),PMMG_compare_procCouple);
+
+        new_val[2*pos  ] = new_val[2*start  ];
+        new_val[2*pos+1] = new_val[2*start+1];
+        ++pos;
+        for ( i=start+1; i<end; ++i ) {
+          if ( PMMG_compare_procCouple(&new_val[2*i],&new_val[2*(pos-1)]) ) {
+            new_val[2*pos  ] = new_val[2*i  ];
+            new_val[2*pos+1] = new_val[2*i+1];
+            ++pos;
+          }
         }
       }
+      /* The old list is included in the new one */
+      assert ( pos-new_idx[idx] >= nold );
+      if ( pos-new_idx[idx] > nold ) loc_update = 1;
+
+      start = end;
     }
+    new_idx[nitem] = pos;
+
+    /* Swap the old and new CSR arrays */
+    tmp = proc_idx; proc_idx = new_idx; new_idx = tmp;
+    tmp = proc_val; proc_val = new_val; new_val = tmp;
+    k = val_size; val_size = new_size; new_size = k;
 
     MPI_CHECK( MPI_Waitall(parmesh->next_node_comm,request,status), goto end );
     MPI_CHECK( MPI_Allreduce(&loc_update,&glob_update,1,MPI_INT8_T,MPI_LOR,
@@ -2030,23 +2378,26 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
               "number of items in each external communicator",goto end);
 
   /* Remove the empty proc lists */
+  PMMG_MALLOC(parmesh,proclists,nitem,PMMG_procList,"array of proc lists",goto end);
   nproclists = 0;
   for ( i=0; i<nitem; ++i ) {
-    if ( intvalues[i] )
-      proclists[nproclists++] = proclists[i];
+    if ( proc_idx[i+1] > proc_idx[i] ) {
+      proclists[nproclists].nitem  = proc_idx[i+1]-proc_idx[i];
+      proclists[nproclists++].item = &proc_val[2*proc_idx[i]];
+    }
   }
 
   /* Sort the list of procs to which each node belong to ensure that we will
    * build the external communicators in the same order on both processors
    * involved in an external comm */
-  qsort(proclists,nproclists,sizeof(PMMG_cellLnkdList*),PMMG_compare_cellLnkdList);
+  qsort(proclists,nproclists,sizeof(PMMG_procList),PMMG_compare_procList);
 
   /* Remove the non unique paths */
   if ( nproclists ) {
     idx = 0;
     for ( i=1; i<nproclists; ++i ) {
-      assert ( proclists[i]->nitem );
-      if ( PMMG_compare_cellLnkdList(&proclists[i],&proclists[idx]) ) {
+      assert ( proclists[i].nitem );
+      if ( PMMG_compare_procList(&proclists[i],&proclists[idx]) ) {
         ++idx;
         if ( idx != i ) {
           proclists[idx] = proclists[i];
@@ -2059,13 +2410,13 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
   /* Double loop over the list of procs to which belong each point to add the
    * couples to the suitable external communicators */
   for ( k=0; k<nproclists; ++k ) {
-    for ( i=0; i<proclists[k]->nitem; ++i ) {
-      val1_i = proclists[k]->item[i].val1;
-      val2_i = proclists[k]->item[i].val2;
+    for ( i=0; i<proclists[k].nitem; ++i ) {
+      val1_i = proclists[k].item[2*i];
+      val2_i = proclists[k].item[2*i+1];
 
-      for ( j=i+1; j<proclists[k]->nitem; ++j ) {
-        val1_j = proclists[k]->item[j].val1;
-        val2_j = proclists[k]->item[j].val2;
+      for ( j=i+1; j<proclists[k].nitem; ++j ) {
+        val1_j = proclists[k].item[2*j];
+        val2_j = proclists[k].item[2*j+1];
 
         assert ( val1_i != val1_j );
 
@@ -2135,13 +2486,11 @@ int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh ) {
 end:
   PMMG_DEL_MEM(parmesh,int_node_comm->intvalues,int,"node communicator");
 
-  if ( proclists ) {
-    for ( k=0; k<nproclists; ++k ) {
-      PMMG_DEL_MEM(parmesh,proclists[k]->item,PMMG_lnkdCell,"linked list array");
-      PMMG_DEL_MEM(parmesh,proclists[k],PMMG_lnkdList,"linked list pointer");
-    }
-    PMMG_DEL_MEM(parmesh,proclists,PMMG_lnkdList*,"array of linked lists");
-  }
+  PMMG_DEL_MEM(parmesh,proclists,PMMG_procList,"array of proc lists");
+  PMMG_DEL_MEM(parmesh,proc_idx,int,"proc lists index");
+  PMMG_DEL_MEM(parmesh,new_idx,int,"proc lists index");
+  PMMG_DEL_MEM(parmesh,proc_val,int,"proc lists");
+  PMMG_DEL_MEM(parmesh,new_val,int,"proc lists");
   PMMG_DEL_MEM(parmesh,comm_ptr,PMMG_pExt_comm,
               "array of pointers toward the external communicators");
 
@@ -2163,7 +2512,759 @@ end:
   PMMG_DEL_MEM(parmesh,nitem_ext_comm,int,
                "number of items in each external communicator");
 
-  PMMG_DEL_MEM(parmesh,list.item,PMMG_lnkdCell,"linked list array");
+  return ier;
+}
+
+/**
+ * \def PMMG_RDV_NBITS
+ *
+ * Number of bits used to store the cell index in each direction of the
+ * rendezvous grid
+ *
+ */
+#define PMMG_RDV_NBITS 20
+
+/**
+ * \struct PMMG_rdvCell
+ *
+ * \brief Interface node sent to a rendezvous processor: scaled coordinates of
+ * the node, key of the bounding box cell for which it is sent, sending rank and
+ * position of the node in the internal communicator of the sending rank.
+ *
+ */
+typedef struct {
+  double   c[3]; /*!< scaled point coordinates */
+  uint64_t cell; /*!< key of the rendezvous cell */
+  int      rank; /*!< sending rank */
+  int      idx;  /*!< position in the internal node communicator of rank */
+} PMMG_rdvCell;
+
+/**
+ * \struct PMMG_rdvItem
+ *
+ * \brief Sharer of a node received back from a rendezvous processor.
+ *
+ */
+typedef struct {
+  int      rdv;   /*!< rendezvous rank that has matched the node */
+  int      key;   /*!< key of the node on the rendezvous rank */
+  int      other; /*!< rank that shares the node */
+  int      idx;   /*!< position in the internal node communicator */
+} PMMG_rdvItem;
+
+/**
+ * \param ix index of the cell along the x direction
+ * \param iy index of the cell along the y direction
+ * \param iz index of the cell along the z direction
+ *
+ * \return the key of the cell.
+ */
+static inline
+uint64_t PMMG_rdv_cellKey( uint64_t ix,uint64_t iy,uint64_t iz ) {
+  return ix | (iy << PMMG_RDV_NBITS) | (iz << (2*PMMG_RDV_NBITS));
+}
+
+/**
+ * \param key key of a cell
+ * \param nprocs number of procs
+ *
+ * \return the rendezvous rank of the cell.
+ *
+ * Mix the bits of the key (splitmix64 finalizer) so that neighbouring cells
+ * are spread over the processors.
+ */
+static inline
+int PMMG_rdv_rank( uint64_t key,int nprocs ) {
+  key ^= key >> 30;
+  key *= 0xbf58476d1ce4e5b9ULL;
+  key ^= key >> 27;
+  key *= 0x94d049bb133111ebULL;
+  key ^= key >> 31;
+
+  return (int)(key % (uint64_t)nprocs);
+}
+
+/**
+ * \param c scaled coordinates of the node
+ * \param cell computed list of the keys of the cells to which the node is sent
+ *
+ * \return the number of cells in which the node must be sent (between 1 and 8).
+ *
+ * Compute the cell of the node in the rendezvous grid and the neighbouring
+ * cells that are closer than the coordinate tolerance, so the copies of a node
+ * that are slightly moved by the scaling operations always meet in the cell
+ * that contains the copy of lowest cell key.
+ *
+ */
+static inline
+int PMMG_rdv_cells( double c[3],uint64_t cell[8] ) {
+  const uint64_t nmax = ((uint64_t)1) << PMMG_RDV_NBITS;
+  uint64_t       ic[3][2];
+  double         s,eps;
+  int            nc[3],i,j,k,ncell;
+
+  eps = PMMG_EPSCOOR * (double)nmax;
+
+  for ( i=0; i<3; ++i ) {
+    s = c[i] * (double)nmax;
+    if ( s < 0. ) s = 0.;
+    ic[i][0] = (uint64_t)s;
+    if ( ic[i][0] >= nmax ) ic[i][0] = nmax-1;
+    nc[i] = 1;
+
+    if ( (s - (double)ic[i][0] < eps) && ic[i][0] ) {
+      ic[i][nc[i]++] = ic[i][0]-1;
+    }
+    else if ( ((double)(ic[i][0]+1) - s < eps) && (ic[i][0]+1 < nmax) ) {
+      ic[i][nc[i]++] = ic[i][0]+1;
+    }
+  }
+
+  ncell = 0;
+  for ( i=0; i<nc[0]; ++i )
+    for ( j=0; j<nc[1]; ++j )
+      for ( k=0; k<nc[2]; ++k )
+        cell[ncell++] = PMMG_rdv_cellKey(ic[0][i],ic[1][j],ic[2][k]);
+
+  return ncell;
+}
+
+/**
+ * \param a  pointer toward a PMMG_rdvCell structure.
+ * \param b  pointer toward a PMMG_rdvCell structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than 1, 0 if they are
+ * equals.
+ *
+ * Compare 2 rendezvous cells: first on the cell key, then on the coordinates
+ * (with the same tolerance as \ref PMMG_compare_coorCell), then on the sending
+ * rank and on the communicator position.
+ *
+ */
+static
+int PMMG_compare_rdvCell (const void * a, const void * b) {
+  PMMG_rdvCell *cell1,*cell2;
+  double       dist,tol;
+  int          k;
+
+  cell1 = (PMMG_rdvCell*)a;
+  cell2 = (PMMG_rdvCell*)b;
+
+  if ( cell1->cell > cell2->cell ) return 1;
+  if ( cell1->cell < cell2->cell ) return -1;
+
+  tol  = 50.0;
+  for ( k=0; k<3; ++k ) {
+    dist = cell1->c[k]-cell2->c[k];
+
+    if ( dist >  MMG5_EPSOK*tol ) return 1;
+    if ( dist < -MMG5_EPSOK*tol ) return -1;
+  }
+
+  if ( cell1->rank > cell2->rank ) return 1;
+  if ( cell1->rank < cell2->rank ) return -1;
+
+  if ( cell1->idx > cell2->idx ) return 1;
+  if ( cell1->idx < cell2->idx ) return -1;
+
+  return 0;
+}
+
+/**
+ * \param cell1  pointer toward a PMMG_rdvCell structure.
+ * \param cell2  pointer toward a PMMG_rdvCell structure.
+ *
+ * \return 1 if the cells store the same point (up to the tolerance of
+ * \ref PMMG_compare_rdvCell), 0 otherwise.
+ *
+ */
+static inline
+int PMMG_rdv_sameCoor( PMMG_rdvCell *cell1,PMMG_rdvCell *cell2 ) {
+  int k;
+
+  for ( k=0; k<3; ++k ) {
+    if ( fabs(cell1->c[k]-cell2->c[k]) > 50.*MMG5_EPSOK ) return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param a  pointer toward a PMMG_rdvItem structure.
+ * \param b  pointer toward a PMMG_rdvItem structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than 1, 0 if they are
+ * equals.
+ *
+ * Compare 2 sharers: first on the sharing rank, then on the (rendezvous rank,
+ * key) pair that is the same on all the procs sharing the node.
+ *
+ */
+static
+int PMMG_compare_rdvItem (const void * a, const void * b) {
+  PMMG_rdvItem *item1,*item2;
+
+  item1 = (PMMG_rdvItem*)a;
+  item2 = (PMMG_rdvItem*)b;
+
+  if ( item1->other != item2->other ) return item1->other > item2->other ? 1 : -1;
+  if ( item1->rdv   != item2->rdv   ) return item1->rdv   > item2->rdv   ? 1 : -1;
+  if ( item1->key   != item2->key   ) return item1->key   > item2->key   ? 1 : -1;
+
+  return 0;
+}
+
+/**
+ * \param mpi_rdvCell new MPI data type
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Create an MPI data type for the \a PMMG_rdvCell structure so the cells are
+ * counted by items (and not by bytes) in the rendezvous exchanges.
+ *
+ */
+static
+int PMMG_create_MPI_rdvCell( MPI_Datatype *mpi_rdvCell ) {
+  PMMG_rdvCell cell;
+  int          blck_lengths[4] = {3, 1, 1, 1};
+  MPI_Aint     displs[4],lb;
+  MPI_Datatype mpi_noextent;
+  MPI_Datatype types[4] = {MPI_DOUBLE,MPI_UINT64_T,MPI_INT,MPI_INT};
+  int          i;
+
+  MPI_CHECK( MPI_Get_address(&cell,        &lb),return 0 );
+  MPI_CHECK( MPI_Get_address(&cell.c[0],   &displs[0]),return 0 );
+  MPI_CHECK( MPI_Get_address(&cell.cell,   &displs[1]),return 0 );
+  MPI_CHECK( MPI_Get_address(&cell.rank,   &displs[2]),return 0 );
+  MPI_CHECK( MPI_Get_address(&cell.idx,    &displs[3]),return 0 );
+
+  for ( i=0; i<4; ++i )
+    displs[i] -= lb;
+
+  MPI_CHECK( MPI_Type_create_struct(4,blck_lengths,displs,types,&mpi_noextent),
+             return 0 );
+  MPI_CHECK( MPI_Type_create_resized(mpi_noextent,0,sizeof(PMMG_rdvCell),
+                                     mpi_rdvCell),
+             MPI_Type_free(&mpi_noextent);return 0 );
+  MPI_Type_free(&mpi_noextent);
+
+  MPI_CHECK( MPI_Type_commit(mpi_rdvCell),return 0 );
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward a parmesh structure
+ * \param sbuf buffer of the items to send (sorted by destination)
+ * \param send_cnt number of items to send to each proc
+ * \param send_displ position of the first item to send to each proc
+ * \param dtype MPI data type of an item
+ * \param size size of an item
+ * \param tag MPI tag of the messages
+ * \param rbuf pointer toward the allocated buffer of the received items
+ * \param nrecv pointer toward the number of received items
+ * \param recv_rank pointer toward the allocated array of the message senders
+ * \param recv_displ pointer toward the allocated array of the positions of the
+ * first item of each message in \a rbuf (of size \a nmsg+1)
+ * \param nmsg pointer toward the number of received messages
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Sparse exchange of the items of a rendezvous round: the items are sent only
+ * to the procs with a non-zero count and received by probing the incoming
+ * messages until every proc has completed its sends (same non-blocking
+ * consensus as in \ref PMMG_migrate_grps), so neither the counts nor the
+ * buffers depend on the number of procs.
+ *
+ * \remark the program is aborted if a received message cannot be stored: the
+ * other procs would otherwise wait forever for the message to be received.
+ *
+ */
+static
+int PMMG_rdv_exchange( PMMG_pParMesh parmesh,void *sbuf,int *send_cnt,
+                       int *send_displ,MPI_Datatype dtype,size_t size,int tag,
+                       void **rbuf,int *nrecv,int **recv_rank,int **recv_displ,
+                       int *nmsg ) {
+  MPI_Request    *request,barrier;
+  MPI_Status     status;
+  char           *buf;
+  int            *src,*displ,nreq,nsrc,maxsrc,count,flag,done,posted,nomem;
+  int            ier,k;
+  size_t         nitem,maxitem,newmax;
+
+  const MPI_Comm comm = parmesh->comm;
+
+  ier     = 1;
+  request = NULL;
+  buf     = NULL;
+  src     = NULL;
+  displ   = NULL;
+  nsrc    = maxsrc  = 0;
+  nitem   = maxitem = 0;
+
+  nreq = 0;
+  for ( k=0; k<parmesh->nprocs; ++k ) {
+    if ( send_cnt[k] ) ++nreq;
+  }
+
+  nomem = 0;
+  PMMG_MALLOC(parmesh,request,nreq+1,MPI_Request,"request_tab",nomem = 1);
+  PMMG_MALLOC(parmesh,displ,1,int,"recv displacements",nomem = 1);
+  maxsrc = 1;
+  if ( nomem ) {
+    fprintf(stderr,"\n  ## Error: %s: rank %d: unable to exchange the"
+            " rendezvous items.\n",__func__,parmesh->myrank);
+    MPI_Abort(comm,PMMG_STRONGFAILURE);
+  }
+
+  /* A failed send leaves its request unset: the tests need valid requests */
+  for ( k=0; k<=nreq; ++k ) {
+    request[k] = MPI_REQUEST_NULL;
+  }
+
+  nreq = 0;
+  for ( k=0; k<parmesh->nprocs; ++k ) {
+    if ( !send_cnt[k] ) continue;
+    MPI_CHECK( MPI_Issend((char*)sbuf+(size_t)send_displ[k]*size,send_cnt[k],
+                          dtype,k,tag,comm,&request[nreq]), ier = 0 );
+    ++nreq;
+  }
+
+  posted = 0;
+  done   = 0;
+  while ( !done ) {
+    MPI_CHECK( MPI_Iprobe(MPI_ANY_SOURCE,tag,comm,&flag,&status), ier = 0 );
+
+    if ( flag ) {
+      MPI_CHECK( MPI_Get_count(&status,dtype,&count), ier = 0 );
+
+      nomem = 0;
+      if ( nsrc+1 >= maxsrc ) {
+        k = 2*maxsrc;
+        PMMG_REALLOC(parmesh,src,k,maxsrc-1,int,"recv ranks",nomem = 1);
+        PMMG_REALLOC(parmesh,displ,k+1,maxsrc,int,"recv displacements",
+                     nomem = 1);
+        maxsrc = k+1;
+      }
+      if ( nitem+count > maxitem ) {
+        newmax = MG_MAX(2*maxitem,nitem+count);
+        PMMG_REALLOC(parmesh,buf,newmax*size,maxitem*size,char,"recv buffer",
+                     nomem = 1);
+        maxitem = newmax;
+      }
+      if ( nomem ) {
+        fprintf(stderr,"\n  ## Error: %s: rank %d: unable to receive the"
+                " rendezvous items.\n",__func__,parmesh->myrank);
+        MPI_Abort(comm,PMMG_STRONGFAILURE);
+      }
+
+      MPI_CHECK( MPI_Recv(buf+nitem*size,count,dtype,status.MPI_SOURCE,tag,
+                          comm,MPI_STATUS_IGNORE), ier = 0 );
+      src[nsrc]   = status.MPI_SOURCE;
+      displ[nsrc] = (int)nitem;
+      nitem      += count;
+      ++nsrc;
+    }
+
+    if ( !posted ) {
+      MPI_CHECK( MPI_Testall(nreq,request,&flag,MPI_STATUSES_IGNORE), ier = 0 );
+      if ( flag ) {
+        MPI_CHECK( MPI_Ibarrier(comm,&barrier), ier = 0 );
+        posted = 1;
+      }
+    }
+    else {
+      MPI_CHECK( MPI_Test(&barrier,&done,MPI_STATUS_IGNORE), ier = 0 );
+    }
+  }
+  displ[nsrc] = (int)nitem;
+
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"request_tab");
+
+  *rbuf       = buf;
+  *nrecv      = (int)nitem;
+  *recv_rank  = src;
+  *recv_displ = displ;
+  *nmsg       = nsrc;
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward a parmesh structure
+ *
+ * \return 1 if success, 0 if fail (in this case the external node communicators
+ * are left untouched).
+ *
+ * Complete the external node communicators in a fixed number of communication
+ * rounds using rendezvous processors:
+ *   1. each interface node is sent to the rendezvous rank of its cell in a
+ *      regular grid of the global bounding box of the interface nodes;
+ *   2. the rendezvous rank matches the copies of each node and sends back to
+ *      each sharer the complete list of the procs sharing the node, along with
+ *      a key that is the same for all the sharers.
+ * Both rounds are sparse exchanges of typed items (see \ref PMMG_rdv_exchange).
+ *
+ * The external communicators are then filled by sorting the nodes on their
+ * keys, which gives the same node ordering on both sides of each
+ * communicator. The result is checked against the simple external
+ * communicators: if a node is missing on any proc (nodes matched by
+ * coordinates), the function fails on all the procs and the caller must fall
+ * back on \ref PMMG_build_completeExtNodeComm.
+ *
+ */
+int PMMG_build_completeExtNodeComm_rdv( PMMG_pParMesh parmesh ) {
+  PMMG_pGrp        grp;
+  MMG5_pMesh       mesh;
+  PMMG_pInt_comm   int_node_comm;
+  PMMG_pExt_comm   ext_node_comm,new_ext_comm;
+  PMMG_rdvCell     *cell2send,*cell2recv;
+  PMMG_rdvItem     *item;
+  uint64_t         cell[8],home;
+  double           *coor,bb_min[3],bb_max[3],delta,dd;
+  MPI_Datatype     mpi_rdvCell,mpi_triple;
+  void             *rbuf;
+  int              *shared,*stamp,*iproc2comm,*val2send,*val2recv;
+  int              *send_cnt,*send_displ,*recv_rank,*recv_displ,*pos;
+  int              nitem,nsend,nrecv,nmsg,nval2send,nitem_rdv;
+  int              nprocs,rank,next_comm,nkey,nerr,ier,ier_glob;
+  int              i,j,k,l,m,ip,idx,grpid,ncell,first,dst,color;
+
+  ier        = 0;
+  nprocs     = parmesh->nprocs;
+  rank       = parmesh->myrank;
+
+  coor       = NULL;
+  shared     = NULL;
+  stamp      = NULL;
+  iproc2comm = NULL;
+  cell2send  = NULL;
+  cell2recv  = NULL;
+  val2send   = NULL;
+  val2recv   = NULL;
+  item       = NULL;
+  send_cnt   = send_displ = NULL;
+  recv_rank  = recv_displ = NULL;
+  pos        = NULL;
+  mpi_rdvCell = mpi_triple = MPI_DATATYPE_NULL;
+  new_ext_comm = NULL;
+  nitem_rdv  = 0;
+  next_comm  = 0;
+
+  int_node_comm = parmesh->int_node_comm;
+  nitem         = int_node_comm->nitem;
+
+  /** Step 0: mark the nodes of the simple external communicators and store
+   * their coordinates */
+  PMMG_CALLOC(parmesh,shared,nitem+1,int,"shared nodes",goto step1);
+  PMMG_MALLOC(parmesh,coor,3*nitem+1,double,"node coordinates",goto step1);
+  PMMG_CALLOC(parmesh,send_cnt,nprocs,int,"send counts",goto step1);
+  PMMG_CALLOC(parmesh,send_displ,nprocs+1,int,"send displacements",goto step1);
+  if ( !PMMG_create_MPI_rdvCell(&mpi_rdvCell) ) goto step1;
+  MPI_CHECK( MPI_Type_contiguous(3,MPI_INT,&mpi_triple), goto step1 );
+  MPI_CHECK( MPI_Type_commit(&mpi_triple), goto step1 );
+
+  for ( k=0; k<parmesh->next_node_comm; ++k ) {
+    ext_node_comm = &parmesh->ext_node_comm[k];
+    for ( i=0; i<ext_node_comm->nitem; ++i ) {
+      shared[ext_node_comm->int_comm_index[i]] = 1;
+    }
+  }
+
+  for ( grpid=0; grpid<parmesh->ngrp; ++grpid ) {
+    grp  = &parmesh->listgrp[grpid];
+    mesh = grp->mesh;
+    for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+      ip  = grp->node2int_node_comm_index1[i];
+      idx = grp->node2int_node_comm_index2[i];
+      memcpy(&coor[3*idx],mesh->point[ip].c,3*sizeof(double));
+    }
+  }
+
+  for ( j=0; j<3; ++j ) {
+    bb_min[j] =  DBL_MAX;
+    bb_max[j] = -DBL_MAX;
+  }
+  for ( idx=0; idx<nitem; ++idx ) {
+    if ( !shared[idx] ) continue;
+    for ( j=0; j<3; ++j ) {
+      bb_min[j] = MG_MIN(bb_min[j],coor[3*idx+j]);
+      bb_max[j] = MG_MAX(bb_max[j],coor[3*idx+j]);
+    }
+  }
+  ier = 1;
+
+step1:
+  /** Step 1: send the interface nodes to their rendezvous procs */
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) goto end;
+  ier = 0;
+
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,bb_min,3,MPI_DOUBLE,MPI_MIN,parmesh->comm),
+             goto end );
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,bb_max,3,MPI_DOUBLE,MPI_MAX,parmesh->comm),
+             goto end );
+
+  delta = 0.;
+  for ( j=0; j<3; ++j ) {
+    delta = MG_MAX(delta,bb_max[j]-bb_min[j]);
+  }
+  dd = ( delta > 0. ) ? 1./delta : 1.;
+
+  for ( idx=0; idx<nitem; ++idx ) {
+    if ( !shared[idx] ) continue;
+    for ( j=0; j<3; ++j ) {
+      coor[3*idx+j] = dd*(coor[3*idx+j]-bb_min[j]);
+    }
+    ncell = PMMG_rdv_cells(&coor[3*idx],cell);
+    for ( l=0; l<ncell; ++l ) {
+      ++send_cnt[PMMG_rdv_rank(cell[l],nprocs)];
+    }
+  }
+
+  for ( k=0; k<nprocs; ++k ) {
+    send_displ[k+1] = send_displ[k] + send_cnt[k];
+  }
+  nsend = send_displ[nprocs];
+
+  PMMG_MALLOC(parmesh,cell2send,nsend+1,PMMG_rdvCell,"cells to send",goto step2);
+  PMMG_CALLOC(parmesh,pos,nprocs,int,"position in send buffer",goto step2);
+
+  for ( idx=0; idx<nitem; ++idx ) {
+    if ( !shared[idx] ) continue;
+    ncell = PMMG_rdv_cells(&coor[3*idx],cell);
+    for ( l=0; l<ncell; ++l ) {
+      dst = PMMG_rdv_rank(cell[l],nprocs);
+      i   = send_displ[dst] + pos[dst]++;
+      memcpy(cell2send[i].c,&coor[3*idx],3*sizeof(double));
+      cell2send[i].cell = cell[l];
+      cell2send[i].rank = rank;
+      cell2send[i].idx  = idx;
+    }
+  }
+  ier = 1;
+
+step2:
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) goto end;
+
+  ier = PMMG_rdv_exchange(parmesh,cell2send,send_cnt,send_displ,mpi_rdvCell,
+                          sizeof(PMMG_rdvCell),MPI_COMPLETENODECOMM_TAG,&rbuf,
+                          &nrecv,&recv_rank,&recv_displ,&nmsg);
+  cell2recv = (PMMG_rdvCell*)rbuf;
+  PMMG_DEL_MEM(parmesh,recv_rank,int,"recv ranks");
+  PMMG_DEL_MEM(parmesh,recv_displ,int,"recv displacements");
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) goto end;
+  ier = 0;
+
+  PMMG_DEL_MEM(parmesh,cell2send,PMMG_rdvCell,"cells to send");
+
+  /** Step 2: match the copies of the nodes on the rendezvous procs. A node is
+   * treated only in the cell of lowest key among the cells of its copies, so
+   * each node gets a unique key. */
+  qsort(cell2recv,nrecv,sizeof(PMMG_rdvCell),PMMG_compare_rdvCell);
+
+  for ( k=0; k<nprocs; ++k ) {
+    send_cnt[k] = 0;
+  }
+
+  /* First pass to count the values to send back, second pass to fill them */
+  nkey = nerr = 0;
+  for ( l=0; l<2; ++l ) {
+    first = 0;
+    while ( first < nrecv ) {
+      /* Find the copies of the node */
+      for ( m=first+1; m<nrecv; ++m ) {
+        if ( cell2recv[m].cell != cell2recv[first].cell ) break;
+        if ( !PMMG_rdv_sameCoor(&cell2recv[m],&cell2recv[first]) ) break;
+      }
+
+      /* Home cell of the node (the first listed cell is the cell that contains
+       * the point) */
+      home = cell2recv[first].cell;
+      for ( i=first; i<m; ++i ) {
+        PMMG_rdv_cells(cell2recv[i].c,cell);
+        home = MG_MIN(home,cell[0]);
+      }
+
+      if ( home == cell2recv[first].cell ) {
+        /* A lonely node or two nodes of the same proc that match: we cannot
+         * conclude */
+        if ( m-first < 2 ) ++nerr;
+        for ( i=first+1; i<m; ++i ) {
+          if ( cell2recv[i].rank == cell2recv[i-1].rank ) ++nerr;
+        }
+
+        if ( !l ) {
+          for ( i=first; i<m; ++i ) {
+            send_cnt[cell2recv[i].rank] += m-first-1;
+          }
+        }
+        else {
+          for ( i=first; i<m; ++i ) {
+            dst = cell2recv[i].rank;
+            for ( j=first; j<m; ++j ) {
+              if ( j==i ) continue;
+              k = 3*(send_displ[dst] + pos[dst]);
+              val2send[k  ] = cell2recv[i].idx;
+              val2send[k+1] = nkey;
+              val2send[k+2] = cell2recv[j].rank;
+              ++pos[dst];
+            }
+          }
+          ++nkey;
+        }
+      }
+      first = m;
+    }
+
+    if ( !l ) {
+      send_displ[0] = 0;
+      for ( k=0; k<nprocs; ++k ) {
+        send_displ[k+1] = send_displ[k] + send_cnt[k];
+        pos[k] = 0;
+      }
+      nval2send = 3*send_displ[nprocs];
+      PMMG_MALLOC(parmesh,val2send,nval2send+1,int,"values to send",goto step3);
+    }
+  }
+  ier = nerr ? 0 : 1;
+
+step3:
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) goto end;
+  ier = 0;
+
+  PMMG_DEL_MEM(parmesh,cell2recv,PMMG_rdvCell,"received cells");
+
+  /** Step 3: send back the lists of sharers (as triples of integers) */
+  ier = PMMG_rdv_exchange(parmesh,val2send,send_cnt,send_displ,mpi_triple,
+                          3*sizeof(int),MPI_COMPLETENODECOMM_TAG+1,&rbuf,
+                          &nitem_rdv,&recv_rank,&recv_displ,&nmsg);
+  val2recv = (int*)rbuf;
+  PMMG_DEL_MEM(parmesh,val2send,int,"values to send");
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) goto end;
+  ier = 0;
+
+  /** Step 4: sort the sharers by rank and key and check that they contain the
+   * simple external communicators */
+  PMMG_MALLOC(parmesh,item,nitem_rdv+1,PMMG_rdvItem,"sharers",goto step4);
+  for ( k=0; k<nmsg; ++k ) {
+    for ( i=recv_displ[k]; i<recv_displ[k+1]; ++i ) {
+      item[i].rdv   = recv_rank[k];
+      item[i].idx   = val2recv[3*i];
+      item[i].key   = val2recv[3*i+1];
+      item[i].other = val2recv[3*i+2];
+    }
+  }
+  PMMG_DEL_MEM(parmesh,val2recv,int,"received values");
+
+  qsort(item,nitem_rdv,sizeof(PMMG_rdvItem),PMMG_compare_rdvItem);
+
+  PMMG_MALLOC(parmesh,stamp,nitem+1,int,"node stamp",goto step4);
+  PMMG_MALLOC(parmesh,iproc2comm,nprocs,int,"iproc2comm",goto step4);
+  for ( idx=0; idx<nitem; ++idx ) stamp[idx] = PMMG_UNSET;
+  for ( k=0; k<nprocs; ++k ) iproc2comm[k] = PMMG_UNSET;
+  for ( k=0; k<parmesh->next_node_comm; ++k ) {
+    iproc2comm[parmesh->ext_node_comm[k].color_out] = k;
+  }
+
+  ier = 1;
+  i   = 0;
+  while ( i<nitem_rdv ) {
+    color = item[i].other;
+    ++next_comm;
+    for ( m=i; m<nitem_rdv && item[m].other==color; ++m ) {
+      /* A node must appear only once in a communicator */
+      if ( stamp[item[m].idx] == color ) ier = 0;
+      stamp[item[m].idx] = color;
+    }
+    if ( iproc2comm[color] != PMMG_UNSET ) {
+      ext_node_comm = &parmesh->ext_node_comm[iproc2comm[color]];
+      for ( j=0; j<ext_node_comm->nitem; ++j ) {
+        if ( stamp[ext_node_comm->int_comm_index[j]] != color ) ier = 0;
+      }
+      iproc2comm[color] = PMMG_UNSET;
+    }
+    i = m;
+  }
+  /* Communicators with procs that have not been found */
+  for ( k=0; k<nprocs; ++k ) {
+    if ( iproc2comm[k] != PMMG_UNSET &&
+         parmesh->ext_node_comm[iproc2comm[k]].nitem ) ier = 0;
+  }
+
+step4:
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) {
+    ier = 0;
+    goto end;
+  }
+  ier = 0;
+
+  /** Step 5: build the new external communicators (in increasing order of the
+   * remote procs) */
+  PMMG_CALLOC(parmesh,new_ext_comm,next_comm,PMMG_Ext_comm,
+              "ext_node_comm ",goto end);
+
+  k = 0;
+  i = 0;
+  while ( i<nitem_rdv ) {
+    color = item[i].other;
+    for ( m=i; m<nitem_rdv && item[m].other==color; ++m );
+
+    ext_node_comm = &new_ext_comm[k++];
+    ext_node_comm->color_in  = rank;
+    ext_node_comm->color_out = color;
+    PMMG_MALLOC(parmesh,ext_node_comm->int_comm_index,m-i,int,
+                "external node communicator",goto end);
+    ext_node_comm->nitem = m-i;
+    for ( j=i; j<m; ++j ) {
+      ext_node_comm->int_comm_index[j-i] = item[j].idx;
+    }
+    i = m;
+  }
+  assert ( k==next_comm );
+
+  PMMG_parmesh_ext_comm_free( parmesh,parmesh->ext_node_comm,parmesh->next_node_comm);
+  PMMG_DEL_MEM(parmesh,parmesh->ext_node_comm,PMMG_Ext_comm,"ext node comm");
+  parmesh->ext_node_comm  = new_ext_comm;
+  parmesh->next_node_comm = next_comm;
+  new_ext_comm = NULL;
+
+  /* Success */
+  ier = 1;
+
+end:
+  if ( new_ext_comm ) {
+    PMMG_parmesh_ext_comm_free( parmesh,new_ext_comm,next_comm);
+    PMMG_DEL_MEM(parmesh,new_ext_comm,PMMG_Ext_comm,"ext node comm");
+  }
+  PMMG_DEL_MEM(parmesh,shared,int,"shared nodes");
+  PMMG_DEL_MEM(parmesh,coor,double,"node coordinates");
+  PMMG_DEL_MEM(parmesh,stamp,int,"node stamp");
+  PMMG_DEL_MEM(parmesh,iproc2comm,int,"iproc2comm");
+  PMMG_DEL_MEM(parmesh,cell2send,PMMG_rdvCell,"cells to send");
+  PMMG_DEL_MEM(parmesh,cell2recv,PMMG_rdvCell,"received cells");
+  PMMG_DEL_MEM(parmesh,val2send,int,"values to send");
+  PMMG_DEL_MEM(parmesh,val2recv,int,"received values");
+  PMMG_DEL_MEM(parmesh,item,PMMG_rdvItem,"sharers");
+  PMMG_DEL_MEM(parmesh,pos,int,"position in send buffer");
+  PMMG_DEL_MEM(parmesh,send_cnt,int,"send counts");
+  PMMG_DEL_MEM(parmesh,send_displ,int,"send displacements");
+  PMMG_DEL_MEM(parmesh,recv_rank,int,"recv ranks");
+  PMMG_DEL_MEM(parmesh,recv_displ,int,"recv displacements");
+  if ( mpi_rdvCell != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_rdvCell);
+  if ( mpi_triple  != MPI_DATATYPE_NULL ) MPI_Type_free(&mpi_triple);
 
   return ier;
 }
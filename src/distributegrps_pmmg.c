@@ -248,20 +248,27 @@ int PMMG_mergeGrpJinI_nodeCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
  * \param parmesh pointer toward the parmesh structure.
  * \param grpI pointer toward the group in which we want to merge.
  * \param grpJ pointer toward the group that we want to merge.
+ * \param nleft pointer toward the number of faces that have left the internal
+ * communicator in \a grpI (to update).
+ * \param left pointer toward the list of faces that have left the internal
+ * communicator in \a grpI (to update), NULL if not needed.
  *
  * \return 0 if fail, 1 otherwise
  *
  * Update the face communicators when merging the group \a grpJ into the group
- * \a grpI.
+ * \a grpI. The 2 copies (in the numbering of the merged mesh) of the faces
+ * shared by \a grpI and \a grpJ are appended to the \a left list, so the tags
+ * can be updated only around them (see \ref PMMG_updateTag_incr).
  *
  */
 static inline
 int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
-                                         PMMG_pGrp grpJ ) {
+                                         PMMG_pGrp grpJ,int *nleft,
+                                         int **left ) {
   int            nitem_int_face_commI,nitem_int_face_commJ,*intvalues;
-  int           *face2int_face_commI_index1;
+  int           *face2int_face_commI_index1,*face2int_face_commJ_index1;
   int           *face2int_face_commI_index2,*face2int_face_commJ_index2;
-  int            idx,k,iel;
+  int            idx,k,iel,nshared;
   int            new_nitem;
 
   intvalues = parmesh->int_face_comm->intvalues;
@@ -285,10 +292,24 @@ int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
 
   face2int_face_commI_index1  = grpI->face2int_face_comm_index1;
   face2int_face_commI_index2  = grpI->face2int_face_comm_index2;
+
+  /* Each face shared by grpI and grpJ leaves the communicator twice */
+  if ( left ) {
+    nshared = 0;
+    for ( k=0; k<nitem_int_face_commI; ++k ) {
+      if ( intvalues[face2int_face_commI_index2[k]]<0 ) ++nshared;
+    }
+    PMMG_REALLOC(parmesh,*left,*nleft+2*nshared,*nleft,int,
+                 "faces leaving comm",return 0);
+  }
+
   new_nitem = 0;
   for ( k=0; k<nitem_int_face_commI; ++k ) {
     idx = face2int_face_commI_index2[k];
-    if ( intvalues[idx]<0 ) continue;
+    if ( intvalues[idx]<0 ) {
+      if ( left ) (*left)[(*nleft)++] = face2int_face_commI_index1[k];
+      continue;
+    }
 
     face2int_face_commI_index1[new_nitem] = face2int_face_commI_index1[k];
     face2int_face_commI_index2[new_nitem] = face2int_face_commI_index2[k];
@@ -298,6 +319,7 @@ int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
   /** Step 2: Process the interface points of the group \a grpJ and add the
    * points used by the internal communicator in the list of interface points of
    * the group \a grpI */
+  face2int_face_commJ_index1  = grpJ->face2int_face_comm_index1;
   face2int_face_commJ_index2  = grpJ->face2int_face_comm_index2;
 
   for ( k=0; k<nitem_int_face_commJ; ++k ) {
@@ -305,7 +327,14 @@ int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
     iel = intvalues[idx];
 
     assert ( iel );
-    if ( iel<0 ) continue;
+    if ( iel<0 ) {
+      if ( left ) {
+        /* Copy of the face in grpJ: the tetra flag stores its index in grpI */
+        iel = face2int_face_commJ_index1[k];
+        (*left)[(*nleft)++] = 12*grpJ->mesh->tetra[iel/12].flag + iel%12;
+      }
+      continue;
+    }
 
     assert ( MG_EOK(&grpI->mesh->tetra[iel/12]) );
     face2int_face_commI_index1[new_nitem] = iel;
@@ -327,6 +356,10 @@ int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
  * \param parmesh pointer toward the parmesh structure.
  * \param grpI pointer toward the group in which we want to merge
  * \param grpJ pointer toward the group that we want to merge with group \a grpI
+ * \param nleft pointer toward the number of faces that have left the internal
+ * communicator in \a grpI (to update).
+ * \param left pointer toward the list of faces that have left the internal
+ * communicator in \a grpI (to update).
  *
  * \return 0 if fail, 1 otherwise
  *
@@ -337,9 +370,10 @@ int PMMG_mergeGrpJinI_faceCommunicators( PMMG_pParMesh parmesh,PMMG_pGrp grpI,
 static inline
 int PMMG_mergeGrpJinI_communicators(PMMG_pParMesh parmesh,PMMG_pGrp grpI,
                                     PMMG_pGrp grpJ, PMMG_pGrp grps,
-                                    int first_idx) {
+                                    int first_idx,int *nleft,int **left) {
 
-  if ( !PMMG_mergeGrpJinI_faceCommunicators(parmesh,grpI,grpJ) ) return 0;
+  if ( !PMMG_mergeGrpJinI_faceCommunicators(parmesh,grpI,grpJ,nleft,left) )
+    return 0;
 
   if ( !PMMG_mergeGrpJinI_nodeCommunicators(parmesh,grpI,grpJ,grps,first_idx) )
     return 0;
@@ -833,10 +867,13 @@ int PMMG_merge_grps2send(PMMG_pParMesh parmesh,idx_t **part) {
   PMMG_pGrp     grps,listgrp,grpI,grpJ;
   PMMG_Int_comm *int_node_comm,*int_face_comm;
   MMG5_pMesh    meshI,meshJ;
-  int           nprocs,ngrp,k,j,ier;
+  int           **left,*nleft;
+  int           nprocs,ngrp,k,j,ier,updated;
 
   nprocs = parmesh->nprocs;
   ngrp   = parmesh->ngrp;
+  left   = NULL;
+  nleft  = NULL;
 
   /** Step 1: New groups allocation and initialization: move the groups to have
    * a group that will be send to proc k stored in grps[k]. Free the adja
@@ -846,6 +883,14 @@ int PMMG_merge_grps2send(PMMG_pParMesh parmesh,idx_t **part) {
      with which we will communicate and fill directly the pack array. */
   PMMG_CALLOC( parmesh,grps,nprocs,PMMG_Grp,"Groups to send",return 0 );
 
+  /* Faces leaving the face communicator in each group to send (the incremental
+   * tag update is skipped if these arrays can't be allocated) */
+  PMMG_CALLOC( parmesh,left,nprocs,int*,"faces leaving comm",nleft = NULL );
+  if ( left ) {
+    PMMG_CALLOC( parmesh,nleft,nprocs,int,"nb of faces leaving comm",
+                 PMMG_DEL_MEM(parmesh,left,int*,"faces leaving comm") );
+  }
+
   j = 0;
   for ( k=0; k<ngrp; ++k ) {
     /* Free the adja array */
@@ -895,7 +940,10 @@ int PMMG_merge_grps2send(PMMG_pParMesh parmesh,idx_t **part) {
 
     if ( !PMMG_merge_grpJinI(parmesh,grpI,grpJ) ) goto low_fail;
 
-    if ( !PMMG_mergeGrpJinI_communicators(parmesh,grpI,grpJ,grps,k) ) goto low_fail;
+    if ( !PMMG_mergeGrpJinI_communicators(parmesh,grpI,grpJ,grps,k,
+                                          nleft ? &nleft[(*part)[k]] : NULL,
+                                          left  ? &left[(*part)[k]]  : NULL) )
+      goto low_fail;
 
     /* Delete the useless group to gain memory space */
     PMMG_grp_free(parmesh,&listgrp[k]);
@@ -910,6 +958,8 @@ strong_fail2:
   PMMG_DEL_MEM( parmesh,int_node_comm->intvalues,int,"node communicator");
 strong_fail1:
   PMMG_DEL_MEM( parmesh,grps,PMMG_Grp,"Groups to send");
+  PMMG_DEL_MEM( parmesh,nleft,int,"nb of faces leaving comm");
+  PMMG_DEL_MEM( parmesh,left,int*,"faces leaving comm");
   return -1;
 
 low_fail:
@@ -934,8 +984,34 @@ end:
   assert ( PMMG_check_extFaceComm(parmesh) );
   assert ( PMMG_check_extNodeComm(parmesh) );
 
-  /* Update tag on points, tetra */
-  if ( !PMMG_updateTag(parmesh) ) return -1;
+  /* Update tag on points, tetra: around the faces that have left the
+   * communicators if they are known for each final group, everywhere
+   * otherwise */
+  if ( ier == 1 && nleft ) {
+    /* The packing has stored in part[k] the initial position of group k */
+    for ( k=0; k<parmesh->ngrp; ++k ) {
+      j = (*part)[k];
+      if ( j == k ) continue;
+      nleft[k] = nleft[j];
+      left[k]  = left[j];
+      nleft[j] = 0;
+      left[j]  = NULL;
+    }
+    updated = PMMG_updateTag_incr(parmesh,nleft,left);
+  }
+  else {
+    updated = PMMG_updateTag(parmesh);
+  }
+
+  if ( left ) {
+    for ( k=0; k<nprocs; ++k ) {
+      PMMG_DEL_MEM( parmesh,left[k],int,"faces leaving comm");
+    }
+  }
+  PMMG_DEL_MEM( parmesh,nleft,int,"nb of faces leaving comm");
+  PMMG_DEL_MEM( parmesh,left,int*,"faces leaving comm");
+
+  if ( !updated ) return -1;
 
   if ( !PMMG_updateMeshSize(parmesh, 1) ) {
     fprintf(stderr,"\n  ## Error: %s: Unable to update the memory repartition"
@@ -947,882 +1023,816 @@ end:
 }
 
 /**
- * \param parmesh pointer toward the mesh structure.
- * \param recv index of the proc that receive the groups
- * \param interaction_map map of interactions with the other processors
- * \param intcomm_flag flag of the boundary faces of the sended group
- * \param nitem_intcomm_flag size of the incomm_flag array
- * \param recv_ext_idx buffer to receive data
- * \param nitem_recv_ext_idx size of recv_ext_idx buffer
- * \param ext_recv_comm external communicator \a myrank - \a recv
- * \param irequest mpi request of the send of the integer buffer
- * \param drequest mpi request of the send of the double buffer
- * \param trequest array of mpi requests of the send of the external comm
- *
- * \return 0 if fail, 1 if we success
- *
- * Transfer and update the data that are modified due to the transfer of the
- * groups from the local processor (\myrank) toward the proc \a recv.
+ * \struct PMMG_migrKey
+ *
+ * \brief Occurence of a parallel face in the face communicator of a local
+ * group, identified by the global key of the face.
  *
  */
-static inline
-int PMMG_transfer_grps_fromMetoJ(PMMG_pParMesh parmesh,const int recv,
-                                 int *interaction_map,int **intcomm_flag,
-                                 int *nitem_intcomm_flag,int **recv_ext_idx,
-                                 int *nitem_recv_ext_idx,
-                                 PMMG_pExt_comm ext_recv_comm,char **grps2send,
-                                 int *pack_size,MPI_Request *irequest,
-                                 MPI_Request *drequest,MPI_Request **trequest ) {
+typedef struct {
+  int key; /*!< global key of the face */
+  int grp; /*!< index of the group */
+  int pos; /*!< position of the face in the face2int_face_comm arrays of grp */
+} PMMG_migrKey;
 
-  PMMG_pGrp      grp;
-  PMMG_pInt_comm int_comm;
-  PMMG_pExt_comm ext_face_comm;
-  MPI_Status     status;
-  int            offset,nitem_recv_intcomm;
-  int            k,i,count,ier,ier0,old_nitem,idx;
-  int            *send2recv_int_comm,old_offset,nitem,nextcomm;
-  int            nitem_ext_recv_comm;
-  char           *ptr;
+/**
+ * \struct PMMG_migrItem
+ *
+ * \brief Face sent to (or received from) the processor that has assigned its
+ * key, to find the other processor that shares the face.
+ *
+ */
+typedef struct {
+  int key;  /*!< global key of the face */
+  int rank; /*!< owner of the key, sender of the key or sharer of the face */
+  int idx;  /*!< position in the internal comm or in the buffer of received keys */
+} PMMG_migrItem;
 
-  const int      myrank      = parmesh->myrank;
-  const int      nprocs      = parmesh->nprocs;
-  const int      ngrp        = parmesh->ngrp;
-  const MPI_Comm comm        = parmesh->comm;
+/**
+ * \param a pointer toward a PMMG_migrKey structure.
+ * \param b pointer toward a PMMG_migrKey structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than a, 0 if they are
+ * equal.
+ *
+ * Compare 2 face occurences (can be used inside the qsort C function), first
+ * on their keys, second on their groups and positions.
+ *
+ */
+static
+int PMMG_migr_compKey( const void *a,const void *b ) {
+  const PMMG_migrKey *k1 = (const PMMG_migrKey*)a;
+  const PMMG_migrKey *k2 = (const PMMG_migrKey*)b;
 
-  ier = 1;
+  if ( k1->key != k2->key ) return k1->key > k2->key ? 1 : -1;
+  if ( k1->grp != k2->grp ) return k1->grp > k2->grp ? 1 : -1;
+  if ( k1->pos != k2->pos ) return k1->pos > k2->pos ? 1 : -1;
 
-  int_comm = parmesh->int_face_comm;
+  return 0;
+}
 
-  send2recv_int_comm = NULL;
+/**
+ * \param a pointer toward a PMMG_migrItem structure.
+ * \param b pointer toward a PMMG_migrItem structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than a, 0 if they are
+ * equal.
+ *
+ * Compare 2 faces (can be used inside the qsort C function), first on their
+ * ranks, second on their keys.
+ *
+ */
+static
+int PMMG_migr_compItemRank( const void *a,const void *b ) {
+  const PMMG_migrItem *i1 = (const PMMG_migrItem*)a;
+  const PMMG_migrItem *i2 = (const PMMG_migrItem*)b;
 
-  /** Step 1: fill the send2recv_int_comm array that contains the positions (in
-   * the internal communicator of the proc \a recv) of the faces of the groups
-   * that are transfered */
+  if ( i1->rank != i2->rank ) return i1->rank > i2->rank ? 1 : -1;
+  if ( i1->key  != i2->key  ) return i1->key  > i2->key  ? 1 : -1;
 
-  /* Flag the faces of the internal communicator. A face is :
-   *  - 1 if it is a // boundary of a group that doesn't move;
-   *  - 2 if it is at the interface between 2 groups that doesn't move;
-   *  - 3 if it is a // boundary of a group that is transfered;
-   *  - 4 if it is at the interface between a group that move and another that doesn't;
-   *  - 6 if it is at the interface of 2 groups that are transfered.
-   */
-  *nitem_intcomm_flag = int_comm->nitem;
-  PMMG_CALLOC(parmesh,*intcomm_flag,*nitem_intcomm_flag,int,"intcomm_flag",ier=0);
-  count = 0;
+  return 0;
+}
 
-  if ( *intcomm_flag ) {
-    for ( k=0; k<ngrp; ++k ) {
-      grp = &parmesh->listgrp[k];
+/**
+ * \param a pointer toward a PMMG_migrItem structure.
+ * \param b pointer toward a PMMG_migrItem structure.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than a, 0 if they are
+ * equal.
+ *
+ * Compare 2 faces (can be used inside the qsort C function), first on their
+ * keys, second on their ranks.
+ *
+ */
+static
+int PMMG_migr_compItemKey( const void *a,const void *b ) {
+  const PMMG_migrItem *i1 = (const PMMG_migrItem*)a;
+  const PMMG_migrItem *i2 = (const PMMG_migrItem*)b;
 
-      if ( recv != grp->flag ) {
-        for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
-          idx = grp->face2int_face_comm_index2[i];
-          (*intcomm_flag)[idx] += 1;
-        }
-      }
-      else {
-        ++count;
-        for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
-          idx = grp->face2int_face_comm_index2[i];
-          (*intcomm_flag)[idx] += 3;
-        }
-      }
-    }
-  }
+  if ( i1->key  != i2->key  ) return i1->key  > i2->key  ? 1 : -1;
+  if ( i1->rank != i2->rank ) return i1->rank > i2->rank ? 1 : -1;
 
-  /* Store the size of the internal communicator of \a recv and the index in
-   * this communicator of the faces of the external communicator myrank-recv */
-  nitem = ext_recv_comm ? ext_recv_comm->nitem : 0;
+  return 0;
+}
 
-  *nitem_recv_ext_idx = nitem + 1;
-  PMMG_MALLOC(parmesh,*recv_ext_idx,*nitem_recv_ext_idx,int,"recv_ext_idx",ier=0);
-  /* MPI_Recv will fail if recv_ext_idx is not allocated */
-  MPI_CHECK( MPI_Recv(*recv_ext_idx,*nitem_recv_ext_idx,MPI_INT,recv,
-                      MPI_TRANSFER_GRP_TAG+1,comm,&status), ier=0 );
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param keydispl array of size nprocs filled by the first key assigned by
+ * each processor.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Give a global key to each face of the face communicators: each processor
+ * numbers the faces of its internal communicator that are not shared with a
+ * processor of lower rank, then the keys of the faces shared with a processor
+ * of higher rank are sent to this processor (one neighbour round). The
+ * face2int_face_comm_index2 arrays of the groups are replaced by the face keys
+ * and the face communicators of the parmesh are deleted.
+ *
+ * \remark the group communicators don't depend anymore on the location of the
+ * groups so they can be moved toward any processor.
+ *
+ */
+static
+int PMMG_faceComm2keys( PMMG_pParMesh parmesh,int *keydispl ) {
+  PMMG_pInt_comm int_face_comm;
+  PMMG_pExt_comm ext_face_comm;
+  PMMG_pGrp      grp;
+  MPI_Request    *request;
+  int            *key,nowned,offset,ier,k,i;
 
-  /* Fill the send2recv_int_comm array */
-  offset = 0;
-  nitem_recv_intcomm = (*recv_ext_idx)[offset++];
+  const int      myrank = parmesh->myrank;
+  const MPI_Comm comm   = parmesh->comm;
 
-  PMMG_MALLOC(parmesh,send2recv_int_comm,int_comm->nitem,int,"send2recv_int_comm",
-              ier = MG_MIN (ier,0) );
+  int_face_comm = parmesh->int_face_comm;
+  key     = NULL;
+  request = NULL;
+  ier     = 1;
 
-  if ( send2recv_int_comm ) {
-    for ( k=0; k<int_comm->nitem; ++k ) {
-      send2recv_int_comm[k] = PMMG_UNSET;
-    }
+  PMMG_MALLOC(parmesh,key,int_face_comm->nitem,int,"face keys",ier = 0);
+  PMMG_MALLOC(parmesh,request,parmesh->next_face_comm,MPI_Request,
+              "request_tab",ier = 0);
 
-    /* Process the myrank-recv external communicator and store the position of
-     * this faces in the internal communicator of \a recv */
-    for ( i=0; i<nitem; ++i ) {
-      idx = ext_recv_comm->int_comm_index[i];
-      send2recv_int_comm[idx] = (*recv_ext_idx)[offset++];
+  for ( k=0; k<parmesh->next_face_comm; ++k ) {
+    ext_face_comm = &parmesh->ext_face_comm[k];
+    ext_face_comm->nitem_to_share = ext_face_comm->nitem;
+    if ( ext_face_comm->color_out > myrank ) {
+      PMMG_MALLOC(parmesh,ext_face_comm->itosend,ext_face_comm->nitem,int,
+                  "itosend",ier = 0);
     }
-
-    /* Process the groups and store the position (in the internal comm of \a recv)
-     * of the new faces of \a recv */
-    for ( k=0; k<ngrp; ++k ) {
-      grp = &parmesh->listgrp[k];
-      if ( recv != grp->flag ) continue;
-
-      for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
-        idx = grp->face2int_face_comm_index2[i];
-        if ( send2recv_int_comm[idx] >=0 ) continue;
-
-        send2recv_int_comm[idx] = nitem_recv_intcomm++;
-      }
+    else {
+      PMMG_MALLOC(parmesh,ext_face_comm->itorecv,ext_face_comm->nitem,int,
+                  "itorecv",ier = 0);
     }
   }
 
-  /** Step 2: Add the new faces of the external communicator myrank-recv to the
-   * external communicator myrank-recv and to the recv_ext_idx array (due to the
-   * transfer of the groups from myrank toward recv) */
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
 
-  /* Count the number of faces to add to the external communicator (faces flagged 4 ) */
-  idx = 0;
-  if ( *intcomm_flag ) {
-    for ( k=0; k<int_comm->nitem; ++k ) {
-      if ( 4 == (*intcomm_flag)[k] ) ++idx;
-    }
+  /** Step 1: number the faces that are not received from a lower rank */
+  for ( i=0; i<int_face_comm->nitem; ++i ) {
+    key[i] = 0;
   }
+  for ( k=0; k<parmesh->next_face_comm; ++k ) {
+    ext_face_comm = &parmesh->ext_face_comm[k];
+    if ( ext_face_comm->color_out > myrank ) continue;
 
-  /* Store in recv_ext_idx the number of groups to send, the new size of the
-   * internal communicator of \a recv and the number of new faces in the
-   * external communicator myrank-recv */
-  PMMG_REALLOC ( parmesh,*recv_ext_idx,idx+3,*nitem_recv_ext_idx,int,"recv_ext_idx",
-                 ier = 0);
-  *nitem_recv_ext_idx = idx + 3;
-
-  offset = 0;
-  (*recv_ext_idx)[offset++] = count;
-  (*recv_ext_idx)[offset++] = nitem_recv_intcomm;
-  (*recv_ext_idx)[offset++] = idx;
-
-  if ( idx ) {
-    old_nitem = nitem;
-
-    ier0 = 1;
-    if ( !ext_recv_comm ) {
-      /* Enlarge the list of external communicators */
-      if ( !PMMG_resize_extCommArray ( parmesh,&parmesh->ext_face_comm,
-                                       parmesh->next_face_comm+1,
-                                       &parmesh->next_face_comm ) ) {
-        ier0 = 0;
-        ier = MG_MIN(ier,ier0);
-      }
-
-      ext_recv_comm = &parmesh->ext_face_comm[parmesh->next_face_comm-1];
-      ext_recv_comm->color_in  = myrank;
-      ext_recv_comm->color_out = recv;
-    }
-
-    if ( ier0 ) {
-      if ( !PMMG_resize_extComm ( parmesh,ext_recv_comm,old_nitem+idx,
-                                  &ext_recv_comm->nitem ) ) {
-        ier0 = 0;
-        ier = MG_MIN(ier,ier0);
-      }
-
-      for ( k=0; k<int_comm->nitem; ++k ) {
-        if ( 4 != (*intcomm_flag)[k] ) continue;
-
-        /* Add the new faces to the external comm myrank-recv */
-        if ( ier0 )
-          ext_recv_comm->int_comm_index[old_nitem++] = k;
-
-        /* Add the new faces to the external comm to send to recv */
-        (*recv_ext_idx)[offset++] = send2recv_int_comm ? send2recv_int_comm[k] : 0;
-      }
-    }
-    else {
-      /* Unable to allocate ext_recv_comm */
-      for ( k=0; k<int_comm->nitem; ++k ) {
-        if ( 4 != (*intcomm_flag)[k] ) continue;
-        offset++;
-      }
+    for ( i=0; i<ext_face_comm->nitem; ++i ) {
+      key[ext_face_comm->int_comm_index[i]] = PMMG_UNSET;
     }
   }
-  assert ( offset==*nitem_recv_ext_idx );
-
-  /** Step 3: Delete the old faces of the external communicator myrank-recv (due
-   * to the transfer of the groups from myrank toward recv) from the external
-   * communicator myrank-recv and add at the end of the recv_ext_idx array the
-   * mark of the faces of the external communicator (0 if a face is
-   * keeped, 1 otherwise). */
-  old_offset = *nitem_recv_ext_idx;
-
-  nitem_ext_recv_comm = ext_recv_comm ? ext_recv_comm->nitem : 0;
-  PMMG_REALLOC ( parmesh,*recv_ext_idx,*nitem_recv_ext_idx+nitem_ext_recv_comm+1,
-                 *nitem_recv_ext_idx,int,"recv_ext_idx",ier=0);
-  *nitem_recv_ext_idx += nitem_ext_recv_comm + 1;
 
-  /* Add the mark of the faces of the external comm (1 if deleted, 0 if keeped)
-   * to recv_ext_idx and count the number of faces to remove from the external
-   * communicator (faces flagged 3 ) */
-  count = 0;
-
-  if ( *intcomm_flag && *recv_ext_idx ) {
-    for ( k=0; k<nitem_ext_recv_comm; ++k ) {
-      idx = ext_recv_comm->int_comm_index[k];
-
-      if ( 3 == (*intcomm_flag)[idx] ) {
-        (*recv_ext_idx)[offset++] = 1;
-        ++count;
-      }
-      else {
-        (*recv_ext_idx)[offset++] = 0;
-      }
-    }
+  nowned = 0;
+  for ( i=0; i<int_face_comm->nitem; ++i ) {
+    if ( key[i] != PMMG_UNSET ) ++nowned;
   }
 
-  if ( *recv_ext_idx )
-    (*recv_ext_idx)[offset++] = count;
+  offset = 0;
+  MPI_CHECK( MPI_Exscan(&nowned,&offset,1,MPI_INT,MPI_SUM,comm), ier = 0 );
+  if ( !myrank ) offset = 0;
 
-  /* Remove the faces from the external communicator */
-  nitem = 0;
-  if ( *recv_ext_idx ) {
-    for ( k=0; k<nitem_ext_recv_comm; ++k ) {
-      idx = ext_recv_comm->int_comm_index[k];
+  MPI_CHECK( MPI_Allgather(&offset,1,MPI_INT,keydispl,1,MPI_INT,comm), ier = 0 );
 
-      if ( (*recv_ext_idx)[old_offset+k] ) {
-        /* this face must be removed */
-        continue;
-      }
-      else {
-        /* Pack the external communicator */
-        ext_recv_comm->int_comm_index[nitem++] = idx;
-      }
-    }
-    if ( nitem_ext_recv_comm ) {
-      if ( !PMMG_resize_extComm ( parmesh,ext_recv_comm,nitem,
-                                  &ext_recv_comm->nitem ) ) {
-        ier = MG_MIN ( ier, 0 );
-      }
-    }
+  for ( i=0; i<int_face_comm->nitem; ++i ) {
+    if ( key[i] != PMMG_UNSET ) key[i] = offset++;
   }
 
-  /** Step 4: When transferring the groups from myrank toward recv, the groups
-   *   faces of the external communicators myrank-procB (procB != recv) becames
-   *   faces of the external communicators (recv-procB):
-   *
-   * - remove the groups faces from the ext comm procB-myrank on procB and add
-   *   it in procB-recv (send their positions in the internal comm of procB);
-   *
-   * - add the groups faces to the ext comm recv-procB on recv: append to the
-   *   recv_ext_idx array the number of external comm to update, for each
-   *   external communicator, the number of faces to add and the list of faces.
-   */
-  ier0 = 1;
-  PMMG_MALLOC ( parmesh,*trequest,nprocs,MPI_Request,"request_tab",
-                ier0 = 0; ier = MG_MIN(ier,ier0); );
-  if ( ier0 )
-    for ( k=0; k<nprocs; ++k ) {
-      (*trequest)[k] = MPI_REQUEST_NULL;
-    }
-
-  nextcomm = 0;
-  count    = 0;
-
+  /** Step 2: send the keys toward the processors of higher rank */
   for ( k=0; k<parmesh->next_face_comm; ++k ) {
     ext_face_comm = &parmesh->ext_face_comm[k];
-    if ( ext_face_comm->color_out == recv || !ext_face_comm->nitem ) continue;
-
-    ++nextcomm;
-
-    ext_face_comm->nitem_to_share = ext_face_comm->nitem;
+    request[k]    = MPI_REQUEST_NULL;
 
-    PMMG_MALLOC ( parmesh,ext_face_comm->itosend,ext_face_comm->nitem_to_share,
-                  int,"itosend",ier = MG_MIN(ier,0); );
-
-    if ( *intcomm_flag && ext_face_comm->itosend ) {
+    if ( ext_face_comm->color_out > myrank ) {
       for ( i=0; i<ext_face_comm->nitem; ++i ) {
-        idx = ext_face_comm->int_comm_index[i];
-
-        if ( 3 != (*intcomm_flag)[idx] ) {
-          ext_face_comm->itosend[i] = 0;
-        }
-        else {
-          /* We want to remove this face */
-          ++count;
-          ext_face_comm->itosend[i] = PMMG_UNSET;
-        }
+        ext_face_comm->itosend[i] = key[ext_face_comm->int_comm_index[i]];
       }
+      MPI_CHECK( MPI_Isend(ext_face_comm->itosend,ext_face_comm->nitem,MPI_INT,
+                           ext_face_comm->color_out,MPI_TRANSFER_GRP_TAG,comm,
+                           &request[k]), ier = 0 );
     }
-
-    if ( interaction_map[ext_face_comm->color_out] ) {
-      MPI_CHECK ( MPI_Isend(ext_face_comm->itosend,ext_face_comm->nitem_to_share,
-                            MPI_INT,ext_face_comm->color_out,MPI_TRANSFER_GRP_TAG+30,
-                            comm,&((*trequest)[ext_face_comm->color_out])), ier=0 );
+    else {
+      MPI_CHECK( MPI_Irecv(ext_face_comm->itorecv,ext_face_comm->nitem,MPI_INT,
+                           ext_face_comm->color_out,MPI_TRANSFER_GRP_TAG,comm,
+                           &request[k]), ier = 0 );
     }
   }
+  MPI_CHECK( MPI_Waitall(parmesh->next_face_comm,request,MPI_STATUSES_IGNORE),
+             ier = 0 );
 
-  PMMG_REALLOC ( parmesh,*recv_ext_idx,*nitem_recv_ext_idx+1+2*nextcomm+count,
-                 *nitem_recv_ext_idx,int,"recv_ext_idx",ier=0);
-  *nitem_recv_ext_idx += 1 + 2*nextcomm + count;
-
-  if ( *recv_ext_idx )
-    (*recv_ext_idx)[offset++] = nextcomm;
-
-  old_offset = offset;
-  /* Store in [old_offset:old_offset+2*nextcomm] the number of faces to send for
-   * each communicator and the color_out of the external comm */
-  offset += 2*nextcomm;
-
-  nextcomm = 0;
   for ( k=0; k<parmesh->next_face_comm; ++k ) {
     ext_face_comm = &parmesh->ext_face_comm[k];
-    if ( ext_face_comm->color_out == recv || !ext_face_comm->nitem ) continue;
-
-    count = 0;
-    nitem = 0;
-    if ( *intcomm_flag && *recv_ext_idx ) {
-      for ( i=0; i<ext_face_comm->nitem; ++i ) {
-        idx = ext_face_comm->int_comm_index[i];
-
-        if ( 3 == (*intcomm_flag)[idx] ) {
-          (*recv_ext_idx)[offset++] = send2recv_int_comm ? send2recv_int_comm[idx] : 0;
-          ++count;
-        }
-        else {
-          /* We want to add this face to the remote communicator and to remove it
-           * from the local one */
-          ext_face_comm->int_comm_index[nitem++] = idx;
-        }
-      }
-    }
-    if ( !PMMG_resize_extComm(parmesh,ext_face_comm,nitem,&ext_face_comm->nitem) )
-      ier = 0;
+    if ( ext_face_comm->color_out > myrank ) continue;
 
-    if ( *recv_ext_idx ) {
-      (*recv_ext_idx)[old_offset + nextcomm++] = count;
-      (*recv_ext_idx)[old_offset + nextcomm++] = ext_face_comm->color_out;
+    for ( i=0; i<ext_face_comm->nitem; ++i ) {
+      key[ext_face_comm->int_comm_index[i]] = ext_face_comm->itorecv[i];
     }
   }
 
-  /** Step 5: send the buffer to the proc recv */
-  *irequest = MPI_REQUEST_NULL;
-  assert ( *nitem_recv_ext_idx == offset );
-  MPI_CHECK ( MPI_Isend(*recv_ext_idx,*nitem_recv_ext_idx,MPI_INT,recv,
-                        MPI_TRANSFER_GRP_TAG+3, comm,irequest), ier = 0 );
-
-  /** Step 6: send and receive the groups */
-  *pack_size = 0;
-  for ( k=0; k<ngrp; ++k ) {
+  /** Step 3: store the keys in the group communicators */
+  for ( k=0; k<parmesh->ngrp; ++k ) {
     grp = &parmesh->listgrp[k];
-    if ( grp->flag != recv ) continue;
-
-    /* Update the face2int_index2 array */
     for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
-      idx = grp->face2int_face_comm_index2[i];
-      grp->face2int_face_comm_index2[i] = send2recv_int_comm ? send2recv_int_comm[idx] : 0;
+      grp->face2int_face_comm_index2[i] = key[grp->face2int_face_comm_index2[i]];
     }
-
-    *pack_size += PMMG_mpisizeof_grp(grp);
   }
 
-  /* Pack the groups */
-  PMMG_MALLOC ( parmesh,*grps2send,*pack_size,char,"grps2send",
-                ier = MG_MIN(ier,0) );
-
-  ptr = *grps2send;
-  for ( k=0; k<ngrp; ++k ) {
-    grp = &parmesh->listgrp[k];
-
-    if ( grp->flag != recv ) continue;
-    PMMG_mpipack_grp(grp,&ptr);
+end:
+  /** Step 4: delete the face communicators of the parmesh */
+  if ( ier ) {
+    PMMG_parmesh_ext_comm_free( parmesh,parmesh->ext_face_comm,
+                                parmesh->next_face_comm );
+    PMMG_DEL_MEM(parmesh,parmesh->ext_face_comm,PMMG_Ext_comm,"ext face comm");
+    parmesh->next_face_comm = 0;
+    int_face_comm->nitem    = 0;
   }
-
-  /* Send its */
-  *drequest = MPI_REQUEST_NULL;
-  MPI_CHECK ( MPI_Isend ( *grps2send,*pack_size,MPI_CHAR,recv,MPI_SENDGRP_TAG,
-                           comm,drequest), ier = 0 );
-
-  /** Free the memory */
-  /* Group deletion */
-  for ( k=0; k<parmesh->ngrp; ++k ) {
-    if ( parmesh->listgrp[k].flag == recv ) {
-      PMMG_grp_free ( parmesh,&parmesh->listgrp[k] );
+  else {
+    for ( k=0; k<parmesh->next_face_comm; ++k ) {
+      ext_face_comm = &parmesh->ext_face_comm[k];
+      PMMG_DEL_MEM(parmesh,ext_face_comm->itosend,int,"itosend");
+      PMMG_DEL_MEM(parmesh,ext_face_comm->itorecv,int,"itorecv");
     }
   }
 
-  PMMG_DEL_MEM ( parmesh,send2recv_int_comm,int,"send2recv_int_comm" );
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"request_tab");
+  PMMG_DEL_MEM(parmesh,key,int,"face keys");
 
   return ier;
 }
 
 /**
- * \param parmesh pointer toward the mesh structure.
- * \param sndr index of the proc that send the groups
- * \param interaction_map map of interactions with the other processors
- * \param intcomm_flag position in the internal comm of the faces of the
- * external comm sndr-recv
- * \param nitem_intcomm_flag size of the incomm_flag array
- * \param recv_ext_idx buffer to receive data
- * \param nitem_recv_ext_idx size of recv_ext_idx buffer
- * \param ext_send_comm external communicator \a myrank - \a sndr
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 0 if fail, 1 if success.
  *
- * \return 0 if fail, 1 if we success
+ * Give a global key to each node of the node communicators: each processor
+ * numbers the nodes of its internal communicator with a unique key, then the
+ * minimal key of each node is propagated through the external node
+ * communicators until no key changes. The node2int_node_comm_index2 arrays of
+ * the groups are replaced by the node keys and the node communicators of the
+ * parmesh are deleted.
  *
- * Transfer and update the data that are modified due to the transfer of the
- * groups from the processor \a sndr toward the local proc (\a myrank).
+ * \remark If the keys can't be computed, the group communicators are deleted
+ * too and the node communicators will be rebuilt by matching the node
+ * coordinates.
  *
  */
-static inline
-int PMMG_transfer_grps_fromItoMe(PMMG_pParMesh parmesh,const int sndr,
-                                 int *interaction_map,int **intcomm_flag,
-                                 int *nitem_intcomm_flag,int **recv_ext_idx,
-                                 int *nitem_recv_ext_idx,
-                                 PMMG_pExt_comm ext_send_comm,
-                                 MPI_Request *irequest) {
-
-  PMMG_pExt_comm ext_face_comm;
-  MPI_Status     status;
-  int            pack_size;
-  int            k,ier,ier0,recv_int_nitem,offset,old_nitem;
-  int            *send2recv_int_comm,nitem,nextcomm;
-  int            old_offset,grpscount,idx,color_out,n,err;
-  char           *buffer,*ptr;
-
-  const int      myrank      = parmesh->myrank;
-  const int      ngrp        = parmesh->ngrp;
-  const MPI_Comm comm        = parmesh->comm;
-
-#ifndef NDEBUG
-  MMG5_pMesh     mesh;
-#endif
-
-  ier = 1;
+static
+int PMMG_nodeComm2keys( PMMG_pParMesh parmesh ) {
+  PMMG_pInt_comm int_node_comm;
+  PMMG_pExt_comm ext_node_comm;
+  PMMG_pGrp      grp;
+  MPI_Request    *request;
+  int            *key,offset,ier,update,iter,k,i,idx;
 
-  send2recv_int_comm = NULL;
+  const int      nprocs = parmesh->nprocs;
+  const MPI_Comm comm   = parmesh->comm;
 
-  /** Step 1: build the send2recv_int_comm array that gives the new
-      face2int_face_comm_index pointer for the received group */
-  *nitem_intcomm_flag = ext_send_comm ? ext_send_comm->nitem + 1 : 1;
-  PMMG_MALLOC ( parmesh,(*intcomm_flag),*nitem_intcomm_flag,int,"intcomm_flag",
-                *nitem_intcomm_flag = 1;ier = 0 );
+  int_node_comm = parmesh->int_node_comm;
+  key     = NULL;
+  request = NULL;
+  ier     = 1;
 
-  if ( *intcomm_flag ) {
-    (*intcomm_flag)[0] = parmesh->int_face_comm->nitem;
+  PMMG_MALLOC(parmesh,key,int_node_comm->nitem,int,"node keys",ier = 0);
+  PMMG_MALLOC(parmesh,request,2*parmesh->next_node_comm,MPI_Request,
+              "request_tab",ier = 0);
 
-    if ( ext_send_comm ) {
-      for ( k=0; k<ext_send_comm->nitem; ++k ) {
-        (*intcomm_flag)[k+1] = ext_send_comm->int_comm_index[k];
-      }
-    }
+  for ( k=0; k<parmesh->next_node_comm; ++k ) {
+    ext_node_comm = &parmesh->ext_node_comm[k];
+    PMMG_MALLOC(parmesh,ext_node_comm->itosend,ext_node_comm->nitem,int,
+                "itosend",ier = 0);
+    PMMG_MALLOC(parmesh,ext_node_comm->itorecv,ext_node_comm->nitem,int,
+                "itorecv",ier = 0);
   }
 
-  /* Send the size of the internal communicator and the position of the item of
-   * the external communicator in the internal communicator */
-  *irequest = MPI_REQUEST_NULL;
-  MPI_CHECK ( MPI_Isend ( *intcomm_flag,*nitem_intcomm_flag,MPI_INT,sndr,
-                          MPI_TRANSFER_GRP_TAG+1,comm,irequest ), ier = 0 );
-
-  /* Receive the external communicator */
-  MPI_CHECK ( MPI_Probe(sndr,MPI_TRANSFER_GRP_TAG+3,comm,&status), ier = 0 );
-  MPI_CHECK ( MPI_Get_count(&status,MPI_INT,nitem_recv_ext_idx), ier = 0 );
-
-  PMMG_MALLOC ( parmesh,*recv_ext_idx,*nitem_recv_ext_idx,int,"recv_ext_idx",
-                ier = 0 );
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
 
-  MPI_CHECK ( MPI_Recv(*recv_ext_idx,*nitem_recv_ext_idx,MPI_INT,sndr,MPI_TRANSFER_GRP_TAG+3,comm,&status),
-              ier = 0 );
+  /** Step 1: give a unique key to each node of the internal communicator */
   offset = 0;
+  MPI_CHECK( MPI_Exscan(&int_node_comm->nitem,&offset,1,MPI_INT,MPI_SUM,comm),
+             ier = 0 );
+  if ( !parmesh->myrank ) offset = 0;
 
-  /* Get the number of groups to receive */
-  grpscount = (*recv_ext_idx)[offset++];
-
-  /* Get the size of the new internal communicator */
-  recv_int_nitem = (*recv_ext_idx)[offset++];
-
-  PMMG_MALLOC ( parmesh,parmesh->int_face_comm->intvalues,recv_int_nitem,
-                int,"int_face_comm",ier = MG_MIN (ier,0) );
-  parmesh->int_face_comm->nitem = recv_int_nitem;
-
-  /** Step 2: Add the new faces of the external communicator myrank-sndr to the
-   * external communicator myrank-sndr (due to the transfer of the groups from
-   * sndr toward myrank) (intcomm_flag = 4 ) */
-  n = (*recv_ext_idx)[offset++];
+  for ( i=0; i<int_node_comm->nitem; ++i ) {
+    key[i] = offset+i;
+  }
 
-  if ( n ) {
+  /** Step 2: keep the minimal key of the occurences of each node (one
+   * neighbour round is enough if the external communicators are complete) */
+  for ( iter=0; iter<nprocs; ++iter ) {
+    update = 0;
 
-    ier0 = 1;
-    if ( !ext_send_comm ) {
-      /* Enlarge external communicator */
-      if ( !PMMG_resize_extCommArray ( parmesh,&parmesh->ext_face_comm,
-                                       parmesh->next_face_comm+1,
-                                       &parmesh->next_face_comm ) ) {
-        ier0 = 0;
-        ier = MG_MIN(ier,ier0);
-      }
-      else {
-        ext_send_comm = &parmesh->ext_face_comm[parmesh->next_face_comm-1];
-        ext_send_comm->color_in  = myrank;
-        ext_send_comm->color_out = sndr;
-      }
+    /* A failed send or receive leaves its request unset: the wait needs valid
+     * requests */
+    for ( k=0; k<2*parmesh->next_node_comm; ++k ) {
+      request[k] = MPI_REQUEST_NULL;
     }
 
-    if ( ier0 ) {
-      old_nitem = ext_send_comm->nitem;
-
-      if ( !PMMG_resize_extComm(parmesh,ext_send_comm,n+ext_send_comm->nitem,
-                                &ext_send_comm->nitem) ) {
-        ier = MG_MIN(ier,ier0);
-        /* Fail to alloc the external communicator sndr - myrank */
-        for ( k=0; k<n; ++k ) offset++;
+    for ( k=0; k<parmesh->next_node_comm; ++k ) {
+      ext_node_comm = &parmesh->ext_node_comm[k];
+      for ( i=0; i<ext_node_comm->nitem; ++i ) {
+        ext_node_comm->itosend[i] = key[ext_node_comm->int_comm_index[i]];
       }
-      else {
-        for ( k=0; k<n; ++k ) {
-          ext_send_comm->int_comm_index[old_nitem+k] = (*recv_ext_idx)[offset++];
+      MPI_CHECK( MPI_Isend(ext_node_comm->itosend,ext_node_comm->nitem,MPI_INT,
+                           ext_node_comm->color_out,MPI_COMMUNICATORS_NODE_TAG,comm,
+                           &request[2*k]), ier = 0 );
+      MPI_CHECK( MPI_Irecv(ext_node_comm->itorecv,ext_node_comm->nitem,MPI_INT,
+                           ext_node_comm->color_out,MPI_COMMUNICATORS_NODE_TAG,comm,
+                           &request[2*k+1]), ier = 0 );
+    }
+    MPI_CHECK( MPI_Waitall(2*parmesh->next_node_comm,request,MPI_STATUSES_IGNORE),
+               ier = 0 );
+
+    for ( k=0; k<parmesh->next_node_comm; ++k ) {
+      ext_node_comm = &parmesh->ext_node_comm[k];
+      for ( i=0; i<ext_node_comm->nitem; ++i ) {
+        idx = ext_node_comm->int_comm_index[i];
+        if ( ext_node_comm->itorecv[i] < key[idx] ) {
+          key[idx] = ext_node_comm->itorecv[i];
+          update   = 1;
         }
       }
     }
-    else {
-      /* Fail to alloc the external communicator sndr - myrank */
-      for ( k=0; k<n; ++k ) offset++;
+
+    MPI_Allreduce( MPI_IN_PLACE, &update, 1, MPI_INT, MPI_MAX, comm);
+    if ( !update ) break;
+  }
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
+
+  /** Step 3: store the keys in the group communicators */
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    grp = &parmesh->listgrp[k];
+    for ( i=0; i<grp->nitem_int_node_comm; ++i ) {
+      grp->node2int_node_comm_index2[i] = key[grp->node2int_node_comm_index2[i]];
     }
   }
 
-  /** Step 3: Delete the old faces of the external communicator myrank-sndr (due
-   * to the transfer of the groups from sndr toward myrank) from the external
-   * communicator myrank-sndr (intcomm_flag = 3) */
+end:
+  for ( k=0; k<parmesh->next_node_comm; ++k ) {
+    ext_node_comm = &parmesh->ext_node_comm[k];
+    PMMG_DEL_MEM(parmesh,ext_node_comm->itosend,int,"itosend");
+    PMMG_DEL_MEM(parmesh,ext_node_comm->itorecv,int,"itorecv");
+  }
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"request_tab");
+  PMMG_DEL_MEM(parmesh,key,int,"node keys");
 
-  /* New number of faces */
-  n = 0;
-  if ( ext_send_comm ) {
-    for ( k=0; k<ext_send_comm->nitem; ++k ) {
-      idx = ext_send_comm->int_comm_index[k];
+  /** Step 4: delete the node communicators of the parmesh (and of the groups
+   * if we have failed) */
+  if ( !ier ) {
+    PMMG_node_comm_free(parmesh);
+  }
+  else {
+    PMMG_parmesh_int_comm_free( parmesh,parmesh->int_node_comm);
+    PMMG_parmesh_ext_comm_free( parmesh,parmesh->ext_node_comm,
+                                parmesh->next_node_comm);
+    PMMG_DEL_MEM(parmesh, parmesh->ext_node_comm,PMMG_Ext_comm,"ext node comm");
+    parmesh->next_node_comm       = 0;
+    parmesh->int_node_comm->nitem = 0;
+  }
 
-      if ( (*recv_ext_idx)[offset++] ) {
-        /* Face to remove from the external communicator */
-        continue;
-      }
-      else {
-        ext_send_comm->int_comm_index[n++] = idx;
-      }
-    }
+  return ier;
+}
 
-    assert ( ext_send_comm->nitem-n==(*recv_ext_idx)[offset] );
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ *
+ * \return 0 if fail, 1 if success.
+ *
+ * Send the groups whose flag is not the local rank toward the processor
+ * stored in their flag and receive the groups sent by the other processors.
+ * All the sends are posted at once (synchronous mode) and the receives are
+ * driven by probing the incoming messages, so the processors only have to know
+ * to whom they send (and not from whom they receive): when its sends are
+ * completed, a processor enters a non-blocking barrier and keep on receiving
+ * until every processor has entered the barrier.
+ *
+ * \remark the face communicators of the groups must store the global face keys
+ * (see \ref PMMG_faceComm2keys).
+ *
+ */
+static
+int PMMG_migrate_grps( PMMG_pParMesh parmesh ) {
+  PMMG_pGrp      grp;
+  MPI_Request    *request,barrier;
+  MPI_Status     status;
+  char           **buffer,*rbuffer,*discard,*ptr;
+  int            *pack_size,nsend,ngrp,flag,done,posted,count,ier,ier0,err,k;
 
-    if ( !PMMG_resize_extComm(parmesh,ext_send_comm,n,&ext_send_comm->nitem) ) {
-      ier  = MG_MIN ( ier, 0 );
-    }
-  }
-  else
-    assert ( !(*recv_ext_idx)[offset] );
+  const int      myrank = parmesh->myrank;
+  const MPI_Comm comm   = parmesh->comm;
 
-  offset++;
+  ier       = 1;
+  ngrp      = parmesh->ngrp;
+  request   = NULL;
+  buffer    = NULL;
+  pack_size = NULL;
 
-  /** Step 4: Update the faces of the external comms between sndr and another
-   * proc than myrank (flag 3) */
-  /* number of external communicators */
-  nextcomm   = (*recv_ext_idx)[offset++];
+  PMMG_MALLOC(parmesh,request,ngrp,MPI_Request,"request_tab",ier = 0);
+  PMMG_CALLOC(parmesh,buffer,ngrp,char*,"grps2send",ier = 0);
+  PMMG_MALLOC(parmesh,pack_size,ngrp,int,"pack_size",ier = 0);
 
-  /* position of the number of faces to update in each ext_comm */
-  old_offset = offset;
-  /* position of the list of faces to update */
-  offset    += 2*nextcomm;
+  /** Step 1: pack the groups to send and post the sends */
+  nsend = 0;
+  if ( ier ) {
+    for ( k=0; k<ngrp; ++k ) {
+      grp = &parmesh->listgrp[k];
+      if ( grp->flag == myrank ) continue;
+
+      pack_size[nsend] = PMMG_mpisizeof_grp(grp,parmesh->info.solPrecision);
+      PMMG_MALLOC(parmesh,buffer[nsend],pack_size[nsend],char,"grps2send",
+                  ier = 0);
+      if ( !buffer[nsend] ) {
+        /* Keep the group here */
+        grp->flag = myrank;
+        continue;
+      }
 
-  for ( n=0; n<nextcomm; ++n ) {
+      ptr = buffer[nsend];
+      PMMG_mpipack_grp(grp,parmesh->info.solPrecision,&ptr);
 
-    nitem     = (*recv_ext_idx)[old_offset++];
-    color_out = (*recv_ext_idx)[old_offset++];
+      MPI_CHECK( MPI_Issend(buffer[nsend],pack_size[nsend],MPI_CHAR,grp->flag,
+                            MPI_SENDGRP_TAG,comm,&request[nsend]), ier = 0 );
+      ++nsend;
 
-    for ( k=0; k<parmesh->next_face_comm; ++k ) {
-      ext_face_comm = &parmesh->ext_face_comm[k];
-      if ( ext_face_comm->color_out == color_out ) break;
+      PMMG_grp_free(parmesh,grp);
     }
+  }
 
-    ier0 = 1;
-    if ( k == parmesh->next_face_comm ) {
-      if ( !PMMG_resize_extCommArray ( parmesh,&parmesh->ext_face_comm,
-                                       parmesh->next_face_comm+1,
-                                       &parmesh->next_face_comm ) ) {
-        ier0 = 0;
-        ier = MG_MIN(ier,0);
-      }
+  err = PMMG_pack_grps( parmesh,&parmesh->listgrp );
+  ier = MG_MIN ( ier, err );
 
-      if ( ier0 ) {
-        ext_face_comm = &parmesh->ext_face_comm[parmesh->next_face_comm-1];
-        ext_face_comm->color_in  = myrank;
-        ext_face_comm->color_out = color_out;
+  /** Step 2: receive the groups until every processor has completed its sends */
+  posted = 0;
+  done   = 0;
+  while ( !done ) {
+    MPI_CHECK( MPI_Iprobe(MPI_ANY_SOURCE,MPI_SENDGRP_TAG,comm,&flag,&status),
+               ier = 0 );
+
+    if ( flag ) {
+      MPI_CHECK( MPI_Get_count(&status,MPI_CHAR,&count), ier = 0 );
+      PMMG_MALLOC(parmesh,rbuffer,count,char,"buffer",ier = 0);
+      if ( rbuffer ) {
+        MPI_CHECK( MPI_Recv(rbuffer,count,MPI_CHAR,status.MPI_SOURCE,
+                            MPI_SENDGRP_TAG,comm,&status), ier = 0 );
+      }
+      else {
+        /* The message has to be received to let the sender complete its
+         * send: receive it in a discard buffer (not counted in the parmesh
+         * memory), the group is lost and the failure is returned */
+        MMG5_SAFE_MALLOC(discard,count,char,);
+        MPI_CHECK( MPI_Recv(discard,discard ? count : 0,MPI_CHAR,
+                            status.MPI_SOURCE,MPI_SENDGRP_TAG,comm,&status),
+                   ier = 0 );
+        MMG5_SAFE_FREE(discard);
       }
-    }
 
-    if ( ier0 ) {
-      old_nitem = ext_face_comm->nitem;
+      ier0 = 1;
+      if ( parmesh->ngrp ) {
+        PMMG_RECALLOC(parmesh,parmesh->listgrp,parmesh->ngrp+1,parmesh->ngrp,
+                      PMMG_Grp,"listgrp",ier0 = 0;ier = 0);
+      }
+      else {
+        assert ( !parmesh->listgrp );
+        PMMG_CALLOC(parmesh,parmesh->listgrp,1,PMMG_Grp,"listgrp",
+                    ier0 = 0;ier = 0);
+      }
 
-      if ( !PMMG_resize_extComm(parmesh,ext_face_comm,old_nitem+nitem,&ext_face_comm->nitem) ) {
-        ier0 = 0;
-        ier  = MG_MIN(ier,ier0);
+      if ( ier0 && rbuffer ) {
+        ptr = rbuffer;
+        err = PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,parmesh->ngrp,&ptr);
+        ier = MG_MIN(ier,err);
+        parmesh->listgrp[parmesh->ngrp].flag = PMMG_UNSET;
+        ++parmesh->ngrp;
       }
+      PMMG_DEL_MEM(parmesh,rbuffer,char,"buffer");
     }
 
-    if ( ier0 ) {
-      for ( idx=0; idx<nitem; ++idx ) {
-        ext_face_comm->int_comm_index[old_nitem + idx] = (*recv_ext_idx)[offset++];
+    if ( !posted ) {
+      MPI_CHECK( MPI_Testall(nsend,request,&flag,MPI_STATUSES_IGNORE), ier = 0 );
+      if ( flag ) {
+        MPI_CHECK( MPI_Ibarrier(comm,&barrier), ier = 0 );
+        posted = 1;
       }
     }
-  }
-
-
-  /** Step 5: Receive the new groups */
-  MPI_CHECK ( MPI_Probe(sndr,MPI_SENDGRP_TAG,comm,&status), ier = 0 );
-  MPI_CHECK ( MPI_Get_count(&status,MPI_CHAR,&pack_size), ier = 0 );
-
-  PMMG_MALLOC ( parmesh,buffer,pack_size,char,"buffer", ier = 0 );
-
-  MPI_CHECK ( MPI_Recv(buffer,pack_size,MPI_CHAR,sndr,MPI_SENDGRP_TAG,comm,&status),
-              ier = 0 );
-
-  ier0 = 1;
-  if( ngrp ) {
-    PMMG_RECALLOC ( parmesh,parmesh->listgrp,ngrp+grpscount,ngrp,PMMG_Grp,"listgrp",
-                    ier0 = 0;ier = 0 );
-  }
-  else {
-    assert ( !parmesh->listgrp );
-    PMMG_CALLOC ( parmesh,parmesh->listgrp,grpscount,PMMG_Grp,"listgrp",
-                  ier0 = 0;ier = 0 );
-  }
-
-  if ( ier0 )
-    parmesh->ngrp += grpscount;
-
-    /* Count the available memory and update it while unpacking the received groups */
-#ifndef NDEBUG
-  for ( k=0; k<ngrp; ++k ) {
-    mesh = parmesh->listgrp[k].mesh;
-    assert ( mesh->npmax == mesh->np );
-    assert ( mesh->xpmax == mesh->xp );
-    assert ( mesh->nemax == mesh->ne );
-    assert ( mesh->xtmax == mesh->xt );
-  }
-#endif
-
-  ptr = buffer;
-  if ( ier0 ) {
-    for ( k=0; k<grpscount; ++k ) {
-      err = PMMG_mpiunpack_grp(parmesh,parmesh->listgrp,ngrp+k,&ptr);
-      ier = MG_MIN(ier,err);
-      parmesh->listgrp[ngrp+k].flag = PMMG_UNSET;
+    else {
+      MPI_CHECK( MPI_Test(&barrier,&done,MPI_STATUS_IGNORE), ier = 0 );
     }
+  }
 
+  for ( k=0; k<nsend; ++k ) {
+    PMMG_DEL_MEM(parmesh,buffer[k],char,"grps2send");
   }
+  PMMG_DEL_MEM(parmesh,pack_size,int,"pack_size");
+  PMMG_DEL_MEM(parmesh,buffer,char*,"grps2send");
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"request_tab");
 
-  PMMG_DEL_MEM ( parmesh,buffer,char,"buffer" );
   return ier;
 }
 
 /**
- * \param parmesh pointer toward the mesh structure.
- * \param sndr index of the proc that send the groups
- * \param recv index of the proc that receive the groups
- * \param interaction_map map of interactions with the other processors
- * \param called_from_distrib_mesh 1 if called for initial mesh distrib.
- * In this case do not print warnings about empty procs.
+ * \param parmesh pointer toward the parmesh structure.
+ * \param keydispl first key assigned by each processor (see \ref
+ * PMMG_faceComm2keys).
  *
- * \return 0 if fail, 1 if we success
+ * \return 0 if fail, 1 if success.
  *
- * Transfer and update the data that are modified due to the transfer of the
- * groups from the proc \a sndr toward the proc \a recv.
+ * Build the internal and external face communicators of the parmesh from the
+ * face keys stored in the group communicators:
+ *   - a key that appears twice in the local groups is an interface between 2
+ *     local groups;
+ *   - the other keys are sent to the processor that has assigned them, that
+ *     pairs the 2 processors that share the face and sends back to each one
+ *     the rank of the other.
+ * Only point-to-point messages between the processors that exchange keys are
+ * used, so the cost doesn't depend on the number of processors.
+ * The internal communicator is sorted by keys and the external communicators,
+ * sorted by increasing remote rank, list their faces by increasing keys so
+ * the 2 sides of a communicator match.
  *
  */
-static inline
-int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
-                                const int recv,int *interaction_map,
-                                int called_from_distrib_mesh) {
-
-  PMMG_pExt_comm ext_face_comm,ext_send_comm,ext_recv_comm;
+static
+int PMMG_keys2faceComm( PMMG_pParMesh parmesh,int *keydispl ) {
+  PMMG_pInt_comm int_face_comm;
+  PMMG_pExt_comm ext_face_comm;
+  PMMG_pGrp      grp;
+  PMMG_migrKey   *occ;
+  PMMG_migrItem  *item,*ritem;
+  MPI_Request    *request,barrier;
   MPI_Status     status;
-  MPI_Request    irequest,drequest;
-  MPI_Request    *trequest;
-  int            k,count,ier,ier0,*recv_ext_idx,old_nitem,idx,pack_size,err;
-  int            *intcomm_flag,nitem_intcomm_flag,nitem_recv_ext_idx;
-  char           *grps2send;
-  static int8_t  pmmgWarn = 0;
+  int            *sbuf,*rbuf,*sdest,*scnt,*sdispl,*rsrc,*rcnt,*rdispl,*discard;
+  int            nocc,nitem,nsend,nrecv,ndest,nsrc,maxsrc,maxrecv,nneigh;
+  int            flag,done,posted,count,nomem,ier,k,i,j,lo,hi,mid;
 
-  const int      myrank      = parmesh->myrank;
-  const int      nprocs      = parmesh->nprocs;
+  const int      nprocs = parmesh->nprocs;
+  const MPI_Comm comm   = parmesh->comm;
 
-  assert ( sndr != recv );
+  int_face_comm = parmesh->int_face_comm;
 
-  /* I am the receiver and I don't have any interactions with the sender */
-  if ( ( recv == myrank ) && !interaction_map[sndr] ) return 1;
+  ier   = 1;
+  occ   = NULL;
+  item  = NULL;
+  ritem = NULL;
+  request = NULL;
+  sbuf  = rbuf  = NULL;
+  sdest = scnt  = sdispl = NULL;
+  rsrc  = rcnt  = rdispl = NULL;
+  nitem = nsend = nrecv = ndest = nsrc = maxsrc = maxrecv = 0;
+
+  /** Step 1: sort the face occurences of the local groups by keys */
+  nocc = 0;
+  for ( k=0; k<parmesh->ngrp; ++k ) {
+    nocc += parmesh->listgrp[k].nitem_int_face_comm;
+  }
 
-  /* I am the sender and I don't have any interactions with the receiver */
-  if ( ( sndr == myrank ) && !interaction_map[sndr] ) return 1;
+  PMMG_MALLOC(parmesh,occ,nocc,PMMG_migrKey,"face occurences",ier = 0);
 
-  /* I am neither the sender nor the receiver and I don't have any interactions
-   * with the sender */
-  if ( ( sndr != myrank ) && ( recv != myrank )  && !interaction_map[sndr] ) return 1;
+  if ( ier ) {
+    nocc = 0;
+    for ( k=0; k<parmesh->ngrp; ++k ) {
+      grp = &parmesh->listgrp[k];
+      for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
+        occ[nocc].key = grp->face2int_face_comm_index2[i];
+        occ[nocc].grp = k;
+        occ[nocc].pos = i;
+        ++nocc;
+      }
+    }
+    qsort(occ,nocc,sizeof(PMMG_migrKey),PMMG_migr_compKey);
+
+    /* Number the distinct keys and count the faces that are not shared by 2
+     * local groups */
+    for ( i=0; i<nocc; ++i ) {
+      if ( i && occ[i].key == occ[i-1].key ) continue;
+      ++nitem;
+      if ( i+1==nocc || occ[i+1].key != occ[i].key ) ++nsend;
+    }
+    PMMG_MALLOC(parmesh,item,nsend,PMMG_migrItem,"faces to pair",ier = 0);
+  }
 
-  ier = 1;
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
 
-  /** Step 1: find the myrank-sndr and myrank-recv external communicators */
-  ext_send_comm = NULL;
-  ext_recv_comm = NULL;
+  nitem = nsend = 0;
+  for ( i=0; i<nocc; ++i ) {
+    if ( !i || occ[i].key != occ[i-1].key ) ++nitem;
 
-  for ( k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
+    grp = &parmesh->listgrp[occ[i].grp];
+    grp->face2int_face_comm_index2[occ[i].pos] = nitem-1;
 
-    if ( ext_face_comm->color_out == sndr )
-      ext_send_comm = ext_face_comm;
-    else if ( ext_face_comm->color_out == recv )
-      ext_recv_comm = ext_face_comm;
-  }
+    if ( (i && occ[i].key == occ[i-1].key) ||
+         (i+1<nocc && occ[i+1].key == occ[i].key) ) continue;
 
+    /* Processor that has assigned the key */
+    lo = 0;
+    hi = nprocs-1;
+    while ( lo < hi ) {
+      mid = (lo+hi+1)/2;
+      if ( keydispl[mid] <= occ[i].key ) lo = mid;
+      else hi = mid-1;
+    }
+    item[nsend].key  = occ[i].key;
+    item[nsend].rank = lo;
+    item[nsend].idx  = nitem-1;
+    ++nsend;
+  }
+  int_face_comm->nitem = nitem;
 
-  /** Step 2: transfer and update the data */
-  nitem_intcomm_flag = 0;
-  nitem_recv_ext_idx = 0;
-  intcomm_flag = NULL;
-  recv_ext_idx = NULL;
-  trequest     = NULL;
+  /** Step 2: send the unpaired keys toward the processors that have assigned
+   * them: the processors only know to whom they send, so the keys are received
+   * by probing the incoming messages until every processor has completed its
+   * sends (same non-blocking consensus as in \ref PMMG_migrate_grps) */
+  qsort(item,nsend,sizeof(PMMG_migrItem),PMMG_migr_compItemRank);
 
-  if ( myrank == sndr ) {
-    /* j = recv */
-    ier = PMMG_transfer_grps_fromMetoJ(parmesh,recv,interaction_map,
-                                       &intcomm_flag,&nitem_intcomm_flag,
-                                       &recv_ext_idx,&nitem_recv_ext_idx,
-                                       ext_recv_comm,&grps2send,&pack_size,
-                                       &irequest,&drequest,&trequest);
+  ndest = 0;
+  for ( i=0; i<nsend; ++i ) {
+    if ( !i || item[i].rank != item[i-1].rank ) ++ndest;
   }
-  else if ( myrank == recv ) {
-    /* i = sndr */
-    ier = PMMG_transfer_grps_fromItoMe(parmesh,sndr,interaction_map,
-                                       &intcomm_flag,&nitem_intcomm_flag,
-                                       &recv_ext_idx,&nitem_recv_ext_idx,
-                                       ext_send_comm,&irequest);
+
+  PMMG_MALLOC(parmesh,sdest,ndest,int,"sdest",ier = 0);
+  PMMG_MALLOC(parmesh,scnt,ndest,int,"scnt",ier = 0);
+  PMMG_MALLOC(parmesh,sdispl,ndest,int,"sdispl",ier = 0);
+  PMMG_MALLOC(parmesh,sbuf,nsend,int,"sbuf",ier = 0);
+  PMMG_MALLOC(parmesh,request,ndest,MPI_Request,"request_tab",ier = 0);
+
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
+
+  ndest = 0;
+  for ( i=0; i<nsend; ++i ) {
+    if ( !i || item[i].rank != item[i-1].rank ) {
+      sdest[ndest]  = item[i].rank;
+      sdispl[ndest] = i;
+      scnt[ndest]   = 0;
+      ++ndest;
+    }
+    ++scnt[ndest-1];
+    sbuf[i] = item[i].key;
   }
-  else {
-    /* Transfer the faces of external communicators between the sender and a
-     * processor other than the receiver (intcomm_flag = 3): When proc sndr
-     * send groups to proc recv, the groups faces must be moved from the
-     * external communicator myrank-sndr toward the external communicator
-     * myrank-recv. */
-    nitem_recv_ext_idx = 0;
-    if ( ext_send_comm && ext_send_comm->nitem > 0 ) {
-      nitem_recv_ext_idx = ext_send_comm->nitem;
-      PMMG_MALLOC(parmesh,recv_ext_idx,nitem_recv_ext_idx,int,"recv_ext_idx",
-                  ier=0);
-      MPI_CHECK( MPI_Recv( recv_ext_idx,nitem_recv_ext_idx,MPI_INT,sndr,
-                           MPI_TRANSFER_GRP_TAG+30,parmesh->comm,&status ),
-                 ier = MG_MIN(ier,0) );
-
-      count = 0;
-      for ( k=0; k<ext_send_comm->nitem; ++k ) {
-        if ( PMMG_UNSET == recv_ext_idx[k] ) {
-          ++count;
-        }
-      }
 
-      ier0 = 1;
-      if ( !ext_recv_comm ) {
-        /* Enlarge the list of external communicators */
-        if ( !PMMG_resize_extCommArray ( parmesh,&parmesh->ext_face_comm,
-                                         parmesh->next_face_comm+1,
-                                         &parmesh->next_face_comm ) ) {
-          if ( !pmmgWarn ) {
-            pmmgWarn = 1;
-            fprintf(stderr,"  ## Error: %s: unable to resize the array of external"
-                    " communicators\n",__func__);
-          }
-          ier0 = 0;
-          ier  = MG_MIN(ier,ier0);
-        }
+  for ( k=0; k<ndest; ++k ) {
+    MPI_CHECK( MPI_Issend(&sbuf[sdispl[k]],scnt[k],MPI_INT,sdest[k],
+                          MPI_FACEKEYS_TAG,comm,&request[k]), ier = 0 );
+  }
 
-        if ( ier0 ) {
-          ext_recv_comm = &parmesh->ext_face_comm[parmesh->next_face_comm-1];
-          ext_recv_comm->color_in  = myrank;
-          ext_recv_comm->color_out = recv;
+  posted = 0;
+  done   = 0;
+  nomem  = 0;
+  while ( !done ) {
+    MPI_CHECK( MPI_Iprobe(MPI_ANY_SOURCE,MPI_FACEKEYS_TAG,comm,&flag,&status),
+               ier = 0 );
 
-          /* The pointer toward ext_send_comm may be corrupted */
-          for ( k=0; k<parmesh->next_face_comm; ++k ) {
-            ext_face_comm = &parmesh->ext_face_comm[k];
+    if ( flag ) {
+      MPI_CHECK( MPI_Get_count(&status,MPI_INT,&count), ier = 0 );
 
-            if ( ext_face_comm->color_out == sndr )
-              ext_send_comm = ext_face_comm;
-          }
-        }
+      if ( !nomem && nsrc == maxsrc ) {
+        lo = MG_MAX(2*maxsrc,4);
+        PMMG_REALLOC(parmesh,rsrc,lo,maxsrc,int,"rsrc",nomem = 1);
+        PMMG_REALLOC(parmesh,rcnt,lo,maxsrc,int,"rcnt",nomem = 1);
+        PMMG_REALLOC(parmesh,rdispl,lo,maxsrc,int,"rdispl",nomem = 1);
+        maxsrc = lo;
+      }
+      if ( !nomem && nrecv+count > maxrecv ) {
+        lo = MG_MAX(2*maxrecv,nrecv+count);
+        PMMG_REALLOC(parmesh,rbuf,lo,maxrecv,int,"rbuf",nomem = 1);
+        maxrecv = lo;
       }
 
-      if ( ier0 ) {
-        old_nitem = ext_recv_comm->nitem;
-        if ( !PMMG_resize_extComm(parmesh,ext_recv_comm,old_nitem+count,
-                                  &ext_recv_comm->nitem) ) {
-          if ( !pmmgWarn ) {
-            pmmgWarn = 1;
-            fprintf(stderr,"  ## Error: %s: unable to resize at least one external"
-                    " communicator\n",__func__);
-          }
-          ier0 = 0;
-          ier  = MG_MIN(ier,ier0);
+      if ( nomem ) {
+        /* The message has to be received to let the sender reach the
+         * barrier: receive it in a discard buffer (not counted in the parmesh
+         * memory), the failure is reduced after the exchange */
+        if ( ier ) {
+          fprintf(stderr,"\n  ## Error: %s: rank %d: unable to receive the face"
+                  " keys.\n",__func__,parmesh->myrank);
         }
+        ier = 0;
+        MMG5_SAFE_MALLOC(discard,count,int,);
+        MPI_CHECK( MPI_Recv(discard,discard ? count : 0,MPI_INT,
+                            status.MPI_SOURCE,MPI_FACEKEYS_TAG,comm,
+                            MPI_STATUS_IGNORE), ier = 0 );
+        MMG5_SAFE_FREE(discard);
+      }
+      else {
+        MPI_CHECK( MPI_Recv(&rbuf[nrecv],count,MPI_INT,status.MPI_SOURCE,
+                            MPI_FACEKEYS_TAG,comm,MPI_STATUS_IGNORE), ier = 0 );
+        rsrc[nsrc]   = status.MPI_SOURCE;
+        rcnt[nsrc]   = count;
+        rdispl[nsrc] = nrecv;
+        nrecv       += count;
+        ++nsrc;
+      }
+    }
 
-        count = 0;
-        if ( ier0 ) {
-          for ( k=0; k<ext_send_comm->nitem; ++k ) {
-            idx = ext_send_comm->int_comm_index[k];
-            if ( PMMG_UNSET == recv_ext_idx[k] ) {
-              /* Add the face to the external communicator myrank-recv */
-              ext_recv_comm->int_comm_index[old_nitem++] = idx;
-            }
-            else {
-              /* Remove the face from the external communicator myrank-sndr */
-              ext_send_comm->int_comm_index[count++] = idx;
-            }
-          }
-        }
-        if ( !PMMG_resize_extComm(parmesh,ext_send_comm,count,
-                                  &ext_send_comm->nitem) ) {
-          ier0 = 0;
-          ier  = MG_MIN(ier,ier0);
-        }
+    if ( !posted ) {
+      MPI_CHECK( MPI_Testall(ndest,request,&flag,MPI_STATUSES_IGNORE), ier = 0 );
+      if ( flag ) {
+        MPI_CHECK( MPI_Ibarrier(comm,&barrier), ier = 0 );
+        posted = 1;
       }
-      PMMG_DEL_MEM(parmesh,recv_ext_idx,int,"recv_ext_idx");
+    }
+    else {
+      MPI_CHECK( MPI_Test(&barrier,&done,MPI_STATUS_IGNORE), ier = 0 );
     }
   }
 
+  PMMG_MALLOC(parmesh,ritem,nrecv,PMMG_migrItem,"received faces",ier = 0);
+  PMMG_REALLOC(parmesh,request,ndest+nsrc,ndest,MPI_Request,"request_tab",
+               ier = 0);
 
-  /** Step 3: Wait for the end of the MPI communications */
-  if ( myrank == sndr) {
-    MPI_CHECK( MPI_Waitall(nprocs,trequest,MPI_STATUSES_IGNORE), return 0 );
-    PMMG_DEL_MEM ( parmesh, trequest,MPI_Request,"request_tab" );
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) goto end;
+
+  /** Step 3: pair the received keys and send back the rank of the other
+   * sharer of each face (the senders know from whom they wait an answer) */
+  for ( k=0; k<nsrc; ++k ) {
+    for ( i=rdispl[k]; i<rdispl[k]+rcnt[k]; ++i ) {
+      ritem[i].key  = rbuf[i];
+      ritem[i].rank = rsrc[k];
+      ritem[i].idx  = i;
+    }
+  }
+  qsort(ritem,nrecv,sizeof(PMMG_migrItem),PMMG_migr_compItemKey);
 
-    MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
-    MPI_CHECK( MPI_Wait(&drequest,&status), return 0 );
+  for ( i=0; i<nrecv; ++i ) {
+    if ( i+1<nrecv && ritem[i+1].key == ritem[i].key ) {
+      rbuf[ritem[i].idx]   = ritem[i+1].rank;
+      rbuf[ritem[i+1].idx] = ritem[i].rank;
+      ++i;
+    }
+    else {
+      /* Unpaired face: the face communicators were not consistent */
+      rbuf[ritem[i].idx] = PMMG_UNSET;
+      ier = 0;
+    }
+  }
 
-    /* Free the memory */
-    PMMG_DEL_MEM ( parmesh,grps2send,char,"grps2send" );
+  for ( k=0; k<ndest; ++k ) {
+    MPI_CHECK( MPI_Irecv(&sbuf[sdispl[k]],scnt[k],MPI_INT,sdest[k],
+                         MPI_FACEKEYS_REPLY_TAG,comm,&request[k]), ier = 0 );
   }
-  else if ( myrank == recv ) {
-    MPI_CHECK( MPI_Wait(&irequest,&status), return 0 );
+  for ( k=0; k<nsrc; ++k ) {
+    MPI_CHECK( MPI_Isend(&rbuf[rdispl[k]],rcnt[k],MPI_INT,rsrc[k],
+                         MPI_FACEKEYS_REPLY_TAG,comm,&request[ndest+k]),
+               ier = 0 );
   }
+  MPI_CHECK( MPI_Waitall(ndest+nsrc,request,MPI_STATUSES_IGNORE), ier = 0 );
 
-  /** Step 4: pack the groups and face communicators */
-  err = PMMG_pack_grps( parmesh,&parmesh->listgrp);
-  ier = MG_MIN ( ier, err );
-  if ( (!parmesh->ngrp) && parmesh->ddebug && (!called_from_distrib_mesh) ) {
-    fprintf(stderr,"  ## Warning: %s: rank %d: processor without any groups.\n",
-            __func__,myrank);
+  MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to pair the parallel faces.\n",
+            __func__);
+    goto end;
   }
 
-  if ( ier ) {
-    /* Pack the face communicators */
-    err = PMMG_pack_faceCommunicators(parmesh);
-    ier = MG_MIN ( ier, err );
+  /** Step 4: build the external communicators */
+  for ( i=0; i<nsend; ++i ) {
+    item[i].rank = sbuf[i];
   }
+  qsort(item,nsend,sizeof(PMMG_migrItem),PMMG_migr_compItemRank);
 
-  PMMG_DEL_MEM ( parmesh,intcomm_flag,int,"intcomm_flag" );
-  PMMG_DEL_MEM ( parmesh,recv_ext_idx,int,"recv_ext_idx" );
+  nneigh = 0;
+  for ( i=0; i<nsend; ++i ) {
+    if ( !i || item[i].rank != item[i-1].rank ) ++nneigh;
+  }
 
-  for ( k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
-    if ( ext_face_comm->itosend ) {
-      PMMG_DEL_MEM ( parmesh,ext_face_comm->itosend,int,"itosend" );
+  assert ( !parmesh->next_face_comm && !parmesh->ext_face_comm );
+  PMMG_CALLOC(parmesh,parmesh->ext_face_comm,nneigh,PMMG_Ext_comm,
+              "ext face comm",ier = 0;goto end);
+  parmesh->next_face_comm = nneigh;
+
+  k = -1;
+  for ( i=0; i<nsend; i=j ) {
+    for ( j=i; j<nsend && item[j].rank == item[i].rank; ++j ) ;
+
+    ext_face_comm = &parmesh->ext_face_comm[++k];
+    ext_face_comm->color_in  = parmesh->myrank;
+    ext_face_comm->color_out = item[i].rank;
+
+    PMMG_MALLOC(parmesh,ext_face_comm->int_comm_index,j-i,int,"int_comm_index",
+                ier = 0);
+    if ( !ext_face_comm->int_comm_index ) break;
+    ext_face_comm->nitem = j-i;
+
+    for ( lo=i; lo<j; ++lo ) {
+      ext_face_comm->int_comm_index[lo-i] = item[lo].idx;
     }
   }
 
+end:
+  PMMG_DEL_MEM(parmesh,ritem,PMMG_migrItem,"received faces");
+  PMMG_DEL_MEM(parmesh,rbuf,int,"rbuf");
+  PMMG_DEL_MEM(parmesh,sbuf,int,"sbuf");
+  PMMG_DEL_MEM(parmesh,item,PMMG_migrItem,"faces to pair");
+  PMMG_DEL_MEM(parmesh,request,MPI_Request,"request_tab");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,rcnt,int,"rcnt");
+  PMMG_DEL_MEM(parmesh,rsrc,int,"rsrc");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,scnt,int,"scnt");
+  PMMG_DEL_MEM(parmesh,sdest,int,"sdest");
+  PMMG_DEL_MEM(parmesh,occ,PMMG_migrKey,"face occurences");
+
   return ier;
 }
 
@@ -1830,8 +1840,8 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
  * \param parmesh pointer toward the mesh structure.
  * \param part pointer toward the metis array containing the partitions.
  * \param called_from_distrib_mesh 1 if function is called from the
- * distributedmesh one. In this case we don't want to build the interaction map
- * (no interactions).
+ * distributedmesh one. In this case we don't warn about the processors without
+ * groups.
  *
  * \return 0 if fail but we can try to save a mesh, -1 if we fail and are unable
  * to save the mesh, 1 if we success
@@ -1839,38 +1849,23 @@ int PMMG_transfer_grps_fromItoJ(PMMG_pParMesh parmesh,const int sndr,
  * Send the suitable groups to other procs and recieve their groups.
  * Deallocate the \a part array.
  *
+ * The face communicators are first translated into global face keys so the
+ * groups can be moved concurrently by all the processors (no ordering of the
+ * transfers), then the face communicators are rebuilt from the keys.
+ *
  */
 int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_distrib_mesh) {
   PMMG_pGrp      grp;
   MPI_Comm       comm;
   int            myrank,nprocs;
-  int            ninteractions,*interaction_map,*interactions;
-  int            *send_grps,*recv_grps,*nfaces2send,*nfaces2recv;
-  int            *next_comm2send,*ext_comms_next_idx,*nitems2send;
-  int            *extComm_next_idx,*items_next_idx,*recv_array;
-  int            *extComm_grpFaces2extComm,*extComm_grpFaces2face2int;
-  int            max_ngrp;
-  int            ier,k,i,j,err;
+  int            *keydispl;
+  int            ier,k,j,err;
 
   myrank    = parmesh->myrank;
   nprocs    = parmesh->nprocs;
   comm      = parmesh->comm;
-  max_ngrp  = 0;
-
-  send_grps                 = NULL;
-  recv_grps                 = NULL;
-  nfaces2send               = NULL;
-  nfaces2recv               = NULL;
-  next_comm2send            = NULL;
-  ext_comms_next_idx        = NULL;
-  nitems2send               = NULL;
-  items_next_idx            = NULL;
-  extComm_next_idx          = NULL;
-  extComm_grpFaces2extComm  = NULL;
-  extComm_grpFaces2face2int = NULL;
-  recv_array                = NULL;
-  interaction_map           = NULL;
-  interactions              = NULL;
+
+  keydispl  = NULL;
 
   /** Step 1: Merge all the groups that must be sended to a given proc into 1
    * group */
@@ -1889,6 +1884,8 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
   }
   PMMG_DEL_MEM(parmesh,part,idx_t,"parmetis partition");
 
+  PMMG_MALLOC(parmesh,keydispl,nprocs,int,"keydispl",ier = -1);
+
   MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
 
   if ( ier < 0 ) {
@@ -1901,56 +1898,34 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
             " partition. Try to send it nevertheless.\n",__func__);
   }
 
-  /** Step 2: Nodal communicators deletion (unallocation to remove, at least for
-   * the external communicators) */
-  PMMG_node_comm_free(parmesh);
-
-  /** Step 3: Compute the map of interactions, if fail, consider that each proc
-   * interacts with all the other procs (worst case)
-   */
-  if ( (!called_from_distrib_mesh) && parmesh->nprocs > 2 ) {
-    ninteractions = PMMG_interactionMap(parmesh,&interactions,&interaction_map);
-  }
-  else {
-    ninteractions = -1;
-  }
-
-  if ( ninteractions <= 0 ) {
-    PMMG_DEL_MEM ( parmesh, interactions, int, "interactions");
-    if ( !interaction_map ) {
-      PMMG_CALLOC ( parmesh,interaction_map,nprocs,int,"interaction_map" ,ier=0 );
-    }
-    for ( k=0; k<nprocs; ++k ) {
-      interaction_map[k] = 1;
+  /** Step 2: Replace the node communicators by global node keys (the nodal
+   * communicators are deleted, only the keys are kept in the groups) */
+  if ( !PMMG_nodeComm2keys(parmesh) ) {
+    if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
+      fprintf(stdout,"       unable to compute the global node keys:"
+              " node communicators will be rebuilt from coordinates.\n");
     }
   }
 
-  /** Step 4: proc k send its data (group and/or communicators), proc j receive
-   * data */
-  ier = 1;
+  /** Step 3: Replace the face communicators by global face keys */
+  ier = PMMG_faceComm2keys(parmesh,keydispl);
 
-  if ( interactions ) {
-    for ( k=0; k<ninteractions; ++k ) {
-      i = interactions[2*k];
-      j = interactions[2*k+1];
-      if ( i==j ) {
-        continue;
-      }
-      err =  PMMG_transfer_grps_fromItoJ(parmesh,i,j,interaction_map,called_from_distrib_mesh);
-      ier = MG_MIN ( ier,err );
-    }
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to compute the global keys of"
+            " the parallel faces.\n",__func__);
+    ier = -1;
+    goto end;
   }
-  else {
-    for ( k=0; k<nprocs; ++k ) {
-      for ( j=0; j<nprocs; ++j ) {
-        if ( j==k ) {
-          continue;
-        }
-        err =  PMMG_transfer_grps_fromItoJ(parmesh,k,j,interaction_map,called_from_distrib_mesh);
-        ier = MG_MIN ( ier,err );
-      }
-    }
+
+  /** Step 4: Every proc sends its groups and receives the groups of the
+   * others */
+  ier = PMMG_migrate_grps(parmesh);
+
+  if ( (!parmesh->ngrp) && parmesh->ddebug && (!called_from_distrib_mesh) ) {
+    fprintf(stderr,"  ## Warning: %s: rank %d: processor without any groups.\n",
+            __func__,myrank);
   }
+
   MPI_Allreduce( MPI_IN_PLACE, &ier, 1, MPI_INT, MPI_MIN, comm);
 
   if ( ier <= 0 ) {
@@ -1960,6 +1935,14 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
     goto end;
   }
 
+  /** Step 5: Face communicators reconstruction from the face keys */
+  if ( !PMMG_keys2faceComm(parmesh,keydispl) ) {
+    fprintf(stderr,"\n  ## Error: %s: unable to build the new face"
+            " communicators.\n",__func__);
+    ier = -1;
+    goto end;
+  }
+
   /** Step 6: Node communicators reconstruction from the face ones */
   if ( !PMMG_build_nodeCommFromFaces(parmesh) ) {
     fprintf(stderr,"\n  ## Unable to build the new node communicators from"
@@ -1977,53 +1960,47 @@ int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int called_from_dis
 #endif
 
   /** Success */
-  if ( !err )  ier = 1;
+  ier = 1;
 
 end:
-  if ( interaction_map )
-    PMMG_DEL_MEM(parmesh,interaction_map,int,"interaction_map");
-  if ( interactions )
-    PMMG_DEL_MEM(parmesh,interactions,int,"interactions");
-
-  if ( send_grps )
-    PMMG_DEL_MEM(parmesh,send_grps,int,"send_grps");
-  if ( recv_grps )
-    PMMG_DEL_MEM(parmesh,recv_grps,int,"recv_grps");
+  if ( keydispl )
+    PMMG_DEL_MEM(parmesh,keydispl,int,"keydispl");
+
   if ( parmesh->int_face_comm->intvalues ) {
     PMMG_DEL_MEM(parmesh,parmesh->int_face_comm->intvalues,
                  int,"intvalues");
   }
-  if ( recv_array )
-    PMMG_DEL_MEM(parmesh,recv_array,int,"recv_array");
-
-  /* Arrays allocated in fill_extFaceComm2send */
-  if ( nfaces2send )
-    PMMG_DEL_MEM(parmesh,nfaces2send,int,"nfaces2send");
-  if ( nfaces2recv )
-    PMMG_DEL_MEM(parmesh,nfaces2recv,int,"nfaces2recv");
-
-  if ( extComm_next_idx )
-    PMMG_DEL_MEM(parmesh,extComm_next_idx,int,
-                 "positions of the external comms in pos_grp_faces* arrays");
-  if ( extComm_grpFaces2extComm )
-    PMMG_DEL_MEM(parmesh,extComm_grpFaces2extComm,
-                 int,"extComm_grpFaces2extComm");
-  if ( extComm_grpFaces2face2int )
-    PMMG_DEL_MEM(parmesh,extComm_grpFaces2face2int,
-                 int,"extComm_grpFaces2face2int");
-
-  if ( next_comm2send )
-    PMMG_DEL_MEM(parmesh,next_comm2send,int,"next_comm2send");
-  if ( nitems2send )
-    PMMG_DEL_MEM(parmesh,nitems2send,int,"nitems2send");
-  if ( ext_comms_next_idx )
-    PMMG_DEL_MEM(parmesh,ext_comms_next_idx,int,"ext_comms_next_idx");
-  if ( items_next_idx )
-    PMMG_DEL_MEM(parmesh,items_next_idx,int,"items_next_idx");
 
   return ier;
 }
 
+/**
+ * \param parmesh pointer toward the mesh structure.
+ *
+ * \return 1 if the group partition of the current iteration is computed in
+ * background by the partitioner processes, 0 otherwise.
+ *
+ * In this case, the element qualities in the interpolated metrics are computed
+ * by \ref PMMG_distribute_grps while the partition is computed.
+ *
+ * \remark The partitioned graph is the graph of the groups built by the load
+ * balancing (after the metric interpolation), so the interpolation and the
+ * analysis can't be overlapped: only the quality computation is hidden behind
+ * the partitioning.
+ *
+ */
+int PMMG_asyncPartitioning( PMMG_pParMesh parmesh ) {
+
+  if ( !parmesh->info.npartitioners || parmesh->nprocs < 2 ) return 0;
+
+  if ( parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_parmetis )
+    return 0;
+
+  if ( parmesh->iter == PMMG_niter_eff(parmesh)-1 )
+    return !parmesh->info.nobalancing;
+
+  return parmesh->info.repartitioning == PMMG_REDISTRIBUTION_graph_balancing;
+}
 
 /**
  * \param parmesh pointer toward the mesh structure.
@@ -2036,8 +2013,9 @@ end:
  *
  */
 int PMMG_distribute_grps( PMMG_pParMesh parmesh ) {
-  idx_t *part;
-  int   ngrp,ier;
+  PMMG_partRequest partreq;
+  idx_t            *part;
+  int              ngrp,ier;
 
   MPI_Allreduce( &parmesh->ngrp, &ngrp, 1, MPI_INT, MPI_MIN, parmesh->comm);
 
@@ -2069,7 +2047,17 @@ int PMMG_distribute_grps( PMMG_pParMesh parmesh ) {
     case PMMG_LOADBALANCING_metis:
     default:
 
-      ier = PMMG_part_parmeshGrps2metis(parmesh,part,parmesh->nprocs);
+      if ( PMMG_asyncPartitioning(parmesh) ) {
+        /* Compute the element qualities while the partitioners compute the
+         * partition */
+        ier = PMMG_part_parmeshGrps2metis_start(parmesh,part,parmesh->nprocs,
+                                                &partreq);
+        if ( !PMMG_tetraQual( parmesh,1 ) ) ier = 0;
+        ier = PMMG_part_parmeshGrps2metis_wait(parmesh,part,&partreq,ier);
+      }
+      else {
+        ier = PMMG_part_parmeshGrps2metis(parmesh,part,parmesh->nprocs);
+      }
       break;
     }
   }
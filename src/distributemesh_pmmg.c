@@ -1098,6 +1098,169 @@ unalloc:
   return ieresult==1;
 }
 
+#define PMMG_PART_MAGIC   "PMMGPRT"
+#define PMMG_PART_VERSION 1
+
+/** Number of integers stored in the partition file header */
+#define PMMG_PART_NHEAD   5
+
+/**
+ * \param mesh pointer toward the mesh structure.
+ *
+ * \return a hash of the tetrahedra connectivity.
+ *
+ * Signature of the mesh stored in the partition file to detect that the
+ * partition belongs to another mesh with the same number of elements.
+ *
+ */
+static
+uint32_t PMMG_part_meshSignature( MMG5_pMesh mesh ) {
+  uint64_t h;
+  int      k,i;
+
+  h = 14695981039346656037ULL;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    for ( i=0; i<4; ++i ) {
+      h = ( h ^ (uint64_t)mesh->tetra[k].v[i] ) * 1099511628211ULL;
+    }
+  }
+  return (uint32_t)( h ^ (h >> 32) );
+}
+
+/**
+ * \param parmesh pointer toward a PMMG parmesh structure.
+ * \param filename name of the partition file.
+ * \param part array of size mesh->ne to fill with the partition.
+ *
+ * \return 1 if the partition has been read, 0 if the file is missing or doesn't
+ * match the mesh (the partition has to be computed).
+ *
+ * Read on the root process the initial partition saved by a previous run
+ * (\ref PMMG_savePartition). The partition is used only if it has been
+ * computed for the same mesh and the same number of processes.
+ *
+ */
+static
+int PMMG_loadPartition( PMMG_pParMesh parmesh,const char *filename,idx_t *part ) {
+  MMG5_pMesh mesh;
+  FILE       *inm;
+  char       magic[8];
+  int        head[PMMG_PART_NHEAD],*buf,*count,k,ier;
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  inm = fopen(filename,"rb");
+  if ( !inm ) {
+    return 0;
+  }
+
+  ier = ( fread(magic,sizeof(char),8,inm) == 8 &&
+          fread(head,sizeof(int),PMMG_PART_NHEAD,inm) == PMMG_PART_NHEAD );
+
+  if ( ier && ( strncmp(magic,PMMG_PART_MAGIC,8) ||
+                head[0] != PMMG_PART_VERSION ) ) {
+    if ( parmesh->info.imprim > PMMG_VERB_NO ) {
+      fprintf(stderr,"\n  ## Warning: %s: %s is not a valid partition file.\n",
+              __func__,filename);
+    }
+    ier = 0;
+  }
+
+  if ( ier && ( head[1] != parmesh->nprocs || head[2] != mesh->np ||
+                head[3] != mesh->ne ||
+                (uint32_t)head[4] != PMMG_part_meshSignature(mesh) ) ) {
+    /* Partition of another mesh or for another number of processes */
+    ier = 0;
+  }
+
+  buf = count = NULL;
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,buf,mesh->ne,int,"partition",ier = 0);
+    PMMG_CALLOC(parmesh,count,parmesh->nprocs,int,"partition count",ier = 0);
+  }
+  if ( ier ) {
+    ier = ( fread(buf,sizeof(int),mesh->ne,inm) == (size_t)mesh->ne );
+  }
+  if ( ier ) {
+    for ( k=0; k<mesh->ne; ++k ) {
+      if ( buf[k] < 0 || buf[k] >= parmesh->nprocs ) {
+        ier = 0;
+        break;
+      }
+      ++count[buf[k]];
+      part[k] = buf[k];
+    }
+    /* Each process must receive elements */
+    for ( k=0; ier && k<parmesh->nprocs; ++k ) {
+      if ( !count[k] ) ier = 0;
+    }
+  }
+  fclose(inm);
+
+  PMMG_DEL_MEM(parmesh,buf,int,"partition");
+  PMMG_DEL_MEM(parmesh,count,int,"partition count");
+
+  if ( ier && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"\n       initial partition read from %s\n",filename);
+  }
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward a PMMG parmesh structure.
+ * \param filename name of the partition file.
+ * \param part partition of the elements (size mesh->ne).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Save on the root process the initial partition of the mesh (the process, and
+ * so the group, of each element) to reuse it in next runs on the same mesh.
+ *
+ */
+static
+int PMMG_savePartition( PMMG_pParMesh parmesh,const char *filename,idx_t *part ) {
+  MMG5_pMesh mesh;
+  FILE       *inm;
+  int        head[PMMG_PART_NHEAD],*buf,k,ier;
+
+  mesh = parmesh->listgrp[0].mesh;
+
+  head[0] = PMMG_PART_VERSION;
+  head[1] = parmesh->nprocs;
+  head[2] = mesh->np;
+  head[3] = mesh->ne;
+  head[4] = (int)PMMG_part_meshSignature(mesh);
+
+  PMMG_MALLOC(parmesh,buf,mesh->ne,int,"partition",return 0);
+  for ( k=0; k<mesh->ne; ++k ) {
+    buf[k] = (int)part[k];
+  }
+
+  inm = fopen(filename,"wb");
+  if ( !inm ) {
+    fprintf(stderr,"  ## Error: %s: unable to open file %s.\n",__func__,filename);
+    PMMG_DEL_MEM(parmesh,buf,int,"partition");
+    return 0;
+  }
+
+  ier = ( fwrite(PMMG_PART_MAGIC,sizeof(char),8,inm) == 8 &&
+          fwrite(head,sizeof(int),PMMG_PART_NHEAD,inm) == PMMG_PART_NHEAD &&
+          fwrite(buf,sizeof(int),mesh->ne,inm) == (size_t)mesh->ne );
+  ier = ( !fclose(inm) && ier );
+
+  PMMG_DEL_MEM(parmesh,buf,int,"partition");
+
+  if ( !ier ) {
+    fprintf(stderr,"  ## Error: %s: unable to write file %s.\n",__func__,filename);
+  }
+  else if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"\n       initial partition saved in %s\n",filename);
+  }
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward a PMMG parmesh structure.
  * \param part pointer toward the metis array containing the partitions.
@@ -1136,10 +1299,19 @@ int PMMG_distribute_mesh( PMMG_pParMesh parmesh )
     /* Call metis, or recover a custom partitioning if provided (only to debug
      * the interface displacement, adaptation will be blocked) */
     if( !PMMG_PREDEF_PART ) {
-      if ( !PMMG_part_meshElts2metis( parmesh, part, parmesh->nprocs ) ) {
-        ier = 5;
+      /* Reuse the partition of a previous run on the same mesh if any */
+      if ( !( parmesh->partname && ier == 1 &&
+              PMMG_loadPartition( parmesh,parmesh->partname,part ) ) ) {
+        if ( !PMMG_part_meshElts2metis( parmesh, part, parmesh->nprocs ) ) {
+          ier = 5;
+        }
+        if( !PMMG_fix_contiguity_centralized( parmesh,part ) ) ier = 5;
+
+        /* A failure to save the partition is not fatal */
+        if ( parmesh->partname && ier == 1 ) {
+          PMMG_savePartition( parmesh,parmesh->partname,part );
+        }
       }
-      if( !PMMG_fix_contiguity_centralized( parmesh,part ) ) ier = 5;
     } else {
       int k;
       for( k = 1; k <= mesh->ne; k++ ) {
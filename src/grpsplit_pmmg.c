@@ -58,140 +58,18 @@ static int PMMG_howManyGroups ( const int nelem, const int target_mesh_size )
 
 
 /**
- * \param to       mesh to copy xtetra item to
- * \param from     mesh to copy xtetra item from
- * \param location location of xtetra to copy in original mesh
+ * \struct PMMG_splitSizes
  *
- * \return 1 if tetra is successfully appended
- *         0 if tetra is not successfully appended
+ * \brief Exact sizes of a group created by the group splitting.
  *
- *  Append a tetraedron to the mesh, increasing the array if the allocated
- *  array is not big enough.
  */
-static int PMMG_xtetraAppend( MMG5_pMesh to, MMG5_pMesh from, int location )
-{
-  int newsize;
-
-  /* Adjust the value of scale to reallocate memory more or less agressively */
-  const float scale = 2.f;
-  if ( (to->xt + 1) >= to->xtmax ) {
-    newsize = MG_MAX(scale*to->xtmax,to->xtmax+1);
-    PMMG_REALLOC(to, to->xtetra, newsize+1, to->xtmax+1,MMG5_xTetra,
-                  "larger xtetra table",return 0);
-    to->xtmax = newsize;
-  }
-  ++to->xt;
-  memcpy( &to->xtetra[ to->xt ],
-          &from->xtetra[ from->tetra[ location ].xt ], sizeof(MMG5_xTetra) );
-  return 1;
-}
-
-/**
- * \param to       mesh to copy xpoint item to
- * \param from     mesh to copy xpoint item from
- * \param location location of xpoint to copy in original mesh
- * \param point    xpoint's number in tetrahedron
- *
- * \return 1 if tetra is successfully appended
- *         0 if tetra is not successfully appended
- *
- *  Append a point in the point list, increasing the array if the allocated
- *  array is not big enough.
- */
-static int PMMG_xpointAppend( MMG5_pMesh to, MMG5_pMesh from, int tetrahedron, int point )
-{
-  int newsize;
-
-  // Adjust the value of scale to reallocate memory more or less agressively
-  const float scale = 2.f;
-  if ( (to->xp + 1) >= to->xpmax + 1 ) {
-    newsize = MG_MAX(scale*to->xpmax,to->xpmax+1);
-    PMMG_RECALLOC(to, to->xpoint, newsize+1, to->xpmax+1,MMG5_xPoint,
-                  "larger xpoint table",return 0);
-    to->xpmax = newsize;
-  }
-  ++to->xp;
-  memcpy( &to->xpoint[ to->xp ],
-          &from->xpoint[ from->point[ from->tetra[tetrahedron].v[point] ].xp ],
-          sizeof(MMG5_xPoint) );
-  return 1;
-}
-/**
- * \param parmesh parmmg struct pointer
- * \param grp     working group pointer
- * \param max     pointer toward the size of the node2int_node_comm arrays
- * \param idx1    index1 value
- * \param idx2    index2 value
- *
- * \return 1 if tetra is successfully appended
- *         0 if tetra is not successfully appended
- *
- *  Append new values in  group's internal communitor, resizing the buffers if
- *  required
- */
-static int PMMG_n2incAppend( PMMG_pParMesh parmesh, PMMG_pGrp grp, int *max,
-                             int idx1, int idx2 )
-{
-  int newsize;
-
-  assert( (max != 0) && "null pointer passed" );
-  // Adjust the value of scale to reallocate memory more or less agressively
-  const float scale = 2.f;
-  if ( (grp->nitem_int_node_comm + 1) >= *max ) {
-    newsize = MG_MAX(scale * (*max),(*max)+1);
-    PMMG_RECALLOC(parmesh, grp->node2int_node_comm_index1, newsize, *max, int,
-                  "increasing node2int_node_comm_index1",return 0);
-    PMMG_RECALLOC(parmesh, grp->node2int_node_comm_index2, newsize, *max, int,
-                  "increasing node2int_node_comm_index2",return 0);
-    *max  = newsize;
-  }
-  grp->node2int_node_comm_index1[ grp->nitem_int_node_comm ] = idx1;
-  grp->node2int_node_comm_index2[ grp->nitem_int_node_comm ] = idx2;
-  ++grp->nitem_int_node_comm;
-  return 1;
-}
-
-/**
- * \param parmesh pointer toward the parmmg structure
- * \param grp     pointer toward the working group
- * \param max     pointer toward the size of the node2int_face_comm arrays
- * \param idx1    \f$ 12\times iel + 4\times ifac + iploc \f$ with \a iel the
- * index of the element to which the face belong, \a ifac the local index of the
- * face in \a iel and \a iploc as starting point in \a ifac (to be able to build
- * the node communicators from the face ones)
- * \param idx2    position of the face in the internal face communicator.
- *
- * \return 1 if tetra is successfully appended
- *         0 if tetra is not successfully appended
- *
- *  Append new values in the face internal communicator, resizing the buffers if
- *  required.
- */
-static int PMMG_f2ifcAppend( PMMG_pParMesh parmesh, PMMG_pGrp grp, int *max,
-                        int idx1, int idx2 )
-{
-  int newsize;
-
-  assert( (max != 0) && "null pointer passed" );
-
-  // Adjust the value of scale to reallocate memory more or less agressively
-  const float scale = 2.f;
-
-  if ( (grp->nitem_int_face_comm + 1) >= *max ) {
-    newsize = MG_MAX(scale * (*max),(*max)+1);
-    PMMG_RECALLOC(parmesh, grp->face2int_face_comm_index1,newsize, *max, int,
-                  "increasing face2int_face_comm_index1",return 0);
-    PMMG_RECALLOC(parmesh, grp->face2int_face_comm_index2,newsize, *max, int,
-                  "increasing face2int_face_comm_index2",return 0);
-    *max  = newsize;
-  }
-
-  grp->face2int_face_comm_index1[ grp->nitem_int_face_comm ] = idx1;
-  grp->face2int_face_comm_index2[ grp->nitem_int_face_comm ] = idx2;
-  ++grp->nitem_int_face_comm;
-
-  return 1;
-}
+typedef struct {
+  int np;    /*!< number of points */
+  int xp;    /*!< number of boundary points */
+  int xt;    /*!< number of boundary tetra */
+  int nnode; /*!< number of items of the node2int_node_comm arrays */
+  int nface; /*!< number of items of the face2int_face_comm arrays */
+} PMMG_splitSizes;
 
 /**
  * \param parmesh pointer toward the parmesh structure
@@ -350,6 +228,8 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
     /* Skip xtetra */
     ptCur->xt = 0;
 
+    /* Reset the visit stamp used by the point localization (mesh->base is 0) */
+    ptCur->flag = 0;
   }
 
   /* Loop on points */
@@ -422,22 +302,18 @@ int PMMG_create_oldGrp( PMMG_pParMesh parmesh,int igrp ) {
  * \param group pointer toward the new group to create
  * \param igrp index of the new group
  * \param igrpOld index of the old group which is splitted
- * \param memAv available mem for the mesh allocation
  * \param ne number of elements in the new group mesh
- * \param f2ifc_max maximum number of elements in the face2int_face_comm arrays
- * \param n2inc_max maximum number of elements in the node2int_node_comm arrays
+ * \param size sizes of the new group computed by the counting pass
  *
  * \return 0 if fail, 1 if success
  *
- * Creation of the new group \a grp: allocation and initialization of the mesh
- * and communicator structures. Set the f2ifc_max variable at the size at which
- * we allocate the face2int_face_comm arrays and the n2inc_max variable at the
- * size at which the node2int_node_comm arrays are allocated.
+ * Creation of the new group \a grp: allocation at their exact sizes and
+ * initialization of the mesh and communicator structures.
  *
  */
 static int
 PMMG_splitGrps_newGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,int igrpOld,
-                         int ne,int *f2ifc_max,int *n2inc_max ) {
+                         int ne,PMMG_splitSizes *size ) {
   PMMG_pGrp  const grp      = &listgrp[igrp];
   PMMG_pGrp  const grpOld   = &parmesh->listgrp[igrpOld];
   MMG5_pMesh const meshOld  = parmesh->listgrp[igrpOld].mesh;
@@ -513,16 +389,12 @@ PMMG_splitGrps_newGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,int ig
     }
   }
 
-  /* Uses the Euler-poincare formulae to estimate the number of entities (np =
-   * ne/6, nt=ne/3 */
-  if ( !PMMG_setMeshSize( mesh,MG_MAX(ne/6,4),ne,0,MG_MAX(ne/6,3),MG_MAX(ne/3,1)) ) return 0;
+  /* Exact sizes given by the counting pass */
+  if ( !PMMG_setMeshSize( mesh,MG_MAX(size->np,1),ne,0,size->xp,size->xt) ) return 0;
 
   PMMG_CALLOC(mesh,mesh->adja,4*mesh->nemax+5,int,"adjacency table",return 0);
 
-  grp->mesh->np = 0;
-  grp->mesh->npi = 0;
-
-  int allocSize = 1;
+  int allocSize = mesh->np;
 
   if ( grpOld->met && grpOld->met->m ) {
     if ( grpOld->met->size == 1 ) {
@@ -532,8 +404,7 @@ PMMG_splitGrps_newGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,int ig
       grp->met->type = MMG5_Tensor;
     }
 
-    /** If we have an initial metric, force the metric allocation (even if for
-     * now, we don't know the number of point that will be stored in it) */
+    /** If we have an initial metric, force the metric allocation */
     if ( !MMG3D_Set_solSize(grp->mesh,grp->met,MMG5_Vertex,allocSize,grp->met->type) )
       return 0;
   }
@@ -570,256 +441,218 @@ PMMG_splitGrps_newGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,int ig
   if ( !PMMG_copy_mmgInfo ( &meshOld->info,&grp->mesh->info ) ) return 0;
 
 
-  *n2inc_max = ne/3;
   assert( (grp->nitem_int_node_comm == 0 ) && "non empty comm" );
-  PMMG_CALLOC(parmesh,grp->node2int_node_comm_index1,*n2inc_max,int,
+  PMMG_CALLOC(parmesh,grp->node2int_node_comm_index1,size->nnode,int,
               "subgroup internal1 communicator ",return 0);
-  PMMG_CALLOC(parmesh,grp->node2int_node_comm_index2,*n2inc_max,int,
+  PMMG_CALLOC(parmesh,grp->node2int_node_comm_index2,size->nnode,int,
               "subgroup internal2 communicator ",return 0);
 
-  *f2ifc_max = mesh->xtmax;
-  PMMG_CALLOC(parmesh,grp->face2int_face_comm_index1,*f2ifc_max,int,
+  assert( (grp->nitem_int_face_comm == 0 ) && "non empty comm" );
+  PMMG_CALLOC(parmesh,grp->face2int_face_comm_index1,size->nface,int,
               "face2int_face_comm_index1 communicator",return 0);
-  PMMG_CALLOC(parmesh,grp->face2int_face_comm_index2,*f2ifc_max,int,
+  PMMG_CALLOC(parmesh,grp->face2int_face_comm_index2,size->nface,int,
               "face2int_face_comm_index2 communicator",return 0);
 
   return 1;
 }
 
 /**
- * \param parmesh pointer toward the parmesh structure
- * \param group pointer toward the new group to fill
- * \param mesh pointer toward the new mesh to fill
- * \param meshOld pointer toward the old mesh
- * \param tetraCur pointer to the current tetra
- * \param pt pointer to the old tetra
- * \param tet index of the old tetra
- * \param grpId intex of the current group
- * \param n2ifc_max maximum number of nodes in the node2int_node_comm arrays
- * \param part partition array for the old tetrahedra
- *
- * \return 0 if fail, 1 if success.
- *
- * Fill the node communicator with new interface nodes.
+ * \def PMMG_SPLIT_NOGRP
  *
+ * Visit stamp stored in the point[].s field of the mesh to split: the point has
+ * been initialized by the current splitting but not yet seen in a new group.
+ * Once seen in the group \a grpId, the field stores PMMG_SPLIT_NOGRP-1-grpId.
+ * Outside of the splitting, this field only stores values greater or equal to
+ * PMMG_UNSET, so a stale value can't be taken for a stamp.
  */
-static int PMMG_splitGrps_updateNodeCommNew( PMMG_pParMesh parmesh,PMMG_pGrp grp,
-    MMG5_pMesh mesh, MMG5_pMesh meshOld,MMG5_pTetra tetraCur,MMG5_pTetra pt,
-    int tet,int grpId,int *n2inc_max,int *part ) {
-  MMG5_pPoint ppt;
-  int *adja,fac,poi,adjidx;
-
-  adja = &meshOld->adja[ 4 * ( tet - 1 ) + 1 ];
-  for ( fac = 0; fac < 4; ++fac ) {
-    adjidx = adja[ fac ] / 4;
-
-    if ( adjidx && grpId != part[ adjidx - 1 ] ) {
-      for ( poi = 0; poi < 3; ++poi ) {
-        ppt = & mesh->point[ tetraCur->v[ MMG5_idir[fac][poi] ] ];
-        if ( ppt->tmp == -1 ) {
-          if (   !PMMG_n2incAppend( parmesh, grp, n2inc_max,
-                                   tetraCur->v[ MMG5_idir[fac][poi] ],
-                                   parmesh->int_node_comm->nitem + 1 ) ) {
-            return 0;
-          }
-
-          meshOld->point[ pt->v[ MMG5_idir[fac][poi]  ] ].tmp =
-            parmesh->int_node_comm->nitem + 1;
-          ppt->tmp = parmesh->int_node_comm->nitem + 1;
-
-          ++parmesh->int_node_comm->nitem;
-        }
-      }
-    }
-  }
-
-  return 1;
-}
+#define PMMG_SPLIT_NOGRP (PMMG_UNSET-1)
 
 /**
- * \param parmesh pointer toward the parmesh structure
- * \param group pointer toward the new group to fill
- * \param mesh pointer toward the new mesh to fill
- * \param ppt pointer to the current point
- * \param it index of the current point
- * \param fac intex of the current face
- * \param n2ifc_max maximum number of nodes in the node2int_node_comm arrays
- * \param pos pointer to the tetra+face index
+ * \param ppt pointer toward a point of the mesh to split
  *
- * \return 0 if fail, 1 if success.
- *
- * Fill the node communicator if the node was already parallel.
+ * Initialize the point at its first visit by the splitting: its index in the
+ * internal node communicator (point[].tmp field) is unset. Points of the old
+ * internal node communicator are initialized before the counting pass.
  *
  */
-static int PMMG_splitGrps_updateNodeCommOld( PMMG_pParMesh parmesh,PMMG_pGrp grp,
-    MMG5_pMesh mesh,MMG5_pPoint ppt,int ip,int *n2inc_max ) {
-
-  /* Add point in subgroup's communicator if it already was in group's
-     communicator */
-  if ( ppt->tmp != PMMG_UNSET ) {
-    if (  !PMMG_n2incAppend( parmesh, grp, n2inc_max,
-                             ip, ppt->tmp ) ) {
-      return 0;
-    }
-    ++parmesh->int_node_comm->nitem;
+static inline
+void PMMG_splitGrps_initPoint( MMG5_pPoint ppt ) {
+  if ( ppt->s > PMMG_SPLIT_NOGRP ) {
+    ppt->s   = PMMG_SPLIT_NOGRP;
+    ppt->tmp = PMMG_UNSET;
   }
-
-  return 1;
 }
 
 /**
  * \param parmesh pointer toward the parmesh structure
- * \param group pointer toward the new group to fill
- * \param mesh pointer toward the new mesh to fill
- * \param meshOld pointer toward the old mesh
- * \param fac intex of the current face
- * \param adjidx index of the old tetra
- * \param vidx face of the old tetra
-,* \param posInIntFaceComm position of each tetra face in the internal face
+ * \param meshOld pointer toward the mesh to split
+ * \param ngrp nb. of new groups
+ * \param part metis partition
+ * \param grpStart position of the first tetra of each new group in \a tetList
+ * \param tetList old tetra sorted by new groups
+ * \param posInIntFaceComm position of each tetra face in the internal face
+ * communicator (-1 if not in the internal face comm)
  * \param iplocFaceComm starting index to list the vertices of the faces in the
- * \param f2ifc_max maximum number of elements in the face2int_face_comm arrays
  * face2int_face arrays (to be able to build the node communicators from the
  * face ones).
- * communicator (-1 if not in the internal face comm)
- * \param tetPerGrp number of tetra in the group
- * \param pos tetra+face index
+ * \param tetVert index of each vertex of each old tetra in the mesh of its new
+ * group (opposite of the index if the vertex is met for the first time in the
+ * group)
+ * \param sizes computed sizes of each new group
  *
- * \return 0 if fail, 1 if success.
+ * Counting pass of the group splitting:
+ *   - give a position in the internal face communicator to the new interface
+ *     faces and a position in the internal node communicator to the new
+ *     interface nodes;
+ *   - number the vertices of each new group;
+ *   - count the exact number of entities of each new group, so the groups can
+ *     be filled without any reallocation (and independently of each others).
  *
- * Fill the face communicator with new parallel faces.
+ * \remark the point[].s field of \a meshOld stores a stamp of the last group in
+ * which the point has been seen (see PMMG_SPLIT_NOGRP) and the point[].flag
+ * field its index in this group (the opposite of the index once the point has
+ * been counted as a boundary point).
  *
  */
-static int PMMG_splitGrps_updateFaceCommNew( PMMG_pParMesh parmesh,
-    PMMG_pGrp grp, MMG5_pMesh mesh,MMG5_pMesh meshOld,MMG5_pTetra pt,int fac,int adjidx,int vidx,
-    int *posInIntFaceComm, int *iplocFaceComm,int *f2ifc_max,int tetPerGrp,
-    int pos ) {
-
-  MMG5_pTetra ptadj;
-  int ip,iploc,iplocadj;
-
-  /** Build the internal communicator for the boundary faces */
-  /* 1) Check if this face has already a position in the internal face
-   * communicator, and if not, increment the internal face comm and
-   * store the face position in posInIntFaceComm */
-  if ( posInIntFaceComm[4*(adjidx-1)+1+vidx]<0 ) {
-
-    posInIntFaceComm[pos]                 = parmesh->int_face_comm->nitem;
-    posInIntFaceComm[4*(adjidx-1)+1+vidx] = parmesh->int_face_comm->nitem;
-
-    /* Find a common starting point inside the face for both tetra */
-    iploc = 0; // We impose the starting point in tet
-    ip    = pt->v[MMG5_idir[fac][iploc]];
-
-    ptadj = &meshOld->tetra[adjidx];
-    for ( iplocadj=0; iplocadj < 3; ++iplocadj )
-      if ( ptadj->v[MMG5_idir[vidx][iplocadj]] == ip ) break;
-    assert ( iplocadj < 3 );
-
-    iplocFaceComm[pos]                 = iploc;
-    iplocFaceComm[4*(adjidx-1)+1+vidx] = iplocadj;
-
-    /* 2) Add the face in the list of interface faces of the group */
-    if ( !PMMG_f2ifcAppend( parmesh, grp, f2ifc_max,12*tetPerGrp+3*fac+iploc,
-                           posInIntFaceComm[pos] ) ) {
-
-      return 0;
+static void
+PMMG_splitGrps_countEntities( PMMG_pParMesh parmesh,MMG5_pMesh meshOld,int ngrp,
+                              idx_t *part,int *grpStart,int *tetList,
+                              int *posInIntFaceComm,int *iplocFaceComm,
+                              int *tetVert,PMMG_splitSizes *sizes ) {
+  MMG5_pTetra     pt,ptadj;
+  MMG5_pPoint     ppt;
+  PMMG_splitSizes *size;
+  int             *adja,adjidx,vidx,fac,pos,ip,iplocadj,isxt;
+  int             grpId,k,tet,poi,j;
+
+  /** Step 1: new interface faces and nodes */
+  for ( tet=1; tet<=meshOld->ne; ++tet ) {
+    pt   = &meshOld->tetra[tet];
+    adja = &meshOld->adja[4*(tet-1)+1];
+
+    for ( fac=0; fac<4; ++fac ) {
+      adjidx = adja[fac] / 4;
+      vidx   = adja[fac] % 4;
+
+      if ( !adjidx || part[adjidx-1] == part[tet-1] ) continue;
+
+      pos = 4*(tet-1)+1+fac;
+      if ( posInIntFaceComm[pos] >= 0 ) continue;
+
+      posInIntFaceComm[pos]                 = parmesh->int_face_comm->nitem;
+      posInIntFaceComm[4*(adjidx-1)+1+vidx] = parmesh->int_face_comm->nitem;
+      ++parmesh->int_face_comm->nitem;
+
+      /* Find a common starting point inside the face for both tetra */
+      ip    = pt->v[MMG5_idir[fac][0]];
+      ptadj = &meshOld->tetra[adjidx];
+      for ( iplocadj=0; iplocadj < 3; ++iplocadj )
+        if ( ptadj->v[MMG5_idir[vidx][iplocadj]] == ip ) break;
+      assert ( iplocadj < 3 );
+
+      iplocFaceComm[pos]                 = 0;
+      iplocFaceComm[4*(adjidx-1)+1+vidx] = iplocadj;
+
+      /* New interface nodes */
+      for ( j=0; j<3; ++j ) {
+        ppt = &meshOld->point[pt->v[MMG5_idir[fac][j]]];
+        PMMG_splitGrps_initPoint( ppt );
+        if ( ppt->tmp != PMMG_UNSET ) continue;
+        ppt->tmp = parmesh->int_node_comm->nitem++;
+      }
     }
-    ++parmesh->int_face_comm->nitem;
   }
-  else {
-    assert ( posInIntFaceComm[pos] >=0 );
-    assert ( iplocFaceComm   [pos] >=0 );
-
-    /* 2) Add the face in the list of interface faces of the group */
-    iploc = iplocFaceComm[pos];
-    if ( !PMMG_f2ifcAppend( parmesh, grp, f2ifc_max,12*tetPerGrp+3*fac+iploc,
-                           posInIntFaceComm[pos] ) ) {
 
-      return 0;
-    }
-  }
+  /** Step 2: vertex numbering and sizes of each group */
+  for ( grpId=0; grpId<ngrp; ++grpId ) {
+    size = &sizes[grpId];
+    memset(size,0,sizeof(PMMG_splitSizes));
+
+    for ( k=grpStart[grpId]; k<grpStart[grpId+1]; ++k ) {
+      tet  = tetList[k];
+      pt   = &meshOld->tetra[tet];
+      adja = &meshOld->adja[4*(tet-1)+1];
+
+      for ( poi=0; poi<4; ++poi ) {
+        ppt = &meshOld->point[pt->v[poi]];
+        if ( ppt->s != PMMG_SPLIT_NOGRP-1-grpId ) {
+          /* First time that this point is seen in this group */
+          PMMG_splitGrps_initPoint( ppt );
+          ppt->s = PMMG_SPLIT_NOGRP-1-grpId;
+          tetVert[4*(tet-1)+poi] = -(++size->np);
+
+          if ( ppt->xp ) {
+            ++size->xp;
+            /* Don't count it again as a new boundary point */
+            ppt->flag = -size->np;
+          }
+          else {
+            ppt->flag = size->np;
+          }
+          if ( ppt->tmp != PMMG_UNSET ) ++size->nnode;
+        }
+        else {
+          tetVert[4*(tet-1)+poi] = abs(ppt->flag);
+        }
+      }
 
-  return 1;
-}
+      isxt = pt->xt;
+      for ( fac=0; fac<4; ++fac ) {
+        pos = 4*(tet-1)+1+fac;
 
-/**
- * \param parmesh pointer toward the parmesh structure
- * \param group pointer toward the new group to fill
- * \param mesh pointer toward the new mesh to fill
- * \param adja pointer to the current tetra adjacency
- * \param tet index of the current tetra
- * \param fac intex of the current face
-,* \param posInIntFaceComm position of each tetra face in the internal face
- * \param iplocFaceComm starting index to list the vertices of the faces in the
- * \param f2ifc_max maximum number of elements in the face2int_face_comm arrays
- * face2int_face arrays (to be able to build the node communicators from the
- * face ones).
- * communicator (-1 if not in the internal face comm)
- * \param tetPerGrp number of tetra in the group
- * \param pos pointer to the tetra+face index
- *
- * \return 0 if fail, 1 if success, -1 if you can continue to the next tetra
- *
- * Fill the face communicator if the face was already parallel.
- *
- */
-static int PMMG_splitGrps_updateFaceCommOld( PMMG_pParMesh parmesh,
-    PMMG_pGrp grp, MMG5_pMesh mesh,int *adja,int tet,int fac,
-    int *posInIntFaceComm, int *iplocFaceComm,int *f2ifc_max,int tetPerGrp,
-    int *pos ) {
-  int iploc;
-
-  *pos   = 4*(tet-1)+1+fac;
-
-  if ( adja[ fac ] == 0 ) {
-    /** Build the internal communicator for the parallel faces */
-    /* 1) Check if this face has a position in the internal face
-     * communicator. If not, the face is not parallel and we have nothing
-     * to do */
-    if ( posInIntFaceComm[*pos]<0 ) {
-      return -1;
-    }
+        if ( !adja[fac] ) {
+          /* Old parallel face */
+          if ( posInIntFaceComm[pos] >= 0 ) ++size->nface;
+          continue;
+        }
 
-    /* 2) Add the point in the list of interface faces of the group */
-    iploc = iplocFaceComm[*pos];
-    assert ( iploc >=0 );
+        adjidx = adja[fac] / 4;
+        if ( part[adjidx-1] == grpId ) continue;
 
-    if ( !PMMG_f2ifcAppend( parmesh, grp, f2ifc_max,12*tetPerGrp+3*fac+iploc,
-                           posInIntFaceComm[*pos] ) ) {
-      return 0;
+        /* New interface face */
+        isxt = 1;
+        ++size->nface;
+        for ( j=0; j<3; ++j ) {
+          ppt = &meshOld->point[pt->v[MMG5_idir[fac][j]]];
+          if ( ppt->flag < 0 ) continue;
+          ppt->flag = -ppt->flag;
+          ++size->xp;
+        }
+      }
+      if ( isxt ) ++size->xt;
     }
-    return -1;
   }
-
-  return 1;
 }
 
 /**
  * \param parmesh pointer toward the parmesh structure
- * \param group pointer toward the new group to fill
- * \param ngrp nb. of new groups
+ * \param listgrp list of new groups
  * \param grpIdOld index of the group that is splitted in the old list of groups
- * \param grpId index of the group that we create in the list of groups
+ * \param grpId index of the group that we fill in the list of groups
  * \param ne number of elements in the new group mesh
- * \param np pointer toward number of points in the new group mesh
- * \param f2ifc_max maximum number of elements in the face2int_face_comm arrays
- * \param n2inc_max maximum number of elements in the node2int_node_comm arrays
+ * \param tetList old indices of the tetra of the new group
  * \param part metis partition
  * \param posInIntFaceComm position of each tetra face in the internal face
+ * communicator (-1 if not in the internal face comm)
  * \param iplocFaceComm starting index to list the vertices of the faces in the
  * face2int_face arrays (to be able to build the node communicators from the
  * face ones).
- * communicator (-1 if not in the internal face comm)
+ * \param tetVert index of each vertex of each old tetra in the mesh of its new
+ * group (opposite of the index if the vertex is met for the first time)
+ * \param size sizes of the new group
  *
  * \return 0 if fail, 1 if success
  *
- * Fill the mesh and communicators of the new group \a grp.
+ * Fill the mesh and communicators of the new group \a grp. The group has been
+ * allocated at its exact size and this function only reads the old group and
+ * the arrays of the counting pass, so the groups can be filled concurrently.
  *
  */
 static int
-PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int grpIdOld,int grpId,int ne,
-                          int *np,int *f2ifc_max,int *n2inc_max,idx_t *part,
-                          int* posInIntFaceComm,int* iplocFaceComm ) {
+PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int grpIdOld,
+                          int grpId,int ne,int *tetList,idx_t *part,
+                          int *posInIntFaceComm,int *iplocFaceComm,int *tetVert,
+                          PMMG_splitSizes *size ) {
   PMMG_pGrp  const grp    = &listgrp[grpId];
   PMMG_pGrp  const grpOld = &parmesh->listgrp[grpIdOld];
   MMG5_pMesh const meshOld= parmesh->listgrp[grpIdOld].mesh;
@@ -828,38 +661,23 @@ PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int g
   MMG5_pTetra      pt,tetraCur;
   MMG5_pxTetra     pxt;
   MMG5_pPoint      ppt;
-  int              *adja,adjidx,vidx,fac,pos;
-  int              ie,is,tetPerGrp,tet,poi,j,newsize;
-  int              ier;
+  int              *adja,adjidx,vidx,fac,pos,iploc;
+  int              is,tetPerGrp,tet,poi,ip,j,np,xp,xt;
 
-  mesh = grp->mesh;
-  met  = grp->met;
+  mesh  = grp->mesh;
+  met   = grp->met;
   ls    = grp->ls;
   disp  = grp->disp;
   field = grp->field;
 
-  /** Reinitialize to the value that n2i_n_c arrays are initially allocated
-      Otherwise grp #1,2,etc will incorrectly use the values that the previous
-      grps assigned to n2inc_max */
-  (*n2inc_max) = ne/3;
-
-  /* Loop over tetras and choose the ones to add in the submesh being constructed */
-  *np       = 0;
+  np = xp = xt = 0;
 
   for( tetPerGrp = 1; tetPerGrp <= ne; tetPerGrp++ ) {
     tetraCur = mesh->tetra + tetPerGrp;
-    tet = tetraCur->flag;
+    tet = tetList[tetPerGrp-1];
     pt = &meshOld->tetra[tet];
 
-    if ( !MG_EOK(pt) ) continue;
-
-    /* Skip elements that do not belong in the group processed in this iteration */
     assert( grpId == part[ tet - 1 ] );
-
-    /** MMG3D_Tetra.flag is used to update adjacency vector:
-       if the tetra belongs to the group we store the local tetrahedron id
-       in the tet.flag */
-    assert( ( tetPerGrp <= mesh->nemax ) && "overflowing tetra array?" );
     assert( pt->flag == tetPerGrp );
 
     /* add tetrahedron to subgroup (copy from original group) */
@@ -869,166 +687,112 @@ PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int g
 
     /* xTetra: this element was already an xtetra (in meshOld) */
     if ( tetraCur->xt != 0 ) {
-      if ( !PMMG_xtetraAppend( mesh, meshOld, tet ) )
-        return 0;
-      tetraCur->xt = mesh->xt;
+      ++xt;
+      memcpy( &mesh->xtetra[xt],&meshOld->xtetra[pt->xt],sizeof(MMG5_xTetra) );
+      tetraCur->xt = xt;
     }
 
     /* Add tetrahedron vertices in points struct and
        adjust tetrahedron vertices indices */
     for ( poi = 0; poi < 4 ; ++poi ) {
-      if ( meshOld->point[ pt->v[poi] ].s != grpId ) {
-        /* 1st time that this point is seen in this subgroup
-           Add point in subgroup point array */
-        ++(*np);
-
-        if ( *np > mesh->npmax ) {
-          newsize = MG_MAX((int)((1+mesh->gap)*mesh->npmax),mesh->npmax+1);
-          PMMG_RECALLOC(mesh,mesh->point,newsize+1,mesh->npmax+1,MMG5_Point,
-                        "point array",return 0);
-          mesh->npmax = newsize;
-          mesh->npnil = (*np)+1;;
-          for (j=mesh->npnil; j<mesh->npmax-1; j++)
-            mesh->point[j].tmp  = j+1;
-
-          /* Reallocation of metric, ls, displacement and sol fields */
-          /* Met */
-          if ( met ) {
-            if ( met->m ) {
-              PMMG_REALLOC(mesh,met->m,met->size*(mesh->npmax+1),
-                           met->size*(met->npmax+1),double,
-                           "metric array",return 0);
-            }
-            met->npmax = mesh->npmax;
-          }
+      ip = tetVert[4*(tet-1)+poi];
 
-          /* level-set */
-          if ( ls ) {
-            if ( ls->m ) {
-              PMMG_REALLOC(mesh,ls->m,ls->size*(mesh->npmax+1),
-                           ls->size*(ls->npmax+1),double,
-                           "ls array",return 0);
-            }
-            ls->npmax = mesh->npmax;
-          }
-          /* Displacment */
-          if ( disp ) {
-            if ( disp->m ) {
-              PMMG_REALLOC(mesh,disp->m,disp->size*(mesh->npmax+1),
-                           disp->size*(met->npmax+1),double,
-                           "displacement array",return 0);
-            }
-            disp->npmax = mesh->npmax;
-          }
+      if ( ip < 0 ) {
+        /* 1st time that this point is seen in this subgroup */
+        ip = -ip;
+        ++np;
+        assert ( ip == np && ip <= mesh->npmax );
 
-          /* Sol fields */
-          if ( mesh->nsols ) {
-            for ( is=0; is<mesh->nsols; ++is ) {
-              psl    = field + is;
-              assert ( psl && psl->m );
-              PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
-                           psl->size*(psl->npmax+1),double,
-                           "field array",return 0);
-              psl->npmax = mesh->npmax;
-            }
-          }
-
-          assert ( *np<=mesh->npmax );
-        }
-        memcpy( mesh->point+(*np),&meshOld->point[pt->v[poi]],
+        memcpy( mesh->point+ip,&meshOld->point[pt->v[poi]],
                 sizeof(MMG5_Point) );
+        /* Don't propagate the visit stamp of the splitting */
+        mesh->point[ip].s = PMMG_UNSET;
 
         /* metric */
         if ( met->m ) {
-          memcpy( &met->m[ (*np) * met->size ],
+          memcpy( &met->m[ ip * met->size ],
                   &grpOld->met->m[pt->v[poi] * met->size],
                   met->size * sizeof( double ) );
         }
         /* level-set */
-        if ( ls ) {
-          if ( ls->m ) {
-            memcpy( &ls->m[ (*np) * ls->size ],
-                    &grpOld->ls->m[pt->v[poi] * ls->size],
-                    ls->size * sizeof( double ) );
-          }
+        if ( ls && ls->m ) {
+          memcpy( &ls->m[ ip * ls->size ],
+                  &grpOld->ls->m[pt->v[poi] * ls->size],
+                  ls->size * sizeof( double ) );
         }
         /* disp */
-        if ( disp ) {
-          if ( disp->m ) {
-            memcpy( &disp->m[ (*np) * disp->size ],
-                    &grpOld->disp->m[pt->v[poi] * disp->size],
-                    disp->size * sizeof( double ) );
-          }
+        if ( disp && disp->m ) {
+          memcpy( &disp->m[ ip * disp->size ],
+                  &grpOld->disp->m[pt->v[poi] * disp->size],
+                  disp->size * sizeof( double ) );
         }
         /* solution field */
         if ( mesh->nsols ) {
           for ( is=0; is<mesh->nsols; ++is ) {
             psl    = field + is;
             pslOld = grpOld->field + is;
-            memcpy( &psl->m[ (*np) * psl->size ],
+            memcpy( &psl->m[ ip * psl->size ],
                     &pslOld->m[pt->v[poi] * psl->size],
                     psl->size * sizeof( double ) );
           }
         }
 
-        /* Update tetra vertex index */
-        tetraCur->v[poi] = (*np);
-
-        /* Store the point group */
-        meshOld->point[ pt->v[poi] ].s = grpId;
-
-        /* Store the point id */
-        meshOld->point[ pt->v[poi] ].flag = (*np);
-
-        ppt = &mesh->point[*np];
         /* xPoints: this was already a boundary point */
-        if ( mesh->point[*np].xp != 0 ) {
-          if ( !PMMG_xpointAppend(mesh,meshOld,tet,poi) ) {
-            return 0;
-          }
-          mesh->point[*np].xp = mesh->xp;
+        ppt = &mesh->point[ip];
+        if ( ppt->xp != 0 ) {
+          ++xp;
+          memcpy( &mesh->xpoint[xp],&meshOld->xpoint[ppt->xp],
+                  sizeof(MMG5_xPoint) );
+          ppt->xp = xp;
         }
 
-        if( !PMMG_splitGrps_updateNodeCommOld( parmesh,grp,mesh,ppt,*np,
-              n2inc_max ) ) return 0;
-
-      } else {
-        // point is already included in this subgroup, update current tetra
-        // vertex reference
-        tetraCur->v[poi] = meshOld->point[ pt->v[poi] ].flag;
+        /* Add point in subgroup's communicator if it is an interface point */
+        if ( ppt->tmp != PMMG_UNSET ) {
+          assert ( grp->nitem_int_node_comm < size->nnode );
+          grp->node2int_node_comm_index1[grp->nitem_int_node_comm] = ip;
+          grp->node2int_node_comm_index2[grp->nitem_int_node_comm] = ppt->tmp;
+          ++grp->nitem_int_node_comm;
+        }
       }
+      tetraCur->v[poi] = ip;
     }
 
-
     /* Copy element's vertices adjacency from old mesh and update them to the
      * new mesh values */
-    assert( ((4*(tetPerGrp-1)+4)<(4*(mesh->ne-1)+5)) && "adja overflow" );
     adja = &mesh->adja[ 4 * ( tetPerGrp - 1 ) + 1 ];
-
-    assert( (4 *(tet-1)+1+3) < (4*(meshOld->ne-1)+1+5) && "mesh->adja overflow" );
     memcpy( adja, &meshOld->adja[ 4 * ( tet - 1 ) + 1 ], 4 * sizeof(int) );
 
     /* Update element's adjaceny to elements in the new mesh */
     for ( fac = 0; fac < 4; ++fac ) {
-      ier = PMMG_splitGrps_updateFaceCommOld( parmesh,grp,mesh,adja,tet,fac,
-          posInIntFaceComm,iplocFaceComm,f2ifc_max,tetPerGrp,&pos );
-      if( ier == 0 )  return 0;
-      if( ier == -1 ) continue; /* not in the old communicator, continue */
+      pos = 4*(tet-1)+1+fac;
+
+      if ( adja[ fac ] == 0 ) {
+        /* Old parallel face: add it in the list of interface faces of the
+         * group */
+        if ( posInIntFaceComm[pos]<0 ) continue;
+
+        iploc = iplocFaceComm[pos];
+        assert ( iploc >=0 );
+        assert ( grp->nitem_int_face_comm < size->nface );
+        grp->face2int_face_comm_index1[grp->nitem_int_face_comm] =
+          12*tetPerGrp+3*fac+iploc;
+        grp->face2int_face_comm_index2[grp->nitem_int_face_comm] =
+          posInIntFaceComm[pos];
+        ++grp->nitem_int_face_comm;
+        continue;
+      }
 
       adjidx = adja[ fac ] / 4;
       vidx   = adja[ fac ] % 4;
 
       /* new boundary face: set to 0, add xtetra and set tags */
-      assert( ((adjidx - 1) < meshOld->ne ) && "part[adjaidx] would overflow" );
       if ( part[ adjidx - 1 ] != grpId ) {
         adja[ fac ] = 0;
 
         /* creation of the interface faces : ref 0 and tag MG_PARBDY */
-        if( !mesh->tetra[tetPerGrp].xt ) {
-          if ( !PMMG_xtetraAppend( mesh, meshOld, tet ) ) {
-            return 0;
-          }
-          tetraCur->xt = mesh->xt;
+        if( !tetraCur->xt ) {
+          ++xt;
+          tetraCur->xt = xt;
         }
         pxt = &mesh->xtetra[tetraCur->xt];
 
@@ -1036,9 +800,14 @@ PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int g
         if( pxt->ftag[fac] & MG_BDY ) pxt->ftag[fac] |= MG_PARBDYBDY;
         PMMG_tag_par_face(pxt,fac);
 
-        if( !PMMG_splitGrps_updateFaceCommNew( parmesh,grp,mesh,meshOld,pt,fac,
-              adjidx,vidx,posInIntFaceComm,iplocFaceComm,f2ifc_max,tetPerGrp,
-              pos ) ) return 0;
+        /* Add the face in the list of interface faces of the group */
+        assert ( posInIntFaceComm[pos] >=0 && iplocFaceComm[pos] >=0 );
+        assert ( grp->nitem_int_face_comm < size->nface );
+        grp->face2int_face_comm_index1[grp->nitem_int_face_comm] =
+          12*tetPerGrp+3*fac+iplocFaceComm[pos];
+        grp->face2int_face_comm_index2[grp->nitem_int_face_comm] =
+          posInIntFaceComm[pos];
+        ++grp->nitem_int_face_comm;
 
         for ( j=0; j<3; ++j ) {
           /* Update the face and face vertices tags */
@@ -1049,15 +818,8 @@ PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int g
           /** Add an xPoint if needed */
 // TO REMOVE WHEN MMG WILL BE READY
           if ( !ppt->xp ) {
-            if ( (mesh->xp+1) > mesh->xpmax ) {
-              /* realloc of xtetras table */
-              newsize = MG_MAX((int)((1+mesh->gap)*mesh->xpmax),mesh->xpmax+1);
-              PMMG_RECALLOC(mesh,mesh->xpoint,newsize+1,mesh->xpmax+1,MMG5_xPoint,
-                            "larger xpoint ",return 0);
-              mesh->xpmax = newsize;
-            }
-            ++mesh->xp;
-            ppt->xp = mesh->xp;
+            ++xp;
+            ppt->xp = xp;
           }
 // TO REMOVE WHEN MMG WILL BE READY
         }
@@ -1074,21 +836,14 @@ PMMG_splitGrps_fillGroup( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int ngrp,int g
           4*tetPerGrp+fac;
       }
     }
-
   }
-  assert( (mesh->ne == ne) && "Error in the tetra count" );
 
-  for ( ie = 1; ie <= mesh->ne; ie++ ) {
-    /* Get tetra in the new mesh */
-    tetraCur = &mesh->tetra[ie];
-
-    /* Get tetra in the old mesh */
-    tet = tetraCur->flag;
-    pt = &meshOld->tetra[tet];
+  assert( (mesh->ne == ne) && "Error in the tetra count" );
+  assert( np == size->np && xp == size->xp && xt == size->xt );
+  assert( grp->nitem_int_node_comm == size->nnode );
+  assert( grp->nitem_int_face_comm == size->nface );
 
-    if( !PMMG_splitGrps_updateNodeCommNew( parmesh,grp,mesh,meshOld,tetraCur,pt,
-          tet,grpId,n2inc_max,part ) ) return 0;
-  }
+  if ( np != size->np || xp != size->xp || xt != size->xt ) return 0;
 
   return 1;
 }
@@ -1122,8 +877,8 @@ PMMG_splitGrps_countTetPerGrp( PMMG_pParMesh parmesh,MMG5_pMesh meshOld,
  *
  * \return 0 if fail, 1 if success
  *
- * Clean the mesh filled by the \a split_grps function to make it valid:
- *   - reallocate the mesh at it exact size
+ * Clean the mesh filled by the \a split_grps function to make it valid
+ * (without any allocation, the mesh being allocated at its exact size):
  *   - set the np/ne/npi/nei/npnil/nenil fields to suitables value and keep
  *   track of empty link
  *   - update the edge tags in all the xtetra of the edge shell
@@ -1142,40 +897,23 @@ int PMMG_splitGrps_cleanMesh( PMMG_pParMesh parmesh,PMMG_pGrp grp,int np )
   MMG5_pxTetra pxt;
   int          k,i;
 
-  /* Mesh reallocation at the smallest possible size */
+  /* The arrays have been allocated at their exact sizes by the counting pass:
+   * only the counters are updated (no allocation in the parallel fill pass) */
+  assert ( np <= mesh->npmax && mesh->ne <= mesh->nemax );
+  assert ( mesh->xp <= mesh->xpmax && mesh->xt <= mesh->xtmax );
 
-  PMMG_REALLOC(mesh,mesh->point,np+1,mesh->npmax+1,
-               MMG5_Point,"fitted point table",return 0);
-  mesh->npmax = mesh->np = mesh->npi = np;
+  mesh->np    = mesh->npi = np;
   mesh->npnil = 0;
   mesh->nenil = 0;
 
-  PMMG_REALLOC(mesh,mesh->xpoint,mesh->xp+1,mesh->xpmax+1,
-               MMG5_xPoint,"fitted xpoint table",return 0);
-  mesh->xpmax = mesh->xp;
-  PMMG_REALLOC(mesh,mesh->tetra,mesh->ne+1,mesh->nemax+1,
-               MMG5_Tetra,"fitted tetra table",return 0);
-  mesh->nemax = mesh->ne;
-  PMMG_REALLOC(mesh,mesh->xtetra,mesh->xt+1,mesh->xtmax+1,
-               MMG5_xTetra,"fitted xtetra table",return 0);
-  mesh->xtmax = mesh->xt;
-
-  if ( met->m ) {
-    PMMG_REALLOC(mesh,met->m,met->size*(np+1),met->size*(met->npmax+1),
-                 double,"fitted metric table",return 0);
-  }
-  met->npmax = met->np = met->npi = np;
+  met->np = met->npi = np;
 
   if ( ls && ls->m ) {
-    PMMG_REALLOC(mesh,ls->m,ls->size*(np+1),ls->size*(ls->npmax+1),
-                 double,"fitted ls table",return 0);
-    ls->npmax = ls->np = ls->npi = np;
+    ls->np = ls->npi = np;
   }
 
   if ( disp && disp->m ) {
-    PMMG_REALLOC(mesh,disp->m,disp->size*(np+1),disp->size*(disp->npmax+1),
-                 double,"fitted disp table",return 0);
-    disp->npmax = disp->np = disp->npi = np;
+    disp->np = disp->npi = np;
   }
 
   if ( mesh->nsols ) {
@@ -1183,13 +921,10 @@ int PMMG_splitGrps_cleanMesh( PMMG_pParMesh parmesh,PMMG_pGrp grp,int np )
     for ( i=0; i<mesh->nsols; ++i ) {
       psl = field + i;
       assert ( psl->m );
-      PMMG_REALLOC(mesh,psl->m,psl->size*(np+1),psl->size*(psl->npmax+1),
-                   double,"fitted field table",return 0);
-      psl->npmax = psl->np = psl->npi = np;
+      psl->np = psl->npi = np;
     }
   }
 
-
   /* Udate tags and refs of tetra edges (if we have 2 boundary tetra in the
    * shell of an edge, it is possible that one of the xtetra has set the edge
    * as MG_PARBDY. In this case, this tag must be reported in the second
@@ -1259,7 +994,10 @@ int PMMG_update_oldGrps( PMMG_pParMesh parmesh ) {
  *         0  : failed but the mesh is correct
  *         1  : success
  *
- * Split one mesh it into into several meshes.
+ * Split one mesh it into into several meshes in two passes: a serial counting
+ * pass computes the exact size of each new group, then the groups are
+ * allocated and filled independently of each others (with threads if OpenMP is
+ * available).
  *
  * \warning tetra must be packed.
  *
@@ -1268,9 +1006,8 @@ int PMMG_split_eachGrp( PMMG_pParMesh parmesh,int grpIdOld,PMMG_pGrp grpsNew,
                         idx_t ngrp,int *countPerGrp,idx_t *part ) {
   PMMG_pGrp grpOld,grpCur;
   MMG5_pMesh meshOld,meshCur;
-  /** size of allocated node2int_node_comm_idx. when comm is ready trim to
-   *  actual node2int_node_comm */
-  int *n2inc_max,*f2ifc_max,*poiPerGrp;
+  PMMG_splitSizes *sizes;
+  int *grpStart,*tetList,*tetVert;
   int *posInIntFaceComm,*iplocFaceComm;
   int i, grpId, poi, fac, ie;
   int ret_val = 1;
@@ -1278,17 +1015,34 @@ int PMMG_split_eachGrp( PMMG_pParMesh parmesh,int grpIdOld,PMMG_pGrp grpsNew,
   grpOld  = &parmesh->listgrp[grpIdOld];
   meshOld = grpOld->mesh;
 
-  PMMG_CALLOC(parmesh,n2inc_max,ngrp,int,"n2inc_max",
+  sizes            = NULL;
+  grpStart         = NULL;
+  tetList          = NULL;
+  tetVert          = NULL;
+  posInIntFaceComm = NULL;
+  iplocFaceComm    = NULL;
+
+  PMMG_MALLOC(parmesh,sizes,ngrp,PMMG_splitSizes,"sizes of the new groups",
               ret_val = 0;goto fail_facePos);
-  PMMG_CALLOC(parmesh,f2ifc_max,ngrp,int,"f2ifc_max",
+  PMMG_MALLOC(parmesh,grpStart,ngrp+1,int,"grpStart",
               ret_val = 0;goto fail_facePos);
-  PMMG_CALLOC(parmesh,poiPerGrp,ngrp,int,"poiPerGrp",
+  PMMG_MALLOC(parmesh,tetList,meshOld->ne,int,"tetList",
+              ret_val = 0;goto fail_facePos);
+  PMMG_MALLOC(parmesh,tetVert,4*meshOld->ne,int,"tetVert",
               ret_val = 0;goto fail_facePos);
 
+  /* List the tetra of each new group (the old tetra flag stores the index of
+   * the tetra in its new group) */
+  grpStart[0] = 0;
+  for ( grpId = 0; grpId < ngrp; ++grpId ) {
+    grpStart[grpId+1] = grpStart[grpId] + countPerGrp[grpId];
+  }
+  for ( ie = 1; ie <= meshOld->ne; ie++ ) {
+    tetList[ grpStart[part[ie-1]] + meshOld->tetra[ie].flag - 1 ] = ie;
+  }
+
   /* Use the posInIntFaceComm array to remember the position of the tetra faces
    * in the internal face communicator */
-  posInIntFaceComm = NULL;
-  iplocFaceComm    = NULL;
   PMMG_MALLOC(parmesh,posInIntFaceComm,4*meshOld->ne+1,int,
               "array of faces position in the internal face commmunicator ",
               ret_val = 0;goto fail_facePos);
@@ -1311,27 +1065,26 @@ int PMMG_split_eachGrp( PMMG_pParMesh parmesh,int grpIdOld,PMMG_pGrp grpsNew,
   /* Use point[].tmp field to store index in internal communicator of
      vertices. specifically: place a copy of vertices' node2index2 position at
      point[].tmp field or -1 if they are not in the comm.
-     Use point[].s field to store assigned point subgroup.
+     Use point[].s field to store a stamp of the assigned point subgroup: the
+     other points are initialized at their first visit (see
+     PMMG_splitGrps_initPoint), so there is no reset pass over the points.
      Use point[].flag field to "remember" assigned local(in subgroup) numbering
      (no need to initialize it).
    */
-  for ( poi = 1; poi < meshOld->np + 1; ++poi ) {
-    meshOld->point[poi].tmp  = PMMG_UNSET;
-    meshOld->point[poi].s    = PMMG_UNSET;
+  for ( i = 0; i < grpOld->nitem_int_node_comm; i++ ) {
+    poi = grpOld->node2int_node_comm_index1[ i ];
+    meshOld->point[poi].s   = PMMG_SPLIT_NOGRP;
+    meshOld->point[poi].tmp = grpOld->node2int_node_comm_index2[ i ];
   }
 
-  for ( i = 0; i < grpOld->nitem_int_node_comm; i++ )
-    meshOld->point[ grpOld->node2int_node_comm_index1[ i ] ].tmp =
-      grpOld->node2int_node_comm_index2[ i ];
+  /** Counting pass */
+  PMMG_splitGrps_countEntities( parmesh,meshOld,ngrp,part,grpStart,tetList,
+                                posInIntFaceComm,iplocFaceComm,tetVert,sizes );
 
   for ( grpId = 0; grpId < ngrp; ++grpId ) {
-    /** New group */
-    grpCur  = &grpsNew[grpId];
-
-    /** New group initialisation */
+    /** New group initialisation at its exact size */
     if ( !PMMG_splitGrps_newGroup(parmesh,grpsNew,grpId,grpIdOld,
-                                  countPerGrp[grpId],&f2ifc_max[grpId],
-                                  &n2inc_max[grpId]) ) {
+                                  countPerGrp[grpId],&sizes[grpId]) ) {
       fprintf(stderr,"\n  ## Error: %s: unable to initialize new"
               " group (%d).\n",__func__,grpId);
       ret_val = -1;
@@ -1339,58 +1092,30 @@ int PMMG_split_eachGrp( PMMG_pParMesh parmesh,int grpIdOld,PMMG_pGrp grpsNew,
     }
   }
 
-  /* Store index of the old tetra in the new tetra field, for all grps */
-  for ( ie = 1; ie <= meshOld->ne; ie++ ) {
-    grpId = part[ ie-1 ];
-    grpCur  = &grpsNew[grpId];
-    meshCur = grpCur->mesh;
-    meshCur->tetra[ meshOld->tetra[ie].flag ].flag = ie;
-  }
-
+  /** Fill pass: each thread fills its own groups and doesn't allocate any
+   * memory */
+#ifdef _OPENMP
+#pragma omp parallel for private(grpCur) schedule(dynamic) reduction(min:ret_val)
+#endif
   for ( grpId = 0; grpId < ngrp; ++grpId ) {
-    /** New group filling */
     grpCur  = &grpsNew[grpId];
-    meshCur = grpCur->mesh;
 
-    if ( !PMMG_splitGrps_fillGroup(parmesh,grpsNew,ngrp,grpIdOld,grpId,
-                                   countPerGrp[grpId],&poiPerGrp[grpId],
-                                   &f2ifc_max[grpId],
-                                   &n2inc_max[grpId],part,posInIntFaceComm,
-                                   iplocFaceComm) ) {
+    if ( !PMMG_splitGrps_fillGroup(parmesh,grpsNew,grpIdOld,grpId,
+                                   countPerGrp[grpId],&tetList[grpStart[grpId]],
+                                   part,posInIntFaceComm,iplocFaceComm,tetVert,
+                                   &sizes[grpId]) ) {
       fprintf(stderr,"\n  ## Error: %s: unable to fill new group (%d).\n",
               __func__,grpId);
       ret_val = -1;
-      goto fail_sgrp;
     }
     /* Mesh cleaning in the new group */
-    if ( !PMMG_splitGrps_cleanMesh(parmesh,grpCur,poiPerGrp[grpId]) ) {
+    else if ( !PMMG_splitGrps_cleanMesh(parmesh,grpCur,sizes[grpId].np) ) {
       fprintf(stderr,"\n  ## Error: %s: unable to clean the mesh of"
               " new group (%d).\n",__func__,grpId);
       ret_val = -1;
-      goto fail_sgrp;
     }
-
-
-    /* Fitting of the communicator sizes */
-    PMMG_RECALLOC(parmesh, grpCur->node2int_node_comm_index1,
-                  grpCur->nitem_int_node_comm, n2inc_max[grpId], int,
-                  "subgroup internal1 communicator ",
-                  ret_val = -1;goto fail_sgrp );
-    PMMG_RECALLOC(parmesh, grpCur->node2int_node_comm_index2,
-                  grpCur->nitem_int_node_comm, n2inc_max[grpId], int,
-                  "subgroup internal2 communicator ",
-                  ret_val = -1;goto fail_sgrp );
-    n2inc_max[grpId] = grpCur->nitem_int_node_comm;
-    PMMG_RECALLOC(parmesh, grpCur->face2int_face_comm_index1,
-                  grpCur->nitem_int_face_comm, f2ifc_max[grpId], int,
-                  "subgroup interface faces communicator ",
-                  ret_val = -1;goto fail_sgrp );
-    PMMG_RECALLOC(parmesh, grpCur->face2int_face_comm_index2,
-                  grpCur->nitem_int_face_comm, f2ifc_max[grpId], int,
-                  "subgroup interface faces communicator ",
-                  ret_val = -1;goto fail_sgrp );
-
   }
+  if ( ret_val != 1 ) goto fail_sgrp;
 
   /* No error so far, skip deallocation of lstgrps */
   goto fail_facePos;
@@ -1432,9 +1157,10 @@ fail_sgrp:
   /* these labels should be executed as part of normal code execution before
      returning as well as error handling */
 fail_facePos:
-  PMMG_DEL_MEM(parmesh,n2inc_max,int,"n2inc_max");
-  PMMG_DEL_MEM(parmesh,f2ifc_max,int,"f2ifc_max");
-  PMMG_DEL_MEM(parmesh,poiPerGrp,int,"poiPerGrp");
+  PMMG_DEL_MEM(parmesh,sizes,PMMG_splitSizes,"sizes of the new groups");
+  PMMG_DEL_MEM(parmesh,grpStart,int,"grpStart");
+  PMMG_DEL_MEM(parmesh,tetList,int,"tetList");
+  PMMG_DEL_MEM(parmesh,tetVert,int,"tetVert");
   PMMG_DEL_MEM(parmesh,iplocFaceComm,int,
                "starting vertices of the faces of face2int_face_comm_index1");
 
@@ -0,0 +1,910 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file hdf_pmmg.c
+ * \brief parallel HDF5/XDMF io for the parmmg software
+ * \copyright GNU Lesser General Public License.
+ *
+ * Parallel HDF5 inputs and outputs for parmmg (through MPI-IO).
+ *
+ * The file contains one dataset per entity, shared by all the processes:
+ *   - /Mesh/Vertices (np x 3) and /Mesh/VerticesRef (np);
+ *   - /Mesh/Tetrahedra (ne x 4) and /Mesh/TetrahedraRef (ne);
+ *   - /Mesh/Triangles (nt x 3) and /Mesh/TrianglesRef (nt);
+ *   - /Solutions/Metric (np x size) and /Solutions/Field<i> (np x size).
+ * Vertices are stored with respect to their global numbering (each vertex is
+ * written by its owner) and elements connectivities use 0-based global vertex
+ * indices so the file can be read through the XDMF descriptor.
+ *
+ */
+
+#include "parmmg.h"
+#include "inoutpar_pmmg.h"
+
+#ifdef USE_HDF5
+#include <hdf5.h>
+
+/**
+ * \param loc HDF5 group in which to create the dataset
+ * \param name dataset name
+ * \param type HDF5 type of the data
+ * \param ncol number of values per row (1 to create a 1D dataset)
+ * \param nglob number of rows over all the processes
+ * \param start index of the first row written by this process
+ * \param nloc number of rows written by this process
+ * \param buf data to write (nloc*ncol values)
+ * \param typSol if non null, type of solution to store as a dataset attribute
+ * \param dxpl data transfer property list (collective IO)
+ *
+ * \return 1 if success, 0 otherwise
+ *
+ * Collective creation of a shared dataset and write of the rows of the current
+ * process.
+ *
+ */
+static
+int PMMG_hdf5_writeDataset(hid_t loc,const char *name,hid_t type,int ncol,
+                           int nglob,int start,int nloc,const void *buf,
+                           int typSol,hid_t dxpl) {
+  hid_t   filespace,memspace,dset,aspace,attr;
+  hsize_t dims[2],offset[2],count[2];
+  int     rank,ier;
+
+  rank    = ( ncol > 1 ) ? 2 : 1;
+  dims[0] = nglob;
+  dims[1] = ncol;
+
+  filespace = H5Screate_simple(rank,dims,NULL);
+  if ( filespace < 0 ) return 0;
+
+  dset = H5Dcreate2(loc,name,type,filespace,H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+  if ( dset < 0 ) {
+    H5Sclose(filespace);
+    return 0;
+  }
+
+  offset[0] = start;
+  offset[1] = 0;
+  count[0]  = nloc;
+  count[1]  = ncol;
+
+  memspace = H5Screate_simple(rank,count,NULL);
+
+  if ( nloc ) {
+    H5Sselect_hyperslab(filespace,H5S_SELECT_SET,offset,NULL,count,NULL);
+  }
+  else {
+    /* Empty contribution: still take part to the collective write */
+    H5Sselect_none(filespace);
+    H5Sselect_none(memspace);
+  }
+
+  ier = ( H5Dwrite(dset,type,memspace,filespace,dxpl,buf) >= 0 );
+
+  if ( typSol ) {
+    aspace = H5Screate(H5S_SCALAR);
+    attr   = H5Acreate2(dset,"type",H5T_NATIVE_INT,aspace,H5P_DEFAULT,H5P_DEFAULT);
+    if ( attr < 0 || H5Awrite(attr,H5T_NATIVE_INT,&typSol) < 0 ) ier = 0;
+    H5Aclose(attr);
+    H5Sclose(aspace);
+  }
+
+  H5Sclose(memspace);
+  H5Dclose(dset);
+  H5Sclose(filespace);
+
+  return ier;
+}
+
+/**
+ * \param loc HDF5 group containing the dataset
+ * \param name dataset name
+ * \param type HDF5 type of the data
+ * \param ncol number of values per row
+ * \param start index of the first row read by this process
+ * \param nloc number of rows read by this process
+ * \param buf array to fill (nloc*ncol values)
+ * \param dxpl data transfer property list (collective IO)
+ *
+ * \return 1 if success, 0 otherwise
+ *
+ * Collective read of a block of consecutive rows of a shared dataset.
+ *
+ */
+static
+int PMMG_hdf5_readBlock(hid_t loc,const char *name,hid_t type,int ncol,
+                        int start,int nloc,void *buf,hid_t dxpl) {
+  hid_t   filespace,memspace,dset;
+  hsize_t offset[2],count[2];
+  int     rank,ier;
+
+  dset = H5Dopen2(loc,name,H5P_DEFAULT);
+  if ( dset < 0 ) return 0;
+
+  filespace = H5Dget_space(dset);
+  rank      = H5Sget_simple_extent_ndims(filespace);
+
+  offset[0] = start;
+  offset[1] = 0;
+  count[0]  = nloc;
+  count[1]  = ncol;
+
+  memspace = H5Screate_simple(rank,count,NULL);
+
+  if ( nloc ) {
+    H5Sselect_hyperslab(filespace,H5S_SELECT_SET,offset,NULL,count,NULL);
+  }
+  else {
+    /* Empty contribution: still take part to the collective read */
+    H5Sselect_none(filespace);
+    H5Sselect_none(memspace);
+  }
+
+  ier = ( H5Dread(dset,type,memspace,filespace,dxpl,buf) >= 0 );
+
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(dset);
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param loc HDF5 group containing the dataset
+ * \param name dataset name
+ * \param type HDF5 type of the data
+ * \param ncol number of values per row
+ * \param n number of rows read by this process
+ * \param rows sorted indices (from 1) of the rows read by this process
+ * \param buf array to fill (n*ncol values, in the order of \a rows)
+ * \param dxpl data transfer property list (collective IO)
+ *
+ * \return 1 if success, 0 otherwise
+ *
+ * Collective read of a list of rows of a shared dataset (element selection).
+ *
+ */
+static
+int PMMG_hdf5_readRows(PMMG_pParMesh parmesh,hid_t loc,const char *name,
+                       hid_t type,int ncol,int n,const int *rows,void *buf,
+                       hid_t dxpl) {
+  hid_t   filespace,memspace,dset;
+  hsize_t *coord,count;
+  size_t  l;
+  int     rank,ier,k,i;
+
+  dset = H5Dopen2(loc,name,H5P_DEFAULT);
+  if ( dset < 0 ) return 0;
+
+  filespace = H5Dget_space(dset);
+  rank      = H5Sget_simple_extent_ndims(filespace);
+
+  count    = (hsize_t)n*ncol;
+  memspace = H5Screate_simple(1,&count,NULL);
+
+  ier   = 1;
+  coord = NULL;
+  if ( n ) {
+    PMMG_MALLOC(parmesh,coord,rank*count,hsize_t,"hdf5 selection",ier = 0);
+  }
+  if ( n && ier ) {
+    l = 0;
+    for ( k=0; k<n; ++k ) {
+      for ( i=0; i<ncol; ++i ) {
+        coord[l++] = rows[k]-1;
+        if ( rank == 2 ) coord[l++] = i;
+      }
+    }
+    H5Sselect_elements(filespace,H5S_SELECT_SET,count,coord);
+  }
+  else {
+    /* Empty contribution: still take part to the collective read */
+    H5Sselect_none(filespace);
+    H5Sselect_none(memspace);
+  }
+
+  if ( H5Dread(dset,type,memspace,filespace,dxpl,buf) < 0 ) ier = 0;
+
+  PMMG_DEL_MEM(parmesh,coord,hsize_t,"hdf5 selection");
+  H5Sclose(memspace);
+  H5Sclose(filespace);
+  H5Dclose(dset);
+
+  return ier;
+}
+
+/**
+ * \param loc HDF5 group containing the dataset
+ * \param name dataset name
+ * \param nrow number of rows of the dataset
+ * \param ncol number of values per row
+ *
+ * \return 1 if success, 0 otherwise (if the dataset doesn't exist).
+ *
+ * Get the dimensions of a dataset.
+ *
+ */
+static
+int PMMG_hdf5_getDims(hid_t loc,const char *name,int *nrow,int *ncol) {
+  hid_t   dset,space;
+  hsize_t dims[2];
+  int     rank;
+
+  if ( H5Lexists(loc,name,H5P_DEFAULT) <= 0 ) return 0;
+
+  dset  = H5Dopen2(loc,name,H5P_DEFAULT);
+  if ( dset < 0 ) return 0;
+
+  space = H5Dget_space(dset);
+  dims[1] = 1;
+  rank  = H5Sget_simple_extent_dims(space,dims,NULL);
+  H5Sclose(space);
+  H5Dclose(dset);
+
+  if ( rank < 1 || rank > 2 ) return 0;
+
+  *nrow = dims[0];
+  *ncol = dims[1];
+
+  return 1;
+}
+
+/**
+ * \param sol pointer toward the solution structure
+ *
+ * \return the XDMF attribute type matching the solution type.
+ *
+ */
+static inline
+const char* PMMG_xdmf_attributeType(MMG5_pSol sol) {
+  switch ( sol->type ) {
+  case MMG5_Vector:
+    return "Vector";
+  case MMG5_Tensor:
+    return "Tensor6";
+  default:
+    return "Scalar";
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param filename name of the XDMF file
+ * \param h5name name of the HDF5 file (relative to the XDMF one)
+ * \param npg global number of vertices
+ * \param neg global number of tetrahedra
+ * \param ntg global number of boundary triangles
+ *
+ * \return 1 if success, 0 otherwise
+ *
+ * Write the XDMF descriptor of the HDF5 file (root process only).
+ *
+ */
+static
+int PMMG_saveXdmf(PMMG_pParMesh parmesh,const char *filename,const char *h5name,
+                  int npg,int neg,int ntg) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met,psl;
+  FILE       *inm;
+  int        is;
+
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
+
+  if ( !(inm = fopen(filename,"w")) ) {
+    fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    return 0;
+  }
+
+  fprintf(inm,"<?xml version=\"1.0\" ?>\n");
+  fprintf(inm,"<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>\n");
+  fprintf(inm,"<Xdmf Version=\"3.0\">\n  <Domain>\n");
+
+  /* Volume mesh with the nodal and elementary data */
+  fprintf(inm,"    <Grid Name=\"Volume\" GridType=\"Uniform\">\n");
+  fprintf(inm,"      <Topology TopologyType=\"Tetrahedron\" NumberOfElements=\"%d\">\n",neg);
+  fprintf(inm,"        <DataItem Dimensions=\"%d 4\" NumberType=\"Int\" Format=\"HDF\">"
+          "%s:/Mesh/Tetrahedra</DataItem>\n",neg,h5name);
+  fprintf(inm,"      </Topology>\n");
+  fprintf(inm,"      <Geometry GeometryType=\"XYZ\">\n");
+  fprintf(inm,"        <DataItem Dimensions=\"%d 3\" NumberType=\"Float\" Precision=\"8\""
+          " Format=\"HDF\">%s:/Mesh/Vertices</DataItem>\n",npg,h5name);
+  fprintf(inm,"      </Geometry>\n");
+  fprintf(inm,"      <Attribute Name=\"VerticesRef\" AttributeType=\"Scalar\" Center=\"Node\">\n");
+  fprintf(inm,"        <DataItem Dimensions=\"%d\" NumberType=\"Int\" Format=\"HDF\">"
+          "%s:/Mesh/VerticesRef</DataItem>\n",npg,h5name);
+  fprintf(inm,"      </Attribute>\n");
+  fprintf(inm,"      <Attribute Name=\"TetrahedraRef\" AttributeType=\"Scalar\" Center=\"Cell\">\n");
+  fprintf(inm,"        <DataItem Dimensions=\"%d\" NumberType=\"Int\" Format=\"HDF\">"
+          "%s:/Mesh/TetrahedraRef</DataItem>\n",neg,h5name);
+  fprintf(inm,"      </Attribute>\n");
+
+  if ( met && met->m ) {
+    fprintf(inm,"      <Attribute Name=\"Metric\" AttributeType=\"%s\" Center=\"Node\">\n",
+            PMMG_xdmf_attributeType(met));
+    fprintf(inm,"        <DataItem Dimensions=\"%d %d\" NumberType=\"Float\" Precision=\"8\""
+            " Format=\"HDF\">%s:/Solutions/Metric</DataItem>\n",npg,met->size,h5name);
+    fprintf(inm,"      </Attribute>\n");
+  }
+
+  for ( is=0; is<mesh->nsols; ++is ) {
+    psl = parmesh->listgrp[0].field + is;
+    fprintf(inm,"      <Attribute Name=\"Field%d\" AttributeType=\"%s\" Center=\"Node\">\n",
+            is,PMMG_xdmf_attributeType(psl));
+    fprintf(inm,"        <DataItem Dimensions=\"%d %d\" NumberType=\"Float\" Precision=\"8\""
+            " Format=\"HDF\">%s:/Solutions/Field%d</DataItem>\n",npg,psl->size,h5name,is);
+    fprintf(inm,"      </Attribute>\n");
+  }
+  fprintf(inm,"    </Grid>\n");
+
+  /* Boundary mesh (shares the vertices of the volume one) */
+  if ( ntg ) {
+    fprintf(inm,"    <Grid Name=\"Boundary\" GridType=\"Uniform\">\n");
+    fprintf(inm,"      <Topology TopologyType=\"Triangle\" NumberOfElements=\"%d\">\n",ntg);
+    fprintf(inm,"        <DataItem Dimensions=\"%d 3\" NumberType=\"Int\" Format=\"HDF\">"
+            "%s:/Mesh/Triangles</DataItem>\n",ntg,h5name);
+    fprintf(inm,"      </Topology>\n");
+    fprintf(inm,"      <Geometry GeometryType=\"XYZ\">\n");
+    fprintf(inm,"        <DataItem Dimensions=\"%d 3\" NumberType=\"Float\" Precision=\"8\""
+            " Format=\"HDF\">%s:/Mesh/Vertices</DataItem>\n",npg,h5name);
+    fprintf(inm,"      </Geometry>\n");
+    fprintf(inm,"      <Attribute Name=\"TrianglesRef\" AttributeType=\"Scalar\" Center=\"Cell\">\n");
+    fprintf(inm,"        <DataItem Dimensions=\"%d\" NumberType=\"Int\" Format=\"HDF\">"
+            "%s:/Mesh/TrianglesRef</DataItem>\n",ntg,h5name);
+    fprintf(inm,"      </Attribute>\n");
+    fprintf(inm,"    </Grid>\n");
+  }
+
+  fprintf(inm,"  </Domain>\n</Xdmf>\n");
+  fclose(inm);
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nloc number of local rows
+ * \param start index of the first local row (computed)
+ * \param nglob number of rows over all the processes (computed)
+ *
+ * \return 1 if success, 0 otherwise
+ *
+ * Compute the offset of the rows of the current process in a shared dataset.
+ *
+ */
+static inline
+int PMMG_hdf5_offsets(PMMG_pParMesh parmesh,int nloc,int *start,int *nglob) {
+
+  *start = 0;
+  MPI_CHECK( MPI_Exscan(&nloc,start,1,MPI_INT,MPI_SUM,parmesh->comm),return 0 );
+  if ( !parmesh->myrank ) *start = 0;
+
+  MPI_CHECK( MPI_Allreduce(&nloc,nglob,1,MPI_INT,MPI_SUM,parmesh->comm),return 0 );
+
+  return 1;
+}
+#endif
+
+int PMMG_saveMesh_hdf5(PMMG_pParMesh parmesh,const char *filename) {
+
+#ifndef USE_HDF5
+  if ( parmesh->myrank == parmesh->info.root ) {
+    fprintf(stderr,"  ** HDF5 library not founded. Unavailable file format.\n");
+  }
+  return -1;
+
+#else
+  MMG5_pMesh  mesh;
+  MMG5_pSol   met,psl;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  hid_t       file,fapl,dxpl,gmesh,gsol;
+  double      *dbuf;
+  int         *ibuf,*rbuf;
+  int         np,ne,nt,npg,neg,ntg,pstart,estart,tstart;
+  int         k,i,is,ip,size,ier,ieresult;
+  char        *basename,*xdmfname,*h5name,dname[32];
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
+
+  if ( !filename || !*filename ) {
+    filename = parmesh->meshout;
+  }
+  if ( !filename || !*filename ) {
+    fprintf(stderr,"  ## Error: %s: no output file name.\n",__func__);
+    return 0;
+  }
+
+  /** Global numbering of vertices and triangles (already computed at the end
+   * of the remeshing if the user asked for it) */
+  if ( !parmesh->info.globalNum ) {
+    ier = PMMG_Compute_verticesGloNum( parmesh );
+    MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+    if ( !ieresult ) return 0;
+
+    ier = PMMG_Compute_trianglesGloNum( parmesh );
+    MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+    if ( !ieresult ) return 0;
+  }
+
+  /** Count owned entities and compute their offsets */
+  np = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    if ( mesh->point[k].flag == parmesh->myrank ) ++np;
+  }
+  ne = mesh->ne;
+  nt = 0;
+  for ( k=1; k<=mesh->nt; ++k ) {
+    if ( mesh->tria[k].base == parmesh->myrank ) ++nt;
+  }
+
+  if ( !PMMG_hdf5_offsets(parmesh,np,&pstart,&npg) ) return 0;
+  if ( !PMMG_hdf5_offsets(parmesh,ne,&estart,&neg) ) return 0;
+  if ( !PMMG_hdf5_offsets(parmesh,nt,&tstart,&ntg) ) return 0;
+
+  /** Buffers allocation (before any collective HDF5 call) */
+  dbuf = NULL;
+  ibuf = rbuf = NULL;
+
+  size = 3;
+  if ( met && met->m ) size = MG_MAX(size,met->size);
+  for ( is=0; is<mesh->nsols; ++is ) {
+    size = MG_MAX(size,parmesh->listgrp[0].field[is].size);
+  }
+  ier = 1;
+  PMMG_MALLOC(parmesh,dbuf,size*np+1,double,"hdf5 real buffer",ier = 0);
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,ibuf,4*MG_MAX(ne,nt)+1,int,"hdf5 int buffer",ier = 0);
+  }
+  if ( ier ) {
+    PMMG_MALLOC(parmesh,rbuf,MG_MAX(MG_MAX(np,ne),nt)+1,int,"hdf5 ref buffer",
+                ier = 0);
+  }
+
+  /* H5Fcreate is collective: all the processes must have their buffers */
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  /** Open the shared file */
+  file = -1;
+  if ( ieresult ) {
+    fapl = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl,parmesh->comm,MPI_INFO_NULL);
+    file = H5Fcreate(filename,H5F_ACC_TRUNC,H5P_DEFAULT,fapl);
+    H5Pclose(fapl);
+    ier = ( file >= 0 );
+    MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+    if ( !ieresult && parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ** UNABLE TO OPEN %s.\n",filename);
+    }
+  }
+  else if ( parmesh->myrank == parmesh->info.root ) {
+    fprintf(stderr,"  ## Error: %s: unable to allocate the output buffers.\n",
+            __func__);
+  }
+
+  if ( !ieresult ) {
+    if ( file >= 0 ) H5Fclose(file);
+    PMMG_DEL_MEM(parmesh,dbuf,double,"hdf5 real buffer");
+    PMMG_DEL_MEM(parmesh,ibuf,int,"hdf5 int buffer");
+    PMMG_DEL_MEM(parmesh,rbuf,int,"hdf5 ref buffer");
+    return 0;
+  }
+
+  dxpl = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(dxpl,H5FD_MPIO_COLLECTIVE);
+
+  gmesh = H5Gcreate2(file,"Mesh",H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+  gsol  = H5Gcreate2(file,"Solutions",H5P_DEFAULT,H5P_DEFAULT,H5P_DEFAULT);
+
+  /** Vertices: owned vertices are numbered consecutively by the global
+   * numbering */
+  i = 0;
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( ppt->flag != parmesh->myrank ) continue;
+    assert ( ppt->tmp == pstart+i+1 );
+    dbuf[3*i  ] = ppt->c[0];
+    dbuf[3*i+1] = ppt->c[1];
+    dbuf[3*i+2] = ppt->c[2];
+    rbuf[i]     = ppt->ref;
+    ++i;
+  }
+  ier = PMMG_hdf5_writeDataset(gmesh,"Vertices",H5T_NATIVE_DOUBLE,3,npg,pstart,
+                               np,dbuf,0,dxpl);
+  ier = MG_MIN( ier,
+                PMMG_hdf5_writeDataset(gmesh,"VerticesRef",H5T_NATIVE_INT,1,npg,
+                                       pstart,np,rbuf,0,dxpl) );
+
+  /** Metric and fields at owned vertices */
+  if ( met && met->m ) {
+    i = 0;
+    for ( k=1; k<=mesh->np; ++k ) {
+      if ( mesh->point[k].flag != parmesh->myrank ) continue;
+      memcpy(&dbuf[met->size*i],&met->m[met->size*k],met->size*sizeof(double));
+      ++i;
+    }
+    ier = MG_MIN( ier,
+                  PMMG_hdf5_writeDataset(gsol,"Metric",H5T_NATIVE_DOUBLE,met->size,
+                                         npg,pstart,np,dbuf,met->type,dxpl) );
+  }
+
+  for ( is=0; is<mesh->nsols; ++is ) {
+    psl = parmesh->listgrp[0].field + is;
+    i = 0;
+    for ( k=1; k<=mesh->np; ++k ) {
+      if ( mesh->point[k].flag != parmesh->myrank ) continue;
+      memcpy(&dbuf[psl->size*i],&psl->m[psl->size*k],psl->size*sizeof(double));
+      ++i;
+    }
+    snprintf(dname,32,"Field%d",is);
+    ier = MG_MIN( ier,
+                  PMMG_hdf5_writeDataset(gsol,dname,H5T_NATIVE_DOUBLE,psl->size,
+                                         npg,pstart,np,dbuf,psl->type,dxpl) );
+  }
+
+  /** Tetrahedra (0-based global indices of vertices) */
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( i=0; i<4; ++i ) {
+      ibuf[4*(k-1)+i] = mesh->point[pt->v[i]].tmp - 1;
+    }
+    rbuf[k-1] = pt->ref;
+  }
+  ier = MG_MIN( ier,
+                PMMG_hdf5_writeDataset(gmesh,"Tetrahedra",H5T_NATIVE_INT,4,neg,
+                                       estart,ne,ibuf,0,dxpl) );
+  ier = MG_MIN( ier,
+                PMMG_hdf5_writeDataset(gmesh,"TetrahedraRef",H5T_NATIVE_INT,1,neg,
+                                       estart,ne,rbuf,0,dxpl) );
+
+  /** Owned boundary triangles (purely parallel faces are not stored) */
+  i = 0;
+  for ( k=1; k<=mesh->nt; ++k ) {
+    ptt = &mesh->tria[k];
+    if ( ptt->base != parmesh->myrank ) continue;
+    for ( ip=0; ip<3; ++ip ) {
+      ibuf[3*i+ip] = mesh->point[ptt->v[ip]].tmp - 1;
+    }
+    rbuf[i] = ptt->ref;
+    ++i;
+  }
+  ier = MG_MIN( ier,
+                PMMG_hdf5_writeDataset(gmesh,"Triangles",H5T_NATIVE_INT,3,ntg,
+                                       tstart,nt,ibuf,0,dxpl) );
+  ier = MG_MIN( ier,
+                PMMG_hdf5_writeDataset(gmesh,"TrianglesRef",H5T_NATIVE_INT,1,ntg,
+                                       tstart,nt,rbuf,0,dxpl) );
+
+  PMMG_DEL_MEM(parmesh,dbuf,double,"hdf5 real buffer");
+  PMMG_DEL_MEM(parmesh,ibuf,int,"hdf5 int buffer");
+  PMMG_DEL_MEM(parmesh,rbuf,int,"hdf5 ref buffer");
+
+  H5Gclose(gsol);
+  H5Gclose(gmesh);
+  H5Pclose(dxpl);
+  H5Fclose(file);
+
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+  if ( !ieresult ) {
+    if ( parmesh->myrank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Error: %s: unable to write the HDF5 file %s.\n",
+              __func__,filename);
+    }
+    return 0;
+  }
+
+  /** XDMF descriptor */
+  ier = 1;
+  if ( parmesh->myrank == parmesh->info.root ) {
+    basename = MMG5_Remove_ext((char*)filename,".h5");
+    xdmfname = NULL;
+    MMG5_SAFE_CALLOC(xdmfname,strlen(basename)+6,char,ier = 0);
+    if ( ier ) {
+      strcpy(xdmfname,basename);
+      strcat(xdmfname,".xdmf");
+
+      /* The HDF5 file is referenced relatively to the XDMF one */
+      h5name = strrchr(filename,'/');
+      h5name = h5name ? h5name+1 : (char*)filename;
+
+      ier = PMMG_saveXdmf(parmesh,xdmfname,h5name,npg,neg,ntg);
+      MMG5_SAFE_FREE(xdmfname);
+    }
+    MMG5_SAFE_FREE(basename);
+  }
+  MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
+
+  return ieresult;
+#endif
+}
+
+int PMMG_loadMesh_hdf5(PMMG_pParMesh parmesh,const char *filename) {
+
+#ifndef USE_HDF5
+  if ( parmesh->myrank == parmesh->info.root ) {
+    fprintf(stderr,"  ** HDF5 library not founded. Unavailable file format.\n");
+  }
+  return -1;
+
+#else
+  MMG5_pSol       met,psl;
+  PMMG_preadVert  *vert;
+  hid_t           file,fapl,dxpl,gmesh,gsol,dset,attr;
+  double          *coor;
+  int             *tet,*tria,*buf,*refs,*gvert,*typSol;
+  int             nprocs,rank,nv,ne,nt,np,ntet,ntria,estart,tstart,nsols;
+  int             ncol,nrow,k,i,is,ier,ier_glob,ok;
+  char            dname[32];
+
+  nprocs = parmesh->nprocs;
+  rank   = parmesh->myrank;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  met  = parmesh->listgrp[0].met;
+
+  if ( !filename || !*filename ) {
+    filename = parmesh->meshin;
+  }
+
+  /** Open the shared file on all the processes */
+  fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_mpio(fapl,parmesh->comm,MPI_INFO_NULL);
+  file = H5Fopen(filename,H5F_ACC_RDONLY,fapl);
+  H5Pclose(fapl);
+
+  ier = ( file >= 0 );
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) {
+    if ( file >= 0 ) H5Fclose(file);
+    return 0;
+  }
+
+  /** Mesh sizes (same metadata on all the processes) */
+  nv = ne = nt = 0;
+  ok = 1;
+  gmesh = H5Gopen2(file,"Mesh",H5P_DEFAULT);
+  if ( gmesh < 0 ||
+       !PMMG_hdf5_getDims(gmesh,"Vertices",&nv,&ncol) || ncol != 3 ||
+       !PMMG_hdf5_getDims(gmesh,"Tetrahedra",&ne,&ncol) || ncol != 4 ) {
+    ok = 0;
+  }
+  if ( ok && PMMG_hdf5_getDims(gmesh,"Triangles",&nrow,&ncol) && ncol == 3 ) {
+    nt = nrow;
+  }
+  if ( !ok || ne < nprocs ) {
+    if ( rank == parmesh->info.root ) {
+      fprintf(stderr,"  ## Error: %s: unable to read the mesh in %s",
+              __func__,filename);
+      if ( ok ) fprintf(stderr," (less tetrahedra than processes)");
+      fprintf(stderr,".\n");
+    }
+    if ( gmesh >= 0 ) H5Gclose(gmesh);
+    H5Fclose(file);
+    return -1;
+  }
+
+  vert  = NULL;
+  coor  = NULL;
+  tet   = tria = buf = refs = gvert = typSol = NULL;
+  np    = 0;
+
+  dxpl = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(dxpl,H5FD_MPIO_COLLECTIVE);
+
+  /** Block partition of the tetrahedra and of the triangles */
+  estart = (int)( (int64_t)ne*rank/nprocs );
+  ntet   = (int)( (int64_t)ne*(rank+1)/nprocs ) - estart;
+  tstart = (int)( (int64_t)nt*rank/nprocs );
+  ntria  = (int)( (int64_t)nt*(rank+1)/nprocs ) - tstart;
+
+  ier = 1;
+  k   = MG_MAX(ntet,ntria);
+  PMMG_MALLOC(parmesh,buf,4*k+1,int,"hdf5 connectivity",ier = 0);
+  PMMG_MALLOC(parmesh,refs,k+1,int,"hdf5 refs",ier = 0);
+  PMMG_MALLOC(parmesh,tet,5*ntet+1,int,"tetra",ier = 0);
+  PMMG_MALLOC(parmesh,tria,4*ntria+1,int,"triangles",ier = 0);
+  PMMG_MALLOC(parmesh,gvert,4*ntet+1,int,"global vertices",ier = 0);
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) { ier = 0; goto end_mesh; }
+
+  /** Tetrahedra of the block (stored with 0-based indices) */
+  ier = PMMG_hdf5_readBlock(gmesh,"Tetrahedra",H5T_NATIVE_INT,4,estart,ntet,
+                            buf,dxpl);
+  ier = MG_MIN(ier,PMMG_hdf5_readBlock(gmesh,"TetrahedraRef",H5T_NATIVE_INT,1,
+                                       estart,ntet,refs,dxpl));
+  for ( k=0; ier && k<ntet; ++k ) {
+    for ( i=0; i<4; ++i ) {
+      tet[5*k+i] = buf[4*k+i]+1;
+      if ( tet[5*k+i] < 1 || tet[5*k+i] > nv ) {
+        ok = 0;
+        tet[5*k+i] = 1;
+      }
+      gvert[4*k+i] = tet[5*k+i];
+    }
+    tet[5*k+4] = refs[k];
+  }
+
+  /** Triangles of the block: sent to their tetra by PMMG_pread_buildMesh */
+  if ( nt ) {
+    ier = MG_MIN(ier,PMMG_hdf5_readBlock(gmesh,"Triangles",H5T_NATIVE_INT,3,
+                                         tstart,ntria,buf,dxpl));
+    ier = MG_MIN(ier,PMMG_hdf5_readBlock(gmesh,"TrianglesRef",H5T_NATIVE_INT,1,
+                                         tstart,ntria,refs,dxpl));
+    for ( k=0; ier && k<ntria; ++k ) {
+      for ( i=0; i<3; ++i ) tria[4*k+i] = buf[3*k+i]+1;
+      tria[4*k+3] = refs[k];
+    }
+  }
+
+  /** Vertices used by the local tetra */
+  if ( ier ) {
+    qsort(gvert,4*ntet,sizeof(int),PMMG_pread_compareInt);
+    for ( k=0; k<4*ntet; ++k ) {
+      if ( !np || gvert[k] != gvert[np-1] ) gvert[np++] = gvert[k];
+    }
+    PMMG_MALLOC(parmesh,vert,np+1,PMMG_preadVert,"vertices",ier = 0);
+    PMMG_MALLOC(parmesh,coor,3*np+1,double,"hdf5 vertices",ier = 0);
+  }
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) { ier = 0; goto end_mesh; }
+
+  /* np <= 4*ntet so buf can store the vertex references */
+  ier = PMMG_hdf5_readRows(parmesh,gmesh,"Vertices",H5T_NATIVE_DOUBLE,3,np,
+                           gvert,coor,dxpl);
+  ier = MG_MIN(ier,PMMG_hdf5_readRows(parmesh,gmesh,"VerticesRef",H5T_NATIVE_INT,
+                                      1,np,gvert,buf,dxpl));
+  for ( k=0; ier && k<np; ++k ) {
+    memcpy(vert[k].c,&coor[3*k],3*sizeof(double));
+    vert[k].ref = buf[k];
+    vert[k].tag = 0;
+  }
+  PMMG_DEL_MEM(parmesh,coor,double,"hdf5 vertices");
+
+  /** Local mesh with face communicators */
+  ier = PMMG_pread_buildMesh(parmesh,ier,ok,nv,np,gvert,vert,ntet,tet,
+                             ntria,tria,NULL,0,NULL);
+  if ( ier < 1 ) goto end_mesh;
+
+  /** Metric and fields: each process reads the rows of its vertices in place in
+   * the solution arrays */
+  if ( H5Lexists(file,"Solutions",H5P_DEFAULT) > 0 ) {
+    gsol = H5Gopen2(file,"Solutions",H5P_DEFAULT);
+
+    if ( PMMG_hdf5_getDims(gsol,"Metric",&nrow,&ncol) ) {
+      if ( nrow != nv || ( ncol != 1 && ncol != 6 ) ) {
+        ier = -1;
+      }
+      else {
+        ier = PMMG_Set_metSize(parmesh,MMG5_Vertex,np,
+                               ncol==6 ? MMG5_Tensor : MMG5_Scalar);
+        MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+                   ier_glob = 0 );
+        ier = ier_glob;
+        if ( ier ) {
+          ier = PMMG_hdf5_readRows(parmesh,gsol,"Metric",H5T_NATIVE_DOUBLE,ncol,
+                                   np,gvert,met->m+met->size,dxpl);
+        }
+      }
+    }
+
+    /* Fields are stored in Field0, Field1... */
+    nsols = 0;
+    do {
+      snprintf(dname,32,"Field%d",nsols);
+    } while ( PMMG_hdf5_getDims(gsol,dname,&nrow,&ncol) && ++nsols );
+
+    if ( ier == 1 && nsols ) {
+      PMMG_MALLOC(parmesh,typSol,nsols,int,"hdf5 sol types",ier = 0);
+    }
+    for ( is=0; ier==1 && is<nsols; ++is ) {
+      typSol[is] = MMG5_Scalar;
+      snprintf(dname,32,"Field%d",is);
+      PMMG_hdf5_getDims(gsol,dname,&nrow,&ncol);
+      if ( nrow != nv ) {
+        ier = -1;
+        break;
+      }
+      dset = H5Dopen2(gsol,dname,H5P_DEFAULT);
+      if ( H5Aexists(dset,"type") > 0 ) {
+        attr = H5Aopen(dset,"type",H5P_DEFAULT);
+        H5Aread(attr,H5T_NATIVE_INT,&typSol[is]);
+        H5Aclose(attr);
+      }
+      H5Dclose(dset);
+    }
+    if ( ier == 1 && nsols ) {
+      ier = PMMG_Set_solsAtVerticesSize(parmesh,nsols,np,typSol);
+    }
+
+    /* Collective reads: all the processes must agree on the status */
+    MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+               ier_glob = 0 );
+    ier = ier_glob;
+    for ( is=0; ier==1 && is<nsols; ++is ) {
+      psl = parmesh->listgrp[0].field + is;
+      snprintf(dname,32,"Field%d",is);
+      PMMG_hdf5_getDims(gsol,dname,&nrow,&ncol);
+      if ( ncol != psl->size ) {
+        ier = -1;
+        break;
+      }
+      ier = PMMG_hdf5_readRows(parmesh,gsol,dname,H5T_NATIVE_DOUBLE,psl->size,
+                               np,gvert,psl->m+psl->size,dxpl);
+    }
+    PMMG_DEL_MEM(parmesh,typSol,int,"hdf5 sol types");
+    H5Gclose(gsol);
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  ier = ier_glob;
+
+  if ( ier != 1 && rank == parmesh->info.root ) {
+    fprintf(stderr,"  ## Error: %s: unable to read the solutions in %s.\n",
+            __func__,filename);
+  }
+  if ( ier == 1 && parmesh->info.imprim > PMMG_VERB_VERSION &&
+       rank == parmesh->info.root ) {
+    fprintf(stdout,"     NUMBER OF VERTICES    %8d\n",nv);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA  %8d\n",ne);
+    fprintf(stdout,"     INITIAL PARTITION: BLOCKS OF TETRAHEDRA\n");
+  }
+  goto end;
+
+end_mesh:
+  if ( rank == parmesh->info.root ) {
+    fprintf(stderr,"  ## Error: %s: unable to read the mesh in %s.\n",
+            __func__,filename);
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,vert,PMMG_preadVert,"vertices");
+  PMMG_DEL_MEM(parmesh,coor,double,"hdf5 vertices");
+  PMMG_DEL_MEM(parmesh,tet,int,"tetra");
+  PMMG_DEL_MEM(parmesh,tria,int,"triangles");
+  PMMG_DEL_MEM(parmesh,buf,int,"hdf5 connectivity");
+  PMMG_DEL_MEM(parmesh,refs,int,"hdf5 refs");
+  PMMG_DEL_MEM(parmesh,gvert,int,"global vertices");
+  H5Pclose(dxpl);
+  H5Gclose(gmesh);
+  H5Fclose(file);
+
+  return ier;
+#endif
+}
@@ -35,6 +35,33 @@
 
 #include "parmmg.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define PMMG_MESHB_MMAP
+#endif
+
+/** Keyword codes above this value are not used by the Medit binary files that
+ * we read through file mapping */
+#define PMMG_MESHB_NKWD 128
+
+/**
+ * \struct PMMG_Meshb
+ *
+ * \brief Medit binary file mapped in memory, with the offset of the data of
+ * each keyword (0 if the keyword is absent).
+ *
+ */
+typedef struct {
+  const char *buf; /*!< mapped file */
+  size_t     size; /*!< size of the file in bytes */
+  int        iswp; /*!< 1 if byte swapping is needed */
+  int        ver;  /*!< file version (1: float reals, 2: double reals) */
+  size_t     kwd[PMMG_MESHB_NKWD]; /*!< offset of the data of each keyword */
+} PMMG_Meshb;
+
 /**
  * \param n integer for which we want to know the number of digits
  *
@@ -185,6 +212,80 @@ int PMMG_loadCommunicator( PMMG_pParMesh parmesh,FILE *inm,int bin,int iswp,
   return 1;
 }
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param API_mode PMMG_APIDISTRIB_faces or PMMG_APIDISTRIB_nodes.
+ * \param ncomm number of communicators.
+ * \param nitem_comm nb of items in each communicator.
+ * \param color color of each communicator.
+ * \param idx_loc local indices of entities in each communicator.
+ * \param idx_glo global indices of entities in each communicator.
+ *
+ * Set the face or node communicators loaded from a Medit file, then release the
+ * arrays in which they have been loaded.
+ *
+ */
+static
+void PMMG_set_loadedCommunicators( PMMG_pParMesh parmesh,int API_mode,int ncomm,
+                                   int *nitem_comm,int *color,
+                                   int **idx_loc,int **idx_glo ) {
+  int icomm,ier;
+
+  /* Set triangles or nodes interfaces depending on API mode */
+  switch( API_mode ) {
+
+    case PMMG_APIDISTRIB_faces :
+
+      /* Set the number of interfaces */
+      ier = PMMG_Set_numberOfFaceCommunicators(parmesh, ncomm);
+
+      /* Loop on each interface (proc pair) seen by the current rank) */
+      for( icomm = 0; icomm < ncomm; icomm++ ) {
+
+        /* Set nb. of entities on interface and rank of the outward proc */
+        ier = PMMG_Set_ithFaceCommunicatorSize(parmesh, icomm,
+                                               color[icomm],
+                                               nitem_comm[icomm]);
+
+        /* Set local and global index for each entity on the interface */
+        ier = PMMG_Set_ithFaceCommunicator_faces(parmesh, icomm,
+                                                 idx_loc[icomm],
+                                                 idx_glo[icomm], 1 );
+      }
+      break;
+
+    case PMMG_APIDISTRIB_nodes :
+
+      /* Set the number of interfaces */
+      ier = PMMG_Set_numberOfNodeCommunicators(parmesh, ncomm);
+
+      /* Loop on each interface (proc pair) seen by the current rank) */
+      for( icomm = 0; icomm < ncomm; icomm++ ) {
+
+        /* Set nb. of entities on interface and rank of the outward proc */
+        ier = PMMG_Set_ithNodeCommunicatorSize(parmesh, icomm,
+                                               color[icomm],
+                                               nitem_comm[icomm]);
+
+        /* Set local and global index for each entity on the interface */
+        ier = PMMG_Set_ithNodeCommunicator_nodes(parmesh, icomm,
+                                                 idx_loc[icomm],
+                                                 idx_glo[icomm], 1 );
+      }
+      break;
+  }
+
+  /* Release memory and return */
+  PMMG_DEL_MEM(parmesh,nitem_comm,int,"nitem_comm");
+  PMMG_DEL_MEM(parmesh,color,int,"color");
+  for( icomm = 0; icomm < ncomm; icomm++ ) {
+    PMMG_DEL_MEM(parmesh,idx_loc[icomm],int,"idx_loc");
+    PMMG_DEL_MEM(parmesh,idx_glo[icomm],int,"idx_glo");
+  }
+  PMMG_DEL_MEM(parmesh,idx_loc,int*,"idx_loc pointer");
+  PMMG_DEL_MEM(parmesh,idx_glo,int*,"idx_glo pointer");
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of the file to load the mesh from.
@@ -315,115 +416,693 @@ int PMMG_loadCommunicators( PMMG_pParMesh parmesh,const char *filename ) {
   if( !PMMG_loadCommunicator( parmesh,inm,bin,iswp,pos,ncomm,nitem_comm,color,
                               idx_loc,idx_glo ) ) return 0;
 
-  /* Set triangles or nodes interfaces depending on API mode */
-  switch( API_mode ) {
+  /* Set the communicators and release the loaded arrays */
+  PMMG_set_loadedCommunicators( parmesh,API_mode,ncomm,nitem_comm,color,
+                                idx_loc,idx_glo );
 
-    case PMMG_APIDISTRIB_faces :
+  fclose(inm);
 
-      /* Set the number of interfaces */
-      ier = PMMG_Set_numberOfFaceCommunicators(parmesh, ncomm);
+  return 1;
+}
 
-      /* Loop on each interface (proc pair) seen by the current rank) */
-      for( icomm = 0; icomm < ncomm; icomm++ ) {
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param endame string to allocate to store the final filename
+ * \param initname initial file name in which we want to insert rank index
+ * \param ASCIIext extension to search for ASCII format
+ * \param binext extension to search for binary format
+ *
+ * Allocate the endname string and copy the initname string with the mpir rank
+ * index before the file extension.
+ *
+ */
+static inline
+void PMMG_insert_rankIndex(PMMG_pParMesh parmesh,char **endname,const char *initname,
+                           char *ASCIIext, char *binext) {
+  int    lenmax;
+  int8_t fmt;
+  char   *ptr;
 
-        /* Set nb. of entities on interface and rank of the outward proc */
-        ier = PMMG_Set_ithFaceCommunicatorSize(parmesh, icomm,
-                                               color[icomm],
-                                               nitem_comm[icomm]);
+  lenmax = PMMG_count_digits ( parmesh->nprocs );
 
-        /* Set local and global index for each entity on the interface */
-        ier = PMMG_Set_ithFaceCommunicator_faces(parmesh, icomm,
-                                                 idx_loc[icomm],
-                                                 idx_glo[icomm], 1 );
-      }
-      break;
+  /* Check for pointer validity */
+  if ( (!endname) || (!initname) ) {
+    return;
+  }
 
-    case PMMG_APIDISTRIB_nodes :
+  MMG5_SAFE_CALLOC(*endname,strlen(initname)+lenmax+7,char,return);
 
-      /* Set the number of interfaces */
-      ier = PMMG_Set_numberOfNodeCommunicators(parmesh, ncomm);
+  strcpy(*endname,initname);
 
-      /* Loop on each interface (proc pair) seen by the current rank) */
-      for( icomm = 0; icomm < ncomm; icomm++ ) {
+  ptr = strstr(*endname,".meshb");
 
-        /* Set nb. of entities on interface and rank of the outward proc */
-        ier = PMMG_Set_ithNodeCommunicatorSize(parmesh, icomm,
-                                               color[icomm],
-                                               nitem_comm[icomm]);
+  fmt = 0; /* noext */
+  if( ptr ) {
+    *ptr = '\0';
+    fmt = 1; /* binary */
+  }
+  else {
+    ptr = strstr(*endname,".mesh");
+    if( ptr ) {
+      *ptr = '\0';
+      fmt = 2; /* ASCII */
+    }
+  }
+  sprintf(*endname, "%s.%d", *endname, parmesh->myrank );
+  if ( fmt==1 ) {
+    strcat ( *endname, binext );
+  }
+  else if ( fmt==2 ) {
+    strcat ( *endname, ASCIIext );
+  }
 
-        /* Set local and global index for each entity on the interface */
-        ier = PMMG_Set_ithNodeCommunicator_nodes(parmesh, icomm,
-                                                 idx_loc[icomm],
-                                                 idx_glo[icomm], 1 );
-      }
-      break;
+  return;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param endname string to allocate to store the final filename
+ * \param filename file name provided by the user (may be NULL)
+ * \param parname solution file name stored in the parmesh (may be NULL)
+ * \param solname solution file name stored in the solution (may be NULL)
+ * \param parmeshname mesh file name stored in the parmesh (may be NULL)
+ * \param meshname mesh file name stored in the mesh (may be NULL)
+ *
+ * Build the name of the solution file of the current rank from the first
+ * available name (in the order of the arguments). The rank index is inserted
+ * as for the metric files of a distributed mesh so the distributed solution
+ * files match the distributed mesh files.
+ *
+ */
+static inline
+void PMMG_insert_rankIndex_sol(PMMG_pParMesh parmesh,char **endname,
+                               const char *filename,const char *parname,
+                               const char *solname,const char *parmeshname,
+                               const char *meshname) {
+
+  if ( filename && *filename ) {
+    PMMG_insert_rankIndex(parmesh,endname,filename,".sol", ".sol");
+  }
+  else if ( parname ) {
+    PMMG_insert_rankIndex(parmesh,endname,parname,".sol", ".sol");
+  }
+  else if ( solname ) {
+    PMMG_insert_rankIndex(parmesh,endname,solname,".sol", ".sol");
+  }
+  else if ( parmeshname ) {
+    PMMG_insert_rankIndex(parmesh,endname,parmeshname,".mesh", ".meshb");
+  }
+  else if ( meshname ) {
+    PMMG_insert_rankIndex(parmesh,endname,meshname,".mesh", ".meshb");
+  }
+
+  return;
+}
+
+/**
+ * \param filename file name (with or without extension).
+ * \param binext extension of the binary format.
+ * \param asciiext extension of the ASCII format.
+ *
+ * \return the allocated name of the binary file to read, NULL if the file is
+ * in ASCII format or has no extension and no binary file exists.
+ *
+ * Follow the extension rules of the Mmg readers to find the name of a binary
+ * file.
+ *
+ */
+static
+char* PMMG_meshb_name(const char *filename,const char *binext,
+                      const char *asciiext) {
+  FILE *inm;
+  char *name;
+
+  if ( !filename ) return NULL;
+
+  if ( !strstr(filename,binext) && strstr(filename,asciiext) ) {
+    /* ASCII file */
+    return NULL;
+  }
+
+  MMG5_SAFE_CALLOC(name,strlen(filename)+strlen(binext)+1,char,return NULL);
+  strcpy(name,filename);
+
+  if ( !strstr(filename,binext) ) {
+    /* No extension: the binary file is read first if it exists */
+    strcat(name,binext);
+    inm = fopen(name,"rb");
+    if ( !inm ) {
+      MMG5_SAFE_FREE(name);
+      return NULL;
+    }
+    fclose(inm);
+  }
+  return name;
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param pos position in the file.
+ *
+ * \return the integer stored at position \a pos.
+ *
+ */
+static inline
+int PMMG_meshb_int(PMMG_Meshb *mb,size_t pos) {
+  int k;
+
+  memcpy(&k,mb->buf+pos,sizeof(int));
+  return mb->iswp ? MMG5_swapbin(k) : k;
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param pos position in the file.
+ *
+ * \return the real (float or double depending on the file version) stored at
+ * position \a pos.
+ *
+ */
+static inline
+double PMMG_meshb_real(PMMG_Meshb *mb,size_t pos) {
+  float  f;
+  double d;
+
+  if ( mb->ver == 1 ) {
+    memcpy(&f,mb->buf+pos,sizeof(float));
+    return mb->iswp ? MMG5_swapf(f) : f;
+  }
+  memcpy(&d,mb->buf+pos,sizeof(double));
+  return mb->iswp ? MMG5_swapd(d) : d;
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param dst array to fill.
+ * \param pos position of the first integer in the file.
+ * \param n number of integers to copy.
+ *
+ * Copy \a n consecutive integers of the file and swap them if needed.
+ *
+ */
+static inline
+void PMMG_meshb_ints(PMMG_Meshb *mb,int *dst,size_t pos,int n) {
+  int i;
+
+  memcpy(dst,mb->buf+pos,n*sizeof(int));
+  if ( mb->iswp ) {
+    for ( i=0; i<n; ++i ) dst[i] = MMG5_swapbin(dst[i]);
+  }
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param pos position of a section in the file.
+ * \param nrec number of records of the section.
+ * \param lrec size of the records in bytes.
+ *
+ * \return 1 if the section lies in the file, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_meshb_fits(PMMG_Meshb *mb,size_t pos,int nrec,size_t lrec) {
+  if ( nrec < 0 || pos > mb->size ) return 0;
+  return (size_t)nrec <= (mb->size - pos) / (lrec ? lrec : 1);
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param name name of the file.
+ *
+ * \return 1 if success, 0 if the file can't be mapped or is not a Medit binary
+ * file that we can read (version 1 or 2).
+ *
+ * Map a Medit binary file in memory and index the position of its keywords in
+ * a single pass over the NulPos chain.
+ *
+ */
+static
+int PMMG_meshb_map(PMMG_Meshb *mb,const char *name) {
+#ifdef PMMG_MESHB_MMAP
+  struct stat st;
+  void        *buf;
+  size_t      pos,next;
+  int         fd,code,kw,end;
+
+  memset(mb,0,sizeof(PMMG_Meshb));
+
+  fd = open(name,O_RDONLY);
+  if ( fd < 0 ) return 0;
+
+  if ( fstat(fd,&st) || st.st_size < 8 ) {
+    close(fd);
+    return 0;
+  }
+
+  buf = mmap(NULL,(size_t)st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+  close(fd);
+  if ( buf == MAP_FAILED ) return 0;
+  madvise(buf,(size_t)st.st_size,MADV_SEQUENTIAL);
+
+  mb->buf  = (const char*)buf;
+  mb->size = (size_t)st.st_size;
+
+  /* Endianness and version */
+  memcpy(&code,mb->buf,sizeof(int));
+  if ( code == 16777216 ) {
+    mb->iswp = 1;
+  }
+  else if ( code != 1 ) {
+    goto fail;
+  }
+  mb->ver = PMMG_meshb_int(mb,4);
+  if ( mb->ver != 1 && mb->ver != 2 ) goto fail;
+
+  /* Keyword index: each keyword is followed by the position of the next one,
+   * except the End keyword (that may be followed by parallel sections) */
+  end = 0;
+  pos = 8;
+  while ( pos + sizeof(int) <= mb->size ) {
+    kw = PMMG_meshb_int(mb,pos);
+    if ( kw == 54 ) {
+      end = 1;
+      pos += sizeof(int);
+      continue;
+    }
+    if ( pos + 2*sizeof(int) > mb->size ) {
+      if ( end ) break;
+      goto fail;
+    }
+    next = (size_t)(unsigned int)PMMG_meshb_int(mb,pos+sizeof(int));
+    if ( kw <= 0 || kw >= PMMG_MESHB_NKWD ||
+         next < pos + 2*sizeof(int) || next > mb->size ) {
+      if ( end ) break;
+      goto fail;
+    }
+    if ( !mb->kwd[kw] ) mb->kwd[kw] = pos + 2*sizeof(int);
+    pos = next;
+  }
+
+  return 1;
+
+fail:
+  munmap((void*)mb->buf,mb->size);
+  mb->buf = NULL;
+  return 0;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ *
+ * Unmap a Medit binary file.
+ *
+ */
+static
+void PMMG_meshb_unmap(PMMG_Meshb *mb) {
+#ifdef PMMG_MESHB_MMAP
+  if ( mb->buf ) munmap((void*)mb->buf,mb->size);
+#endif
+  mb->buf = NULL;
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param allowed list of the keywords that we are able to read.
+ * \param nallowed number of keywords in \a allowed.
+ *
+ * \return 1 if the file contains only allowed keywords, 0 otherwise.
+ *
+ */
+static
+int PMMG_meshb_onlyKwds(PMMG_Meshb *mb,const int *allowed,int nallowed) {
+  int kw,i;
+
+  for ( kw=1; kw<PMMG_MESHB_NKWD; ++kw ) {
+    if ( !mb->kwd[kw] ) continue;
+    for ( i=0; i<nallowed; ++i ) {
+      if ( allowed[i] == kw ) break;
+    }
+    if ( i == nallowed ) return 0;
+  }
+  return 1;
+}
+
+/**
+ * \param mb pointer toward the mapped file.
+ * \param kw keyword of a list of indices (corners, required entities...).
+ * \param list pointer toward the position of the first index.
+ *
+ * \return the number of indices of the list (0 if the keyword is absent), -1 if
+ * the list doesn't lie in the file.
+ *
+ */
+static
+int PMMG_meshb_list(PMMG_Meshb *mb,int kw,size_t *list) {
+  int n;
+
+  if ( !mb->kwd[kw] ) return 0;
+  if ( !PMMG_meshb_fits(mb,mb->kwd[kw],1,sizeof(int)) ) return -1;
+  n = PMMG_meshb_int(mb,mb->kwd[kw]);
+  *list = mb->kwd[kw] + sizeof(int);
+  if ( !PMMG_meshb_fits(mb,*list,n,sizeof(int)) ) return -1;
+  return n;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file to load the mesh from.
+ *
+ * \return 1 if success, 0 if fail, -1 if the file can't be read by this
+ * function (ASCII file, unsupported keyword or version...). In this last case
+ * the mesh is left untouched and the generic readers have to be used.
+ *
+ * Load a distributed mesh and its parallel communicators from a Medit binary
+ * file mapped in memory: keyword positions are indexed in one pass and each
+ * section is decoded in a single loop straight into the mesh arrays, instead of
+ * reading the file integer by integer (only one group per process is allowed).
+ *
+ */
+static
+int PMMG_loadMeshb_mmap(PMMG_pParMesh parmesh,const char *filename) {
+  static const int allowed[] = { 3, 4, 5, 6, 8, 13, 14, 15, 16, 17,
+                                 70, 71, 72, 73 };
+  PMMG_Meshb  mb;
+  MMG5_pMesh  mesh;
+  MMG5_pPoint ppt;
+  MMG5_pTetra pt;
+  MMG5_pTria  ptt;
+  MMG5_pEdge  pa;
+  size_t      rs,pos,lcrn,lreq,lrid,lreqa,lreqt,pcomm,pidx;
+  int         np,ne,nt,na,ncrn,nreq,nrid,nreqa,nreqt,ncomm,ntot;
+  int         API_mode,kwcomm,kwidx,*nitem_comm,*color,**idx_loc,**idx_glo;
+  int         *inxt,rec[3],k,i,icomm,ier;
+  char        *name;
+
+  assert( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+
+  name = PMMG_meshb_name(filename,".meshb",".mesh");
+  if ( !name ) return -1;
+
+  if ( !PMMG_meshb_map(&mb,name) ) {
+    MMG5_SAFE_FREE(name);
+    return -1;
+  }
+
+  ier        = -1;
+  nitem_comm = color = inxt = NULL;
+  idx_loc    = idx_glo = NULL;
+
+  /** Step 1: check that we are able to read the whole file */
+  if ( !PMMG_meshb_onlyKwds(&mb,allowed,sizeof(allowed)/sizeof(int)) ) goto end;
+  if ( mb.kwd[3] && ( !PMMG_meshb_fits(&mb,mb.kwd[3],1,sizeof(int)) ||
+                      PMMG_meshb_int(&mb,mb.kwd[3]) != 3 ) ) goto end;
+
+  /* Communicators: triangles are preferred to nodes */
+  if ( mb.kwd[70] && mb.kwd[72] ) {
+    API_mode = PMMG_APIDISTRIB_faces;
+    kwcomm   = 70;
+    kwidx    = 72;
+  }
+  else if ( mb.kwd[71] && mb.kwd[73] ) {
+    API_mode = PMMG_APIDISTRIB_nodes;
+    kwcomm   = 71;
+    kwidx    = 73;
+  }
+  else goto end;
+
+  rs = ( mb.ver == 1 ) ? sizeof(float) : sizeof(double);
+
+  np = ne = nt = na = 0;
+  if ( !mb.kwd[4] || !PMMG_meshb_fits(&mb,mb.kwd[4],1,sizeof(int)) ) goto end;
+  np = PMMG_meshb_int(&mb,mb.kwd[4]);
+  if ( !PMMG_meshb_fits(&mb,mb.kwd[4]+sizeof(int),np,3*rs+sizeof(int)) ) goto end;
+
+  if ( mb.kwd[8] ) {
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[8],1,sizeof(int)) ) goto end;
+    ne = PMMG_meshb_int(&mb,mb.kwd[8]);
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[8]+sizeof(int),ne,5*sizeof(int)) ) goto end;
+  }
+  if ( mb.kwd[6] ) {
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[6],1,sizeof(int)) ) goto end;
+    nt = PMMG_meshb_int(&mb,mb.kwd[6]);
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[6]+sizeof(int),nt,4*sizeof(int)) ) goto end;
+  }
+  if ( mb.kwd[5] ) {
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[5],1,sizeof(int)) ) goto end;
+    na = PMMG_meshb_int(&mb,mb.kwd[5]);
+    if ( !PMMG_meshb_fits(&mb,mb.kwd[5]+sizeof(int),na,3*sizeof(int)) ) goto end;
+  }
+
+  ncrn  = PMMG_meshb_list(&mb,13,&lcrn);
+  nreq  = PMMG_meshb_list(&mb,15,&lreq);
+  nrid  = PMMG_meshb_list(&mb,14,&lrid);
+  nreqa = PMMG_meshb_list(&mb,16,&lreqa);
+  nreqt = PMMG_meshb_list(&mb,17,&lreqt);
+  if ( ncrn < 0 || nreq < 0 || nrid < 0 || nreqa < 0 || nreqt < 0 ) goto end;
+
+  if ( !PMMG_meshb_fits(&mb,mb.kwd[kwcomm],1,sizeof(int)) ) goto end;
+  ncomm = PMMG_meshb_int(&mb,mb.kwd[kwcomm]);
+  pcomm = mb.kwd[kwcomm] + sizeof(int);
+  if ( !PMMG_meshb_fits(&mb,pcomm,ncomm,2*sizeof(int)) ) goto end;
+  ntot = 0;
+  for ( icomm=0; icomm<ncomm; ++icomm ) {
+    k = PMMG_meshb_int(&mb,pcomm+(2*icomm+1)*sizeof(int));
+    if ( k < 0 ) goto end;
+    ntot += k;
+  }
+  pidx = mb.kwd[kwidx];
+  if ( !PMMG_meshb_fits(&mb,pidx,ntot,3*sizeof(int)) ) goto end;
+
+  /** Step 2: mesh allocation and bulk decoding of the sections */
+  ier = 0;
+
+  if ( mesh->info.imprim >= 0 ) {
+    fprintf(stdout,"  %%%% %s OPENED\n",name);
+  }
+
+  if ( !PMMG_Set_meshSize(parmesh,np,ne,0,nt,0,na) ) goto end;
+
+  pos = mb.kwd[4] + sizeof(int);
+  for ( k=1; k<=np; ++k ) {
+    ppt = &mesh->point[k];
+    for ( i=0; i<3; ++i ) {
+      ppt->c[i] = PMMG_meshb_real(&mb,pos);
+      pos += rs;
+    }
+    ppt->ref = abs(PMMG_meshb_int(&mb,pos));
+    pos += sizeof(int);
+  }
+
+  pos = mb.kwd[8] + sizeof(int);
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    PMMG_meshb_ints(&mb,pt->v,pos,4);
+    pt->ref = PMMG_meshb_int(&mb,pos+4*sizeof(int));
+    pos += 5*sizeof(int);
+  }
+
+  pos = mb.kwd[6] + sizeof(int);
+  for ( k=1; k<=nt; ++k ) {
+    ptt = &mesh->tria[k];
+    PMMG_meshb_ints(&mb,ptt->v,pos,3);
+    ptt->ref = PMMG_meshb_int(&mb,pos+3*sizeof(int));
+    pos += 4*sizeof(int);
+  }
+
+  pos = mb.kwd[5] + sizeof(int);
+  for ( k=1; k<=na; ++k ) {
+    pa = &mesh->edge[k];
+    PMMG_meshb_ints(&mb,rec,pos,3);
+    pa->a    = rec[0];
+    pa->b    = rec[1];
+    pa->ref  = abs(rec[2]);
+    pa->tag |= MG_REF;
+    if ( pa->a < 1 || pa->a > np || pa->b < 1 || pa->b > np ) {
+      fprintf(stderr,"\n  ## Error: %s: edge %d: vertex out of range.\n",
+              __func__,k);
+      goto end;
+    }
+    pos += 3*sizeof(int);
+  }
+
+  /* Vertex tags, tetra orientation and reference checks */
+  if ( !PMMG_Set_meshFromPtr(parmesh) ) goto end;
+
+  /* Lists of tagged entities */
+  for ( i=0; i<ncrn; ++i ) {
+    k = PMMG_meshb_int(&mb,lcrn+i*sizeof(int));
+    if ( k < 1 || k > np || !PMMG_Set_corner(parmesh,k) ) goto end;
+  }
+  for ( i=0; i<nreq; ++i ) {
+    k = PMMG_meshb_int(&mb,lreq+i*sizeof(int));
+    if ( k < 1 || k > np || !PMMG_Set_requiredVertex(parmesh,k) ) goto end;
+  }
+  for ( i=0; i<nrid; ++i ) {
+    k = PMMG_meshb_int(&mb,lrid+i*sizeof(int));
+    if ( k < 1 || k > na || !PMMG_Set_ridge(parmesh,k) ) goto end;
+  }
+  for ( i=0; i<nreqa; ++i ) {
+    k = PMMG_meshb_int(&mb,lreqa+i*sizeof(int));
+    if ( k < 1 || k > na || !PMMG_Set_requiredEdge(parmesh,k) ) goto end;
+  }
+  for ( i=0; i<nreqt; ++i ) {
+    k = PMMG_meshb_int(&mb,lreqt+i*sizeof(int));
+    if ( k < 1 || k > nt || !PMMG_Set_requiredTriangle(parmesh,k) ) goto end;
+  }
+
+  /** Step 3: parallel communicators */
+  if ( !PMMG_Set_iparameter( parmesh, PMMG_IPARAM_APImode, API_mode ) ) goto end;
+
+  PMMG_CALLOC(parmesh,nitem_comm,ncomm,int,"nitem_comm",goto end);
+  PMMG_CALLOC(parmesh,color,ncomm,int,"color",goto end);
+  PMMG_CALLOC(parmesh,idx_loc,ncomm,int*,"idx_loc pointer",goto end);
+  PMMG_CALLOC(parmesh,idx_glo,ncomm,int*,"idx_glo pointer",goto end);
+  PMMG_CALLOC(parmesh,inxt,ncomm,int,"inxt",goto end);
+
+  for ( icomm=0; icomm<ncomm; ++icomm ) {
+    PMMG_meshb_ints(&mb,rec,pcomm+2*icomm*sizeof(int),2);
+    color[icomm]      = rec[0];
+    nitem_comm[icomm] = rec[1];
+    PMMG_CALLOC(parmesh,idx_loc[icomm],nitem_comm[icomm],int,"idx_loc",goto end);
+    PMMG_CALLOC(parmesh,idx_glo[icomm],nitem_comm[icomm],int,"idx_glo",goto end);
   }
 
-  /* Release memory and return */
+  for ( i=0; i<ntot; ++i ) {
+    PMMG_meshb_ints(&mb,rec,pidx,3);
+    pidx += 3*sizeof(int);
+    icomm = rec[2];
+    if ( icomm < 0 || icomm >= ncomm || inxt[icomm] >= nitem_comm[icomm] ) {
+      fprintf(stderr,"\n  ## Error: %s: rank %d: bad communicator index %d.\n",
+              __func__,parmesh->myrank,icomm);
+      goto end;
+    }
+    idx_loc[icomm][inxt[icomm]] = rec[0];
+    idx_glo[icomm][inxt[icomm]] = rec[1];
+    inxt[icomm]++;
+  }
+  PMMG_DEL_MEM(parmesh,inxt,int,"inxt");
+
+  /* Set the communicators and release the loaded arrays */
+  PMMG_set_loadedCommunicators( parmesh,API_mode,ncomm,nitem_comm,color,
+                                idx_loc,idx_glo );
+  nitem_comm = color = NULL;
+  idx_loc    = idx_glo = NULL;
+
+  ier = 1;
+
+end:
+  PMMG_DEL_MEM(parmesh,inxt,int,"inxt");
   PMMG_DEL_MEM(parmesh,nitem_comm,int,"nitem_comm");
   PMMG_DEL_MEM(parmesh,color,int,"color");
-  for( icomm = 0; icomm < ncomm; icomm++ ) {
-    PMMG_DEL_MEM(parmesh,idx_loc[icomm],int,"idx_loc");
-    PMMG_DEL_MEM(parmesh,idx_glo[icomm],int,"idx_glo");
+  if ( idx_loc && idx_glo ) {
+    for ( icomm=0; icomm<ncomm; ++icomm ) {
+      PMMG_DEL_MEM(parmesh,idx_loc[icomm],int,"idx_loc");
+      PMMG_DEL_MEM(parmesh,idx_glo[icomm],int,"idx_glo");
+    }
   }
   PMMG_DEL_MEM(parmesh,idx_loc,int*,"idx_loc pointer");
   PMMG_DEL_MEM(parmesh,idx_glo,int*,"idx_glo pointer");
+  PMMG_meshb_unmap(&mb);
+  MMG5_SAFE_FREE(name);
 
-  return 1;
+  return ier;
 }
 
 /**
- * \param parmesh pointer toward the parmesh structure
- * \param endame string to allocate to store the final filename
- * \param initname initial file name in which we want to insert rank index
- * \param ASCIIext extension to search for ASCII format
- * \param binext extension to search for binary format
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file to load the metric from.
  *
- * Allocate the endname string and copy the initname string with the mpir rank
- * index before the file extension.
+ * \return 1 if success, 0 if fail, -1 if the file can't be read by this
+ * function. In this last case the metric is left untouched and the generic
+ * readers have to be used.
+ *
+ * Load a distributed scalar or tensor metric from a Medit binary file mapped in
+ * memory (only one group per process is allowed).
  *
  */
-static inline
-void PMMG_insert_rankIndex(PMMG_pParMesh parmesh,char **endname,const char *initname,
-                           char *ASCIIext, char *binext) {
-  int    lenmax;
-  int8_t fmt;
-  char   *ptr;
+static
+int PMMG_loadSolb_mmap(PMMG_pParMesh parmesh,const char *filename) {
+  static const int allowed[] = { 3, 62 };
+  PMMG_Meshb  mb;
+  MMG5_pMesh  mesh;
+  MMG5_pSol   met;
+  size_t      rs,pos;
+  double      v[6];
+  int         np,ntyp,typ,k,i,ier;
+  char        *name;
 
-  lenmax = PMMG_count_digits ( parmesh->nprocs );
+  assert( parmesh->ngrp == 1 );
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
 
-  /* Check for pointer validity */
-  if ( (!endname) || (!initname) ) {
-    return;
+  name = PMMG_meshb_name(filename,".solb",".sol");
+  if ( !name ) return -1;
+
+  if ( !PMMG_meshb_map(&mb,name) ) {
+    MMG5_SAFE_FREE(name);
+    return -1;
   }
 
-  MMG5_SAFE_CALLOC(*endname,strlen(initname)+lenmax+7,char,return);
+  ier = -1;
 
-  strcpy(*endname,initname);
+  /* Only one scalar or tensor solution at vertices, with one value per mesh
+   * vertex, is read here */
+  if ( !PMMG_meshb_onlyKwds(&mb,allowed,sizeof(allowed)/sizeof(int)) ) goto end;
+  if ( mb.kwd[3] && ( !PMMG_meshb_fits(&mb,mb.kwd[3],1,sizeof(int)) ||
+                      PMMG_meshb_int(&mb,mb.kwd[3]) != 3 ) ) goto end;
+  if ( !mb.kwd[62] || !PMMG_meshb_fits(&mb,mb.kwd[62],3,sizeof(int)) ) goto end;
 
-  ptr = strstr(*endname,".meshb");
+  np   = PMMG_meshb_int(&mb,mb.kwd[62]);
+  ntyp = PMMG_meshb_int(&mb,mb.kwd[62]+sizeof(int));
+  typ  = PMMG_meshb_int(&mb,mb.kwd[62]+2*sizeof(int));
+  if ( np != mesh->np || ntyp != 1 ||
+       ( typ != MMG5_Scalar && typ != MMG5_Tensor ) ) goto end;
 
-  fmt = 0; /* noext */
-  if( ptr ) {
-    *ptr = '\0';
-    fmt = 1; /* binary */
+  rs  = ( mb.ver == 1 ) ? sizeof(float) : sizeof(double);
+  pos = mb.kwd[62] + 3*sizeof(int);
+  if ( !PMMG_meshb_fits(&mb,pos,np,(typ==MMG5_Scalar ? 1 : 6)*rs) ) goto end;
+
+  ier = 0;
+
+  if ( mesh->info.imprim >= 0 ) {
+    fprintf(stdout,"  %%%% %s OPENED\n",name);
   }
-  else {
-    ptr = strstr(*endname,".mesh");
-    if( ptr ) {
-      *ptr = '\0';
-      fmt = 2; /* ASCII */
+
+  if ( !PMMG_Set_metSize(parmesh,MMG5_Vertex,np,typ) ) goto end;
+
+  if ( met->size == 1 ) {
+    for ( k=1; k<=np; ++k ) {
+      met->m[k] = PMMG_meshb_real(&mb,pos);
+      pos += rs;
     }
   }
-  sprintf(*endname, "%s.%d", *endname, parmesh->myrank );
-  if ( fmt==1 ) {
-    strcat ( *endname, binext );
-  }
-  else if ( fmt==2 ) {
-    strcat ( *endname, ASCIIext );
+  else {
+    for ( k=1; k<=np; ++k ) {
+      for ( i=0; i<6; ++i ) {
+        v[i] = PMMG_meshb_real(&mb,pos);
+        pos += rs;
+      }
+      /* Medit stores m11 m12 m22 m13 m23 m33 */
+      met->m[6*k  ] = v[0];
+      met->m[6*k+1] = v[1];
+      met->m[6*k+2] = v[3];
+      met->m[6*k+3] = v[2];
+      met->m[6*k+4] = v[4];
+      met->m[6*k+5] = v[5];
+    }
   }
 
-  return;
+  ier = 1;
+
+end:
+  PMMG_meshb_unmap(&mb);
+  MMG5_SAFE_FREE(name);
+
+  return ier;
 }
 
 /**
@@ -465,6 +1144,14 @@ int PMMG_loadMesh_distributed(PMMG_pParMesh parmesh,const char *filename) {
   assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
   mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
 
+  /* Binary files are mapped in memory and read in one pass */
+  ier = PMMG_loadMeshb_mmap( parmesh,data );
+  if ( ier != -1 ) {
+    mesh->info.imprim = parmesh->info.mmg_imprim;
+    MMG5_SAFE_FREE(data);
+    return ier;
+  }
+
   ier = MMG3D_loadMesh(mesh,data);
 
   /* Restore the mmg verbosity to its initial value */
@@ -603,7 +1290,11 @@ int PMMG_loadMet_distributed(PMMG_pParMesh parmesh,const char *filename) {
   assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
   mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
 
-  ier = MMG3D_loadSol(mesh,met,data);
+  /* Binary files are mapped in memory and read in one pass */
+  ier = PMMG_loadSolb_mmap( parmesh,data );
+  if ( ier == -1 ) {
+    ier = MMG3D_loadSol(mesh,met,data);
+  }
 
   /* Restore the mmg verbosity to its initial value */
   mesh->info.imprim = parmesh->info.mmg_imprim;
@@ -785,6 +1476,123 @@ int PMMG_loadAllSols_centralized(PMMG_pParMesh parmesh,const char *filename) {
 
 }
 
+int PMMG_loadLs_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  ls;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  ls   = parmesh->listgrp[0].ls;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,parmesh->lsin,ls->namein,
+                            parmesh->meshin,mesh->namein);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_loadSol(mesh,ls,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE(data);
+
+  return ier;
+}
+
+int PMMG_loadDisp_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  disp;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  disp = parmesh->listgrp[0].disp;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,parmesh->dispin,disp->namein,
+                            parmesh->meshin,mesh->namein);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_loadSol(mesh,disp,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE(data);
+
+  return ier;
+}
+
+int PMMG_loadSol_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+
+  /* For each mode: load the matching solution structure */
+  if ( mesh->info.lag >= 0 ) {
+    return PMMG_loadDisp_distributed(parmesh,filename);
+  }
+  else if ( mesh->info.iso ) {
+    return PMMG_loadLs_distributed(parmesh,filename);
+  }
+
+  return PMMG_loadMet_distributed(parmesh,filename);
+}
+
+int PMMG_loadAllSols_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  *sol;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  sol  = &parmesh->listgrp[0].field;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,parmesh->fieldin,NULL,
+                            NULL,NULL);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_loadAllSols(mesh,sol,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE(data);
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of the file to load the mesh from.
@@ -989,3 +1797,99 @@ int PMMG_saveAllSols_centralized(PMMG_pParMesh parmesh,const char *filename) {
 
   return ier;
 }
+
+int PMMG_saveLs_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  ls;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  ls   = parmesh->listgrp[0].ls;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,NULL,ls->nameout,
+                            parmesh->meshout,mesh->nameout);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_saveSol(mesh,ls,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE ( data );
+
+  return ier;
+}
+
+int PMMG_saveDisp_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  disp;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  disp = parmesh->listgrp[0].disp;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,NULL,disp->nameout,
+                            parmesh->meshout,mesh->nameout);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_saveSol(mesh,disp,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE ( data );
+
+  return ier;
+}
+
+int PMMG_saveAllSols_distributed(PMMG_pParMesh parmesh,const char *filename) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  sol;
+  int        ier;
+  char       *data = NULL;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  sol  = parmesh->listgrp[0].field;
+
+  /* Add rank index to solution name */
+  PMMG_insert_rankIndex_sol(parmesh,&data,filename,parmesh->fieldout,NULL,
+                            NULL,NULL);
+
+  /* Set mmg verbosity to the max between the Parmmg verbosity and the mmg verbosity */
+  assert ( mesh->info.imprim == parmesh->info.mmg_imprim );
+  mesh->info.imprim = MG_MAX ( parmesh->info.imprim, mesh->info.imprim );
+
+  ier = MMG3D_saveAllSols(mesh,&sol,data);
+
+  /* Restore the mmg verbosity to its initial value */
+  mesh->info.imprim = parmesh->info.mmg_imprim;
+
+  MMG5_SAFE_FREE ( data );
+
+  return ier;
+}
@@ -0,0 +1,1625 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file inoutpar_pmmg.c
+ * \brief parallel reading of centralized Medit ASCII files
+ * \copyright GNU Lesser General Public License.
+ *
+ * Each process reads with MPI-IO the lines of the file that start in its slice
+ * of bytes and parses the numbers of these lines:
+ *   - the keywords found by all the processes are gathered so each process
+ *     knows the section of its numbers and, with an exclusive scan of the
+ *     number of tokens per section, the index of its first record;
+ *   - tetrahedra are sent to a block partition of their indices (initial
+ *     partition of the mesh) and each process fetches its vertices from the
+ *     processes that have parsed them;
+ *   - tetra faces and boundary triangles meet on rendezvous processes (chosen
+ *     by a hash of their vertices) that detect the parallel faces and send the
+ *     triangles to the processes that own their faces;
+ *   - edges are forwarded by the process that has parsed their first vertex
+ *     to the processes that use this vertex.
+ * The result is a distributed mesh with face communicators, as provided by the
+ * distributed API.
+ *
+ */
+
+#include "parmmg.h"
+#include "inoutpar_pmmg.h"
+
+/** Number of bytes read after the slice of a process to complete its last
+ * line */
+#define PMMG_PREAD_MARGIN 4096
+
+/** Maximal number of bytes read by one MPI-IO call */
+#define PMMG_PREAD_CHUNK  (1<<30)
+
+/** Maximal number of keywords in the slice of a process */
+#define PMMG_PREAD_MAXKW  32
+
+/** Keywords of the Medit files that can be read in parallel */
+enum PMMG_preadKw {
+  PMMG_PREAD_Version = 0,
+  PMMG_PREAD_Dimension,
+  PMMG_PREAD_Vertices,
+  PMMG_PREAD_Edges,
+  PMMG_PREAD_Triangles,
+  PMMG_PREAD_Tetrahedra,
+  PMMG_PREAD_Corners,
+  PMMG_PREAD_RequiredVertices,
+  PMMG_PREAD_Ridges,
+  PMMG_PREAD_RequiredEdges,
+  PMMG_PREAD_RequiredTriangles,
+  PMMG_PREAD_SolAtVertices,
+  PMMG_PREAD_End,
+  PMMG_PREAD_Unknown
+};
+
+static const char *PMMG_pread_kwName[PMMG_PREAD_Unknown] = {
+  "MeshVersionFormatted","Dimension","Vertices","Edges","Triangles",
+  "Tetrahedra","Corners","RequiredVertices","Ridges","RequiredEdges",
+  "RequiredTriangles","SolAtVertices","End" };
+
+/** Number of header tokens that follow each keyword */
+static const int PMMG_pread_kwHead[PMMG_PREAD_Unknown] = {
+  1,1,1,1,1,1,1,1,1,1,1,3,0 };
+
+/** Number of tokens of the records of each keyword (-1: given by the header) */
+static const int PMMG_pread_kwRec[PMMG_PREAD_Unknown] = {
+  0,0,4,3,4,5,1,1,1,1,1,-1,0 };
+
+/** Exact powers of ten in double precision */
+static const double PMMG_pread_pow10[23] = {
+  1e0,1e1,1e2,1e3,1e4,1e5,1e6,1e7,1e8,1e9,1e10,1e11,1e12,1e13,1e14,1e15,
+  1e16,1e17,1e18,1e19,1e20,1e21,1e22 };
+
+/**
+ * \struct PMMG_preadChunk
+ * \brief Slice of a Medit ASCII file read by a process.
+ */
+typedef struct {
+  char      *buf;  /*!< bytes read by the process (null-terminated) */
+  size_t    len;   /*!< number of bytes read */
+  size_t    beg;   /*!< first byte of the lines owned by the process */
+  size_t    end;   /*!< byte after the lines owned by the process */
+  int       nkw;   /*!< number of keywords in the owned lines */
+  int       kw[PMMG_PREAD_MAXKW]; /*!< keywords in the owned lines */
+  size_t    pos[PMMG_PREAD_MAXKW+1]; /*!< start of the segments (beg, then after each keyword) */
+  long long ntok[PMMG_PREAD_MAXKW+1]; /*!< number of number tokens of the segments */
+} PMMG_preadChunk;
+
+/**
+ * \struct PMMG_preadSec
+ * \brief Section of a Medit ASCII file and part of this section owned by the
+ * process.
+ */
+typedef struct {
+  int8_t    found; /*!< 1 if the section is in the file */
+  int       rec;   /*!< number of tokens per record */
+  long long head[3]; /*!< header values */
+  int       nrec;  /*!< number of records in the file */
+  int       first; /*!< index (from 0) of the first record owned by the process */
+  int       nloc;  /*!< number of records owned by the process */
+  size_t    pos;   /*!< position in the chunk of the first owned record */
+} PMMG_preadSec;
+
+/**
+ * \struct PMMG_preadFace
+ * \brief Tetra face or boundary triangle sent to its rendezvous process.
+ */
+typedef struct {
+  int v[3];  /*!< sorted global vertices (key) */
+  int o[3];  /*!< vertices of a triangle in the order of the file */
+  int rank;  /*!< process that owns the tetra */
+  int idx;   /*!< local index of the tetra (-1 for a triangle) */
+  int ifac;  /*!< face of the tetra */
+  int ref;   /*!< triangle reference */
+  int tag;   /*!< 1 if the triangle is required */
+} PMMG_preadFace;
+
+/**
+ * \struct PMMG_preadBdy
+ * \brief Boundary or parallel triangle sent back to a tetra owner.
+ */
+typedef struct {
+  int idx;   /*!< local index of the tetra */
+  int ifac;  /*!< face of the tetra */
+  int other; /*!< process that owns the other tetra of a parallel face, -1 */
+  int key;   /*!< global index of a parallel face */
+  int ref;   /*!< triangle reference */
+  int tag;   /*!< 1 if the triangle is required */
+  int o[3];  /*!< vertices of a triangle of the file, -1 otherwise */
+} PMMG_preadBdy;
+
+/**
+ * \param p pointer toward a position in a null-terminated buffer.
+ *
+ * \return the position of the next token (spaces and comments are skipped).
+ *
+ */
+static inline
+const char* PMMG_pread_skip(const char *p) {
+  for ( ;; ) {
+    while ( *p && isspace((unsigned char)*p) ) ++p;
+    if ( *p != '#' ) return p;
+    while ( *p && *p != '\n' ) ++p;
+  }
+}
+
+/**
+ * \param c character.
+ *
+ * \return 1 if \a c ends a token.
+ *
+ */
+static inline
+int PMMG_pread_isSep(char c) {
+  return ( !c || c=='#' || isspace((unsigned char)c) );
+}
+
+/**
+ * \param pp pointer toward the position in the buffer (updated).
+ * \param val parsed value.
+ *
+ * \return 1 if success, 0 if the next token is not an integer.
+ *
+ */
+static inline
+int PMMG_pread_int(const char **pp,int *val) {
+  const char *p;
+  long long  k;
+  int        neg;
+
+  p   = PMMG_pread_skip(*pp);
+  neg = 0;
+  if ( *p=='-' || *p=='+' ) {
+    neg = ( *p=='-' );
+    ++p;
+  }
+  if ( !isdigit((unsigned char)*p) ) return 0;
+
+  k = 0;
+  while ( isdigit((unsigned char)*p) ) {
+    k = 10*k + (*p - '0');
+    if ( k > INT_MAX ) return 0;
+    ++p;
+  }
+  if ( !PMMG_pread_isSep(*p) ) return 0;
+
+  *val = neg ? -(int)k : (int)k;
+  *pp  = p;
+  return 1;
+}
+
+/**
+ * \param pp pointer toward the position in the buffer (updated).
+ * \param val parsed value.
+ *
+ * \return 1 if success, 0 if the next token is not a real.
+ *
+ * Numbers with at most 19 significant digits whose mantissa and power of ten
+ * are exactly representable are converted with one multiplication or division
+ * (correctly rounded), the others by strtod.
+ *
+ */
+static inline
+int PMMG_pread_real(const char **pp,double *val) {
+  const char         *p,*s;
+  unsigned long long mant;
+  int                neg,nd,e,ex,esgn,any,slow;
+
+  s = p = PMMG_pread_skip(*pp);
+
+  neg = 0;
+  if ( *p=='-' || *p=='+' ) {
+    neg = ( *p=='-' );
+    ++p;
+  }
+
+  mant = 0;
+  nd = e = any = slow = 0;
+  while ( isdigit((unsigned char)*p) ) {
+    if ( nd < 19 ) {
+      mant = 10*mant + (*p - '0');
+      if ( mant ) ++nd;
+    }
+    else {
+      slow = 1;
+    }
+    any = 1;
+    ++p;
+  }
+  if ( *p=='.' ) {
+    ++p;
+    while ( isdigit((unsigned char)*p) ) {
+      if ( nd < 19 ) {
+        mant = 10*mant + (*p - '0');
+        if ( mant ) ++nd;
+        --e;
+      }
+      else {
+        slow = 1;
+      }
+      any = 1;
+      ++p;
+    }
+  }
+  if ( !any ) return 0;
+
+  if ( *p=='e' || *p=='E' ) {
+    ++p;
+    esgn = 1;
+    if ( *p=='-' || *p=='+' ) {
+      esgn = ( *p=='-' ) ? -1 : 1;
+      ++p;
+    }
+    if ( !isdigit((unsigned char)*p) ) return 0;
+    ex = 0;
+    while ( isdigit((unsigned char)*p) ) {
+      if ( ex < 10000 ) ex = 10*ex + (*p - '0');
+      ++p;
+    }
+    e += esgn*ex;
+  }
+  if ( !PMMG_pread_isSep(*p) ) return 0;
+
+  if ( !slow && mant <= (1ULL<<53) && e >= -22 && e <= 22 ) {
+    *val = (double)mant;
+    *val = ( e < 0 ) ? *val / PMMG_pread_pow10[-e] : *val * PMMG_pread_pow10[e];
+    if ( neg ) *val = -*val;
+  }
+  else {
+    *val = strtod(s,NULL);
+  }
+
+  *pp = p;
+  return 1;
+}
+
+/**
+ * \param v sorted vertices of a face.
+ * \param nprocs number of processes.
+ *
+ * \return the rendezvous process of the face.
+ *
+ */
+static inline
+int PMMG_pread_hash(const int *v,int nprocs) {
+  uint64_t h;
+
+  h = (uint64_t)v[0]*73856093ULL ^ (uint64_t)v[1]*19349663ULL
+    ^ (uint64_t)v[2]*83492791ULL;
+  return (int)(h % (uint64_t)nprocs);
+}
+
+/**
+ * \param start first record of each process (size nprocs+1).
+ * \param nprocs number of processes.
+ * \param g index (from 0) of a record.
+ *
+ * \return the process that owns the record \a g.
+ *
+ */
+static inline
+int PMMG_pread_owner(const int *start,int nprocs,int g) {
+  int lo,hi,mid;
+
+  lo = 0;
+  hi = nprocs-1;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2;
+    if ( start[mid+1] <= g ) lo = mid+1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+int PMMG_pread_compareInt(const void *a,const void *b) {
+  int i = *(const int*)a, j = *(const int*)b;
+  return ( i > j ) - ( i < j );
+}
+
+static int PMMG_pread_compareFace(const void *a,const void *b) {
+  const PMMG_preadFace *f0 = (const PMMG_preadFace*)a;
+  const PMMG_preadFace *f1 = (const PMMG_preadFace*)b;
+  int i;
+
+  for ( i=0; i<3; ++i ) {
+    if ( f0->v[i] != f1->v[i] ) return ( f0->v[i] > f1->v[i] ) ? 1 : -1;
+  }
+  /* Triangles first, then tetra faces by process */
+  if ( (f0->idx < 0) != (f1->idx < 0) ) return ( f0->idx < 0 ) ? -1 : 1;
+  if ( f0->rank != f1->rank ) return ( f0->rank > f1->rank ) ? 1 : -1;
+  return ( f0->idx > f1->idx ) - ( f0->idx < f1->idx );
+}
+
+/**
+ * \param v array of 3 integers to sort in place.
+ */
+static inline
+void PMMG_pread_sort3(int *v) {
+  int tmp;
+
+  if ( v[0] > v[1] ) { tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+  if ( v[1] > v[2] ) { tmp = v[1]; v[1] = v[2]; v[2] = tmp; }
+  if ( v[0] > v[1] ) { tmp = v[0]; v[0] = v[1]; v[1] = tmp; }
+}
+
+/**
+ * \param gvert sorted global indices of the local vertices.
+ * \param np number of local vertices.
+ * \param g global index of a vertex.
+ *
+ * \return the local index (from 1) of the vertex \a g, 0 if not found.
+ *
+ */
+static inline
+int PMMG_pread_local(const int *gvert,int np,int g) {
+  const int *found;
+
+  found = (const int*)bsearch(&g,gvert,np,sizeof(int),PMMG_pread_compareInt);
+  return found ? (int)(found - gvert) + 1 : 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param ier local status of the caller.
+ * \param lrec size of the records in bytes.
+ * \param sbuf records to send, sorted by destination.
+ * \param scnt number of records to send to each process.
+ * \param sdispl position of the first record sent to each process.
+ * \param rbuf pointer toward the allocated received records.
+ * \param rcnt number of records received from each process.
+ * \param rdispl position of the first record received from each process (size
+ * nprocs+1).
+ *
+ * \return 1 if success, 0 if fail on one process.
+ *
+ * Exchange records between all the processes (collective).
+ *
+ */
+static
+int PMMG_pread_exchange(PMMG_pParMesh parmesh,int ier,size_t lrec,void *sbuf,
+                        int *scnt,int *sdispl,void **rbuf,int *rcnt,
+                        int *rdispl) {
+  MPI_Datatype rtype;
+  char         *buf;
+  int          nprocs,ier_glob,k;
+
+  nprocs = parmesh->nprocs;
+  *rbuf  = NULL;
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             return 0 );
+  if ( !ier_glob ) return 0;
+
+  MPI_CHECK( MPI_Alltoall(scnt,1,MPI_INT,rcnt,1,MPI_INT,parmesh->comm),
+             return 0 );
+  rdispl[0] = 0;
+  for ( k=0; k<nprocs; ++k ) {
+    rdispl[k+1] = rdispl[k] + rcnt[k];
+  }
+
+  ier = 1;
+  PMMG_MALLOC(parmesh,buf,(rdispl[nprocs]+1)*lrec,char,"received records",
+              ier = 0);
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) {
+    PMMG_DEL_MEM(parmesh,buf,char,"received records");
+    return 0;
+  }
+
+  MPI_Type_contiguous((int)lrec,MPI_BYTE,&rtype);
+  MPI_Type_commit(&rtype);
+  ier = ( MPI_SUCCESS == MPI_Alltoallv(sbuf,scnt,sdispl,rtype,buf,rcnt,rdispl,
+                                       rtype,parmesh->comm) );
+  MPI_Type_free(&rtype);
+
+  *rbuf = buf;
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param fh MPI file handle.
+ * \param chk chunk to fill.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Read the slice of bytes of the process, plus a margin to complete its last
+ * line. The process owns the lines that start in its slice.
+ *
+ */
+static
+int PMMG_pread_chunk(PMMG_pParMesh parmesh,MPI_File fh,PMMG_preadChunk *chk) {
+  MPI_Offset fsize,lo,hi,off,top,done;
+  MPI_Status status;
+  size_t     i;
+  int        count,nread;
+
+  MPI_CHECK( MPI_File_get_size(fh,&fsize), return 0 );
+
+  lo  = fsize * parmesh->myrank / parmesh->nprocs;
+  hi  = fsize * (parmesh->myrank+1) / parmesh->nprocs;
+  off = lo ? lo-1 : 0;
+  top = MG_MIN(fsize,hi+PMMG_PREAD_MARGIN);
+
+  chk->len = (size_t)(top-off);
+  PMMG_MALLOC(parmesh,chk->buf,chk->len+1,char,"file chunk",return 0);
+
+  for ( done=0; done<(MPI_Offset)chk->len; done+=nread ) {
+    count = (int)MG_MIN((MPI_Offset)PMMG_PREAD_CHUNK,(MPI_Offset)chk->len-done);
+    MPI_CHECK( MPI_File_read_at(fh,off+done,chk->buf+done,count,MPI_CHAR,&status),
+               return 0 );
+    MPI_Get_count(&status,MPI_CHAR,&nread);
+    if ( nread <= 0 ) return 0;
+  }
+  chk->buf[chk->len] = '\0';
+
+  /* Owned lines: from the first line that starts at or after lo to the first
+   * line that starts at or after hi */
+  if ( !lo ) {
+    chk->beg = 0;
+  }
+  else {
+    for ( i=0; i<chk->len && chk->buf[i]!='\n'; ++i ) ;
+    chk->beg = i+1;
+  }
+
+  if ( hi == fsize ) {
+    chk->end = chk->len;
+  }
+  else {
+    for ( i=(size_t)(hi-1-off); i<chk->len && chk->buf[i]!='\n'; ++i ) ;
+    if ( i == chk->len ) {
+      /* Line longer than the margin */
+      return 0;
+    }
+    chk->end = i+1;
+  }
+  chk->beg = MG_MIN(chk->beg,chk->end);
+
+  return 1;
+}
+
+/**
+ * \param chk chunk to scan.
+ *
+ * \return 1 if success, 0 if the chunk contains too many keywords.
+ *
+ * Find the keywords of the owned lines and count the number tokens of each
+ * segment (before the first keyword, then after each keyword).
+ *
+ */
+static
+int PMMG_pread_scan(PMMG_preadChunk *chk) {
+  const char *p,*end,*q;
+  size_t     l;
+  int        k;
+
+  chk->nkw     = 0;
+  chk->pos[0]  = chk->beg;
+  chk->ntok[0] = 0;
+
+  p   = chk->buf + chk->beg;
+  end = chk->buf + chk->end;
+  while ( (p = PMMG_pread_skip(p)) < end && *p ) {
+    q = p;
+    while ( !PMMG_pread_isSep(*q) ) ++q;
+
+    if ( isalpha((unsigned char)*p) ) {
+      if ( chk->nkw == PMMG_PREAD_MAXKW ) return 0;
+      l = (size_t)(q-p);
+      for ( k=0; k<PMMG_PREAD_Unknown; ++k ) {
+        if ( strlen(PMMG_pread_kwName[k])==l && !strncmp(p,PMMG_pread_kwName[k],l) )
+          break;
+      }
+      chk->kw[chk->nkw++]     = k;
+      chk->pos[chk->nkw]      = (size_t)(q - chk->buf);
+      chk->ntok[chk->nkw]     = 0;
+    }
+    else {
+      ++chk->ntok[chk->nkw];
+    }
+    p = q;
+  }
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param chk scanned chunk of the process.
+ * \param sec sections of the file (filled).
+ *
+ * \return 1 if success, -1 if the file content is not supported, 0 if fail.
+ *
+ * Gather the keywords of all the processes and compute the records of each
+ * section owned by the process (collective). Records may not be split between
+ * two processes, which holds for files written with one record per line.
+ *
+ */
+static
+int PMMG_pread_sections(PMMG_pParMesh parmesh,PMMG_preadChunk *chk,
+                        PMMG_preadSec *sec) {
+  const char *p;
+  long long  *cnt,*base,*tot,*head,h,t,t0,t1,nrec;
+  size_t     datapos[PMMG_PREAD_MAXKW+1];
+  int        *nkw,*displ,*kwglob,nsec,nend,gs,s,kw,nprocs,rank,ok,ok_glob,ier,k,val;
+
+  nprocs = parmesh->nprocs;
+  rank   = parmesh->myrank;
+  ier    = 0;
+  cnt    = base = tot = head = NULL;
+  kwglob = NULL;
+
+  memset(sec,0,PMMG_PREAD_Unknown*sizeof(PMMG_preadSec));
+
+  PMMG_MALLOC(parmesh,nkw,nprocs,int,"nkw",return 0);
+  PMMG_MALLOC(parmesh,displ,nprocs+1,int,"displ",
+              PMMG_DEL_MEM(parmesh,nkw,int,"nkw");return 0);
+
+  MPI_CHECK( MPI_Allgather(&chk->nkw,1,MPI_INT,nkw,1,MPI_INT,parmesh->comm),
+             goto end );
+  displ[0] = 0;
+  for ( k=0; k<nprocs; ++k ) displ[k+1] = displ[k] + nkw[k];
+  nsec = displ[nprocs];
+
+  PMMG_MALLOC(parmesh,kwglob,nsec+1,int,"kwglob",goto end);
+  PMMG_CALLOC(parmesh,cnt,nsec+1,long long,"cnt",goto end);
+  PMMG_CALLOC(parmesh,base,nsec+1,long long,"base",goto end);
+  PMMG_CALLOC(parmesh,tot,nsec+1,long long,"tot",goto end);
+  PMMG_MALLOC(parmesh,head,3*nsec+1,long long,"head",goto end);
+
+  MPI_CHECK( MPI_Allgatherv(chk->kw,chk->nkw,MPI_INT,kwglob,nkw,displ,MPI_INT,
+                            parmesh->comm),goto end );
+
+  /* What follows the End keyword is ignored */
+  for ( nend=0; nend<nsec && kwglob[nend]!=PMMG_PREAD_End; ++nend ) ;
+
+  /** Step 1: index of the first token of each segment in its section.
+   * Segment s of the process belongs to the global section displ[rank]+s-1. */
+  ok = 1;
+  for ( s=0; s<=chk->nkw; ++s ) {
+    gs = displ[rank]+s-1;
+    if ( gs < 0 ) {
+      /* Numbers before the first keyword */
+      if ( chk->ntok[s] ) ok = 0;
+      continue;
+    }
+    cnt[gs] += chk->ntok[s];
+  }
+  MPI_CHECK( MPI_Exscan(cnt,base,nsec,MPI_LONG_LONG,MPI_SUM,parmesh->comm),
+             goto end );
+  if ( !rank ) {
+    for ( gs=0; gs<nsec; ++gs ) base[gs] = 0;
+  }
+  MPI_CHECK( MPI_Allreduce(cnt,tot,nsec,MPI_LONG_LONG,MPI_SUM,parmesh->comm),
+             goto end );
+
+  /** Step 2: header values (each process parses the header tokens that it
+   * owns) */
+  for ( k=0; k<3*nsec; ++k ) head[k] = -1;
+  for ( s=0; s<=chk->nkw; ++s ) {
+    gs = displ[rank]+s-1;
+    datapos[s] = chk->pos[s];
+    if ( gs < 0 || gs >= nend || kwglob[gs] == PMMG_PREAD_Unknown ) continue;
+
+    h = PMMG_pread_kwHead[kwglob[gs]];
+    p = chk->buf + chk->pos[s];
+    for ( t=base[gs]; t<h && t<base[gs]+chk->ntok[s]; ++t ) {
+      if ( !PMMG_pread_int(&p,&val) ) ok = 0;
+      head[3*gs+t] = val;
+    }
+    datapos[s] = (size_t)(p - chk->buf);
+  }
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,head,3*nsec,MPI_LONG_LONG,MPI_MAX,
+                           parmesh->comm),goto end );
+
+  /** Step 3: sections (identical on all the processes) and owned records */
+  ier = -1;
+  for ( gs=0; gs<nsec; ++gs ) {
+    kw = kwglob[gs];
+    if ( kw == PMMG_PREAD_Unknown || sec[kw].found ) goto end;
+    if ( kw == PMMG_PREAD_End ) break;
+
+    sec[kw].found = 1;
+    for ( k=0; k<3; ++k ) sec[kw].head[k] = head[3*gs+k];
+    h = PMMG_pread_kwHead[kw];
+
+    if ( kw == PMMG_PREAD_Dimension && head[3*gs] != 3 ) goto end;
+
+    sec[kw].rec = PMMG_pread_kwRec[kw];
+    if ( kw == PMMG_PREAD_SolAtVertices ) {
+      /* One scalar or tensor solution */
+      if ( head[3*gs+1] != 1 ) goto end;
+      if ( head[3*gs+2] == MMG5_Scalar ) sec[kw].rec = 1;
+      else if ( head[3*gs+2] == MMG5_Tensor ) sec[kw].rec = 6;
+      else goto end;
+    }
+
+    if ( !sec[kw].rec ) {
+      if ( tot[gs] != h ) goto end;
+      continue;
+    }
+    nrec = head[3*gs];
+    if ( nrec < 0 || nrec > INT_MAX || tot[gs] != h + nrec*sec[kw].rec ) goto end;
+    sec[kw].nrec = (int)nrec;
+
+    /* Segment of the process in this section */
+    s = gs - displ[rank] + 1;
+    if ( s < 0 || s > chk->nkw ) continue;
+
+    t0 = MG_MAX(base[gs],h) - h;
+    t1 = base[gs] + chk->ntok[s] - h;
+    if ( t1 <= t0 ) continue;
+    if ( t0 % sec[kw].rec || t1 % sec[kw].rec ) {
+      /* A record is split between two processes */
+      ok = 0;
+      continue;
+    }
+    sec[kw].first = (int)(t0 / sec[kw].rec);
+    sec[kw].nloc  = (int)((t1-t0) / sec[kw].rec);
+    sec[kw].pos   = datapos[s];
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ok,&ok_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier = 0; goto end );
+  ier = ok_glob ? 1 : -1;
+
+end:
+  PMMG_DEL_MEM(parmesh,nkw,int,"nkw");
+  PMMG_DEL_MEM(parmesh,displ,int,"displ");
+  PMMG_DEL_MEM(parmesh,kwglob,int,"kwglob");
+  PMMG_DEL_MEM(parmesh,cnt,long long,"cnt");
+  PMMG_DEL_MEM(parmesh,base,long long,"base");
+  PMMG_DEL_MEM(parmesh,tot,long long,"tot");
+  PMMG_DEL_MEM(parmesh,head,long long,"head");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the file.
+ * \param chk chunk of the process (filled).
+ * \param sec sections of the file (filled).
+ *
+ * \return 1 if success, -2 if the file can't be opened, -1 if its content is
+ * not supported, 0 if fail.
+ *
+ * Read and index a Medit ASCII file in parallel (collective).
+ *
+ */
+static
+int PMMG_pread_file(PMMG_pParMesh parmesh,const char *filename,
+                    PMMG_preadChunk *chk,PMMG_preadSec *sec) {
+  MPI_File fh;
+  int      ier,ier_glob;
+
+  memset(chk,0,sizeof(PMMG_preadChunk));
+
+  if ( MPI_SUCCESS != MPI_File_open(parmesh->comm,filename,MPI_MODE_RDONLY,
+                                    MPI_INFO_NULL,&fh) ) {
+    return -2;
+  }
+
+  ier = PMMG_pread_chunk(parmesh,fh,chk);
+  MPI_File_close(&fh);
+
+  if ( ier ) ier = PMMG_pread_scan(chk) ? 1 : -1;
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( ier_glob < 1 ) {
+    /* Lines longer than the margin or too many keywords: use the serial
+     * reader */
+    return -1;
+  }
+
+  return PMMG_pread_sections(parmesh,chk,sec);
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param sec section.
+ * \param start first record of each process (size nprocs+1, filled).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Gather the records of a section owned by each process (collective).
+ *
+ */
+static
+int PMMG_pread_ranges(PMMG_pParMesh parmesh,PMMG_preadSec *sec,int *start) {
+  int k;
+
+  MPI_CHECK( MPI_Allgather(&sec->nloc,1,MPI_INT,start+1,1,MPI_INT,
+                           parmesh->comm),return 0 );
+  start[0] = 0;
+  for ( k=0; k<parmesh->nprocs; ++k ) start[k+1] += start[k];
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param chk chunk of the process.
+ * \param sec section of indices (corners, required entities...).
+ * \param start first record of the tagged entities on each process.
+ * \param nent number of tagged entities in the file.
+ * \param tag tags of the entities owned by the process (updated).
+ * \param bit tag to add.
+ * \param ok set to 0 if an index is invalid.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Parse a list of indices and send them to the processes that own the indexed
+ * entities to tag them (collective).
+ *
+ */
+static
+int PMMG_pread_tag(PMMG_pParMesh parmesh,PMMG_preadChunk *chk,PMMG_preadSec *sec,
+                   int *start,int nent,int8_t *tag,int8_t bit,int *ok) {
+  const char *p;
+  int        *idx,*ridx,*scnt,*sdispl,*rcnt,*rdispl,*pos,nprocs,i,k,ier;
+
+  nprocs = parmesh->nprocs;
+  ier    = 0;
+  idx = ridx = pos = scnt = sdispl = rcnt = rdispl = NULL;
+
+  PMMG_CALLOC(parmesh,scnt,nprocs,int,"scnt",goto end);
+  PMMG_CALLOC(parmesh,sdispl,nprocs+1,int,"sdispl",goto end);
+  PMMG_CALLOC(parmesh,rcnt,nprocs,int,"rcnt",goto end);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",goto end);
+  PMMG_CALLOC(parmesh,pos,nprocs,int,"pos",goto end);
+  PMMG_MALLOC(parmesh,idx,sec->nloc+1,int,"indices",goto end);
+
+  p = chk->buf + sec->pos;
+  for ( i=0; i<sec->nloc; ++i ) {
+    if ( !PMMG_pread_int(&p,&idx[i]) || idx[i] < 1 || idx[i] > nent ) {
+      *ok = 0;
+      idx[i] = 0;
+      continue;
+    }
+    ++scnt[PMMG_pread_owner(start,nprocs,idx[i]-1)];
+  }
+  for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+
+  PMMG_MALLOC(parmesh,ridx,sdispl[nprocs]+1,int,"sent indices",goto end);
+  for ( i=0; i<sec->nloc; ++i ) {
+    if ( !idx[i] ) continue;
+    k = PMMG_pread_owner(start,nprocs,idx[i]-1);
+    ridx[sdispl[k]+pos[k]++] = idx[i];
+  }
+  ier = 1;
+
+end:
+  PMMG_DEL_MEM(parmesh,idx,int,"indices");
+  if ( PMMG_pread_exchange(parmesh,ier,sizeof(int),ridx,scnt,sdispl,
+                           (void**)&idx,rcnt,rdispl) ) {
+    for ( i=0; i<rdispl[nprocs]; ++i ) {
+      tag[idx[i]-1-start[parmesh->myrank]] |= bit;
+    }
+  }
+  else {
+    ier = 0;
+  }
+
+  PMMG_DEL_MEM(parmesh,idx,int,"received indices");
+  PMMG_DEL_MEM(parmesh,ridx,int,"sent indices");
+  PMMG_DEL_MEM(parmesh,scnt,int,"scnt");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,rcnt,int,"rcnt");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,pos,int,"pos");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param n number of records to fetch.
+ * \param ids sorted global indices (from 1) of the records.
+ * \param start first record owned by each process.
+ * \param lrec size of the records in bytes.
+ * \param data records owned by the process.
+ * \param out pointer toward the allocated fetched records (in the order of \a
+ * ids).
+ * \param rids if not NULL, pointer toward the allocated indices requested to
+ * the process.
+ * \param rdispl position in \a rids of the indices requested by each process.
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Fetch records from the processes that own them (collective).
+ *
+ */
+static
+int PMMG_pread_fetch(PMMG_pParMesh parmesh,int n,int *ids,int *start,
+                     size_t lrec,char *data,char **out,int **rids,int *rdispl) {
+  char *reply;
+  int  *req,*scnt,*sdispl,*rcnt,*rdispl_loc,nprocs,i,k,ier;
+
+  nprocs = parmesh->nprocs;
+  ier    = 0;
+  req    = scnt = sdispl = rcnt = rdispl_loc = NULL;
+  reply  = NULL;
+  *out   = NULL;
+
+  PMMG_CALLOC(parmesh,scnt,nprocs,int,"scnt",goto end);
+  PMMG_CALLOC(parmesh,sdispl,nprocs+1,int,"sdispl",goto end);
+  PMMG_CALLOC(parmesh,rcnt,nprocs,int,"rcnt",goto end);
+  PMMG_CALLOC(parmesh,rdispl_loc,nprocs+1,int,"rdispl",goto end);
+
+  /* Indices are sorted so the requests to each process are contiguous */
+  for ( i=0; i<n; ++i ) {
+    ++scnt[PMMG_pread_owner(start,nprocs,ids[i]-1)];
+  }
+  for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+  ier = 1;
+
+end:
+  if ( !PMMG_pread_exchange(parmesh,ier,sizeof(int),ids,scnt,sdispl,
+                            (void**)&req,rcnt,rdispl_loc) ) {
+    ier = 0;
+    goto free;
+  }
+
+  /* Reply in the order of the requests */
+  ier = 1;
+  PMMG_MALLOC(parmesh,reply,(rdispl_loc[nprocs]+1)*lrec,char,"reply",ier = 0);
+  if ( ier ) {
+    for ( i=0; i<rdispl_loc[nprocs]; ++i ) {
+      memcpy(reply+i*lrec,data+(size_t)(req[i]-1-start[parmesh->myrank])*lrec,lrec);
+    }
+  }
+  if ( !PMMG_pread_exchange(parmesh,ier,lrec,reply,rcnt,rdispl_loc,
+                            (void**)out,scnt,sdispl) ) {
+    ier = 0;
+  }
+
+free:
+  PMMG_DEL_MEM(parmesh,reply,char,"reply");
+  if ( rids && ier ) {
+    *rids = req;
+    memcpy(rdispl,rdispl_loc,(nprocs+1)*sizeof(int));
+  }
+  else {
+    PMMG_DEL_MEM(parmesh,req,int,"requests");
+  }
+  PMMG_DEL_MEM(parmesh,scnt,int,"scnt");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,rcnt,int,"rcnt");
+  PMMG_DEL_MEM(parmesh,rdispl_loc,int,"rdispl");
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param ier local status of the caller.
+ * \param ok 0 if the caller has found invalid data, 1 otherwise.
+ * \param nv number of vertices of the file.
+ * \param np number of local vertices.
+ * \param gvert sorted global indices (from 1) of the local vertices.
+ * \param vert local vertices (in the order of \a gvert).
+ * \param ntet number of local tetrahedra.
+ * \param tet global indices (from 1) of the vertices and reference of the local
+ * tetrahedra (5 values per tetra).
+ * \param ntria number of triangles read by the process.
+ * \param tria global indices (from 1) of the vertices and reference of the
+ * triangles read by the process (4 values per triangle).
+ * \param ttag required tag of these triangles (NULL if none is required).
+ * \param na number of local edges.
+ * \param edg global indices (from 1) of the vertices, reference and tags of the
+ * local edges (4 values per edge).
+ *
+ * \return 1 if success, 0 if fail, -1 if the data are invalid on a process.
+ *
+ * Build the local meshes of a block partition of the tetrahedra (collective):
+ * tetra faces and triangles meet on rendezvous processes that detect the
+ * parallel faces and send the triangles to the processes that own their faces.
+ * The parmesh is then set as a distributed mesh with face communicators.
+ *
+ */
+int PMMG_pread_buildMesh(PMMG_pParMesh parmesh,int ier,int ok,int nv,int np,
+                         int *gvert,PMMG_preadVert *vert,int ntet,int *tet,
+                         int ntria,int *tria,int8_t *ttag,int na,int *edg) {
+  PMMG_preadFace  *face,*rface;
+  PMMG_preadBdy   *bdy,*rbdy;
+  MMG5_pMesh      mesh;
+  MMG5_pPoint     ppt;
+  MMG5_pTetra     pt;
+  MMG5_pTria      ptt;
+  MMG5_pEdge      pa;
+  int             *scnt,*sdispl,*rcnt,*rdispl,*pos,*comm,*loc,*glo;
+  int             nprocs,rank,nt,nrface,nbdy,nkey,koff,nerr,nlost,ncomm,nitem;
+  int             icomm,first,m,f0,nf,dst,ier_glob,ok_glob,k,i,j,l,g;
+
+  nprocs = parmesh->nprocs;
+  rank   = parmesh->myrank;
+  mesh   = parmesh->listgrp[0].mesh;
+
+  scnt = sdispl = rcnt = rdispl = pos = comm = loc = glo = NULL;
+  face = rface = NULL;
+  bdy = rbdy = NULL;
+
+  PMMG_CALLOC(parmesh,scnt,nprocs,int,"scnt",ier = 0);
+  PMMG_CALLOC(parmesh,sdispl,nprocs+1,int,"sdispl",ier = 0);
+  PMMG_CALLOC(parmesh,rcnt,nprocs,int,"rcnt",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,pos,nprocs,int,"pos",ier = 0);
+
+  /** Step 1: tetra faces and triangles meet on rendezvous processes */
+  l = 4*ntet + ntria;
+  PMMG_MALLOC(parmesh,face,l+1,PMMG_preadFace,"faces",ier = 0);
+  PMMG_MALLOC(parmesh,rface,l+1,PMMG_preadFace,"faces",ier = 0);
+  if ( ier ) {
+    l = 0;
+    for ( k=0; k<ntet; ++k ) {
+      for ( i=0; i<4; ++i ) {
+        for ( j=0; j<3; ++j ) {
+          face[l].v[j] = tet[5*k+MMG5_idir[i][j]];
+          face[l].o[j] = -1;
+        }
+        PMMG_pread_sort3(face[l].v);
+        face[l].rank = rank;
+        face[l].idx  = k;
+        face[l].ifac = i;
+        face[l].ref  = face[l].tag = 0;
+        ++l;
+      }
+    }
+    for ( k=0; k<ntria; ++k ) {
+      for ( j=0; j<3; ++j ) {
+        if ( tria[4*k+j] < 1 || tria[4*k+j] > nv ) ok = 0;
+        face[l].v[j] = face[l].o[j] = tria[4*k+j];
+      }
+      PMMG_pread_sort3(face[l].v);
+      face[l].rank = rank;
+      face[l].idx  = -1;
+      face[l].ifac = -1;
+      face[l].ref  = abs(tria[4*k+3]);
+      face[l].tag  = ttag ? ttag[k] : 0;
+      ++l;
+    }
+    for ( k=0; k<l; ++k ) {
+      ++scnt[PMMG_pread_hash(face[k].v,nprocs)];
+    }
+    for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+    for ( k=0; k<l; ++k ) {
+      dst = PMMG_pread_hash(face[k].v,nprocs);
+      rface[sdispl[dst]+pos[dst]++] = face[k];
+    }
+  }
+  PMMG_DEL_MEM(parmesh,face,PMMG_preadFace,"faces");
+  if ( !PMMG_pread_exchange(parmesh,ier,sizeof(PMMG_preadFace),rface,scnt,sdispl,
+                            (void**)&face,rcnt,rdispl) ) {
+    ier = 0;
+    goto end;
+  }
+  PMMG_DEL_MEM(parmesh,rface,PMMG_preadFace,"faces");
+  nrface = rdispl[nprocs];
+  qsort(face,nrface,sizeof(PMMG_preadFace),PMMG_pread_compareFace);
+
+  /* First pass to count the triangles to send back and the parallel faces,
+   * second pass to fill them */
+  nkey = nerr = nlost = koff = 0;
+  for ( l=0; l<2; ++l ) {
+    for ( k=0; k<nprocs; ++k ) pos[k] = 0;
+    if ( !l ) {
+      for ( k=0; k<nprocs; ++k ) scnt[k] = 0;
+    }
+    nkey  = 0;
+    first = 0;
+    while ( first < nrface ) {
+      for ( m=first+1; m<nrface; ++m ) {
+        if ( face[m].v[0] != face[first].v[0] || face[m].v[1] != face[first].v[1] ||
+             face[m].v[2] != face[first].v[2] ) break;
+      }
+      /* Skip duplicated triangles */
+      for ( f0=first; f0<m && face[f0].idx<0; ++f0 ) ;
+      nf = m - f0;
+      if ( nf > 2 ) {
+        if ( !l ) ++nerr;
+      }
+      else if ( nf == 2 && face[f0].rank != face[f0+1].rank ) {
+        /* Parallel face */
+        for ( i=0; i<2; ++i ) {
+          dst = face[f0+i].rank;
+          if ( !l ) {
+            ++scnt[dst];
+            continue;
+          }
+          j = sdispl[dst]+pos[dst]++;
+          bdy[j].idx   = face[f0+i].idx;
+          bdy[j].ifac  = face[f0+i].ifac;
+          bdy[j].other = face[f0+1-i].rank;
+          bdy[j].key   = koff + nkey;
+          bdy[j].ref   = ( f0 > first ) ? face[first].ref : 0;
+          bdy[j].tag   = ( f0 > first ) ? face[first].tag : 0;
+          for ( g=0; g<3; ++g ) bdy[j].o[g] = face[first].o[g];
+        }
+        ++nkey;
+      }
+      else if ( nf && f0 > first ) {
+        /* Boundary triangle (or triangle between two local tetra) */
+        dst = face[f0].rank;
+        if ( !l ) {
+          ++scnt[dst];
+        }
+        else {
+          j = sdispl[dst]+pos[dst]++;
+          bdy[j].idx   = face[f0].idx;
+          bdy[j].ifac  = face[f0].ifac;
+          bdy[j].other = -1;
+          bdy[j].key   = -1;
+          bdy[j].ref   = face[first].ref;
+          bdy[j].tag   = face[first].tag;
+          for ( g=0; g<3; ++g ) bdy[j].o[g] = face[first].o[g];
+        }
+      }
+      else if ( !nf && !l ) {
+        ++nlost;
+      }
+      first = m;
+    }
+
+    if ( !l ) {
+      for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+      PMMG_MALLOC(parmesh,bdy,sdispl[nprocs]+1,PMMG_preadBdy,"triangles to send",
+                  ier = 0);
+      MPI_CHECK( MPI_Exscan(&nkey,&koff,1,MPI_INT,MPI_SUM,parmesh->comm),
+                 ier = 0 );
+      if ( !rank ) koff = 0;
+      if ( !ier ) break;
+    }
+  }
+  if ( nerr ) ok = 0;
+  PMMG_DEL_MEM(parmesh,face,PMMG_preadFace,"faces");
+
+  if ( !PMMG_pread_exchange(parmesh,ier,sizeof(PMMG_preadBdy),bdy,scnt,sdispl,
+                            (void**)&rbdy,rcnt,rdispl) ) {
+    ier = 0;
+    goto end;
+  }
+  PMMG_DEL_MEM(parmesh,bdy,PMMG_preadBdy,"triangles to send");
+  nbdy = rdispl[nprocs];
+
+  MPI_CHECK( MPI_Allreduce(&ok,&ok_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier = 0; goto end );
+  if ( !ok_glob ) {
+    /* Invalid or unsupported data: let the serial reader report it */
+    ier = -1;
+    goto end;
+  }
+  MPI_Allreduce(MPI_IN_PLACE,&nlost,1,MPI_INT,MPI_SUM,parmesh->comm);
+  if ( nlost && !rank && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stderr,"\n  ## Warning: %s: %d triangles are not faces of"
+            " tetrahedra and are ignored.\n",__func__,nlost);
+  }
+
+  /** Step 2: build the local mesh */
+  nt = nbdy;
+  ier = PMMG_Set_meshSize(parmesh,np,ntet,0,nt,0,na);
+
+  if ( ier ) {
+    for ( k=1; k<=np; ++k ) {
+      ppt = &mesh->point[k];
+      memcpy(ppt->c,vert[k-1].c,3*sizeof(double));
+      ppt->ref = vert[k-1].ref;
+    }
+    for ( k=1; k<=ntet; ++k ) {
+      pt = &mesh->tetra[k];
+      for ( i=0; i<4; ++i ) {
+        pt->v[i] = PMMG_pread_local(gvert,np,tet[5*(k-1)+i]);
+      }
+      pt->ref = abs(tet[5*(k-1)+4]);
+    }
+    for ( k=1; k<=nt; ++k ) {
+      ptt = &mesh->tria[k];
+      for ( i=0; i<3; ++i ) {
+        g = ( rbdy[k-1].o[0] > 0 ) ? rbdy[k-1].o[i] :
+          tet[5*rbdy[k-1].idx+MMG5_idir[rbdy[k-1].ifac][i]];
+        ptt->v[i] = PMMG_pread_local(gvert,np,g);
+      }
+      ptt->ref = rbdy[k-1].ref;
+    }
+    for ( k=1; k<=na; ++k ) {
+      pa = &mesh->edge[k];
+      pa->a    = PMMG_pread_local(gvert,np,edg[4*(k-1)]);
+      pa->b    = PMMG_pread_local(gvert,np,edg[4*(k-1)+1]);
+      pa->ref  = edg[4*(k-1)+2];
+      pa->tag |= MG_REF;
+    }
+
+    /* Vertex tags, tetra orientation and reference checks */
+    ier = PMMG_Set_meshFromPtr(parmesh);
+  }
+
+  if ( ier ) {
+    for ( k=1; k<=np; ++k ) {
+      if ( vert[k-1].tag & 1 ) ier = MG_MIN(ier,PMMG_Set_corner(parmesh,k));
+      if ( vert[k-1].tag & 2 ) ier = MG_MIN(ier,PMMG_Set_requiredVertex(parmesh,k));
+    }
+    for ( k=1; k<=na; ++k ) {
+      if ( edg[4*(k-1)+3] & 1 ) ier = MG_MIN(ier,PMMG_Set_ridge(parmesh,k));
+      if ( edg[4*(k-1)+3] & 2 ) ier = MG_MIN(ier,PMMG_Set_requiredEdge(parmesh,k));
+    }
+    for ( k=1; k<=nt; ++k ) {
+      if ( rbdy[k-1].tag ) ier = MG_MIN(ier,PMMG_Set_requiredTriangle(parmesh,k));
+    }
+  }
+
+  /** Step 3: face communicators */
+  if ( ier ) ier = PMMG_Set_iparameter(parmesh,PMMG_IPARAM_APImode,
+                                       PMMG_APIDISTRIB_faces);
+  if ( ier ) {
+    /* Parallel faces sorted by process */
+    nitem = 0;
+    PMMG_MALLOC(parmesh,comm,3*nt+1,int,"parallel faces",ier = 0);
+    if ( ier ) {
+      for ( k=0; k<nt; ++k ) {
+        if ( rbdy[k].other < 0 ) continue;
+        comm[3*nitem  ] = rbdy[k].other;
+        comm[3*nitem+1] = rbdy[k].key;
+        comm[3*nitem+2] = k+1;
+        ++nitem;
+      }
+      qsort(comm,nitem,3*sizeof(int),PMMG_pread_compareInt);
+
+      ncomm = 0;
+      for ( k=0; k<nitem; ++k ) {
+        if ( !k || comm[3*k] != comm[3*(k-1)] ) ++ncomm;
+      }
+      ier = PMMG_Set_numberOfFaceCommunicators(parmesh,ncomm);
+    }
+    if ( ier ) {
+      PMMG_MALLOC(parmesh,loc,nitem+1,int,"idx_loc",ier = 0);
+      PMMG_MALLOC(parmesh,glo,nitem+1,int,"idx_glo",ier = 0);
+    }
+    icomm = 0;
+    for ( k=0; ier && k<nitem; k=m ) {
+      for ( m=k; m<nitem && comm[3*m]==comm[3*k]; ++m ) {
+        glo[m-k] = comm[3*m+1];
+        loc[m-k] = comm[3*m+2];
+      }
+      ier = PMMG_Set_ithFaceCommunicatorSize(parmesh,icomm,comm[3*k],m-k);
+      if ( ier ) {
+        ier = PMMG_Set_ithFaceCommunicator_faces(parmesh,icomm,loc,glo,1);
+      }
+      ++icomm;
+    }
+  }
+
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  ier = ier_glob;
+
+end:
+  PMMG_DEL_MEM(parmesh,scnt,int,"scnt");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,rcnt,int,"rcnt");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,pos,int,"pos");
+  PMMG_DEL_MEM(parmesh,comm,int,"parallel faces");
+  PMMG_DEL_MEM(parmesh,loc,int,"idx_loc");
+  PMMG_DEL_MEM(parmesh,glo,int,"idx_glo");
+  PMMG_DEL_MEM(parmesh,face,PMMG_preadFace,"faces");
+  PMMG_DEL_MEM(parmesh,rface,PMMG_preadFace,"faces");
+  PMMG_DEL_MEM(parmesh,bdy,PMMG_preadBdy,"triangles to send");
+  PMMG_DEL_MEM(parmesh,rbdy,PMMG_preadBdy,"received triangles");
+
+  return ier;
+}
+
+int PMMG_loadMesh_parallel(PMMG_pParMesh parmesh,const char *filename,
+                           const char *metname) {
+  PMMG_preadChunk chk,chkm;
+  PMMG_preadSec   sec[PMMG_PREAD_Unknown],secm[PMMG_PREAD_Unknown];
+  PMMG_preadVert  *vert,*vfetch;
+  MMG5_pMesh      mesh;
+  MMG5_pSol       met;
+  const char      *p;
+  double          *sol,*mfetch,v[6];
+  int8_t          *vtag,*etag,*ttag;
+  int             *scnt,*sdispl,*rcnt,*rdispl,*pos,*vstart,*estart,*tstart,*mstart;
+  int             *tet,*rtet,*gvert,*vreq,*vreqdispl,*edg,*redg,*fedg,*req1,*req2;
+  int             *tria,nprocs,rank,ne,np,nv,ntet,nedg,nfedg,dst,lrec;
+  int             ier,ier_glob,ok,hasMet,k,i,j,l,g,typ;
+
+  nprocs = parmesh->nprocs;
+  rank   = parmesh->myrank;
+
+  if ( parmesh->ngrp != 1 ) {
+    fprintf(stderr,"  ## Error: %s: you must have exactly 1 group in you parmesh.",
+            __func__);
+    return 0;
+  }
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
+
+  if ( !filename ) {
+    filename = parmesh->meshin ? parmesh->meshin : mesh->namein;
+  }
+  if ( !filename || !strstr(filename,".mesh") || strstr(filename,".meshb") ) {
+    /* Only ASCII Medit files are read in parallel */
+    return -1;
+  }
+  if ( metname && ( strstr(metname,".solb") || !strstr(metname,".sol") ) ) {
+    return -1;
+  }
+
+  scnt = sdispl = rcnt = rdispl = pos = NULL;
+  vstart = estart = tstart = mstart = NULL;
+  tet = rtet = gvert = vreq = vreqdispl = edg = redg = fedg = NULL;
+  req1 = req2 = tria = NULL;
+  vert = vfetch = NULL;
+  sol = mfetch = NULL;
+  vtag = etag = ttag = NULL;
+  memset(&chkm,0,sizeof(PMMG_preadChunk));
+  hasMet = 0;
+
+  /** Step 1: read and index the files. Until the mesh is built, unsupported
+   * contents return -1 so the serial reader can be used instead. */
+  ier = PMMG_pread_file(parmesh,filename,&chk,sec);
+  if ( ier < 1 ) {
+    PMMG_DEL_MEM(parmesh,chk.buf,char,"file chunk");
+    return ier == 0 ? 0 : -1;
+  }
+  if ( !sec[PMMG_PREAD_Vertices].found || !sec[PMMG_PREAD_Tetrahedra].found ||
+       sec[PMMG_PREAD_SolAtVertices].found ||
+       sec[PMMG_PREAD_Tetrahedra].nrec < nprocs ) {
+    PMMG_DEL_MEM(parmesh,chk.buf,char,"file chunk");
+    return -1;
+  }
+  nv = sec[PMMG_PREAD_Vertices].nrec;
+  ne = sec[PMMG_PREAD_Tetrahedra].nrec;
+
+  if ( metname ) {
+    ier = PMMG_pread_file(parmesh,metname,&chkm,secm);
+    if ( ier == -2 ) {
+      /* No metric */
+      ier = 1;
+    }
+    else if ( ier == 1 ) {
+      hasMet = 1;
+      if ( !secm[PMMG_PREAD_SolAtVertices].found ||
+           secm[PMMG_PREAD_SolAtVertices].nrec != nv ||
+           secm[PMMG_PREAD_Vertices].found || secm[PMMG_PREAD_Tetrahedra].found ) {
+        ier = -1;
+      }
+    }
+    if ( ier < 1 ) {
+      PMMG_DEL_MEM(parmesh,chk.buf,char,"file chunk");
+      PMMG_DEL_MEM(parmesh,chkm.buf,char,"file chunk");
+      return ier == 0 ? 0 : -1;
+    }
+  }
+
+  if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
+    fprintf(stdout,"  %%%% %s OPENED ON %d PROCESSES\n",filename,nprocs);
+  }
+
+  /** Step 2: parse the owned records */
+  ier = ok = 1;
+  PMMG_CALLOC(parmesh,scnt,nprocs,int,"scnt",ier = 0);
+  PMMG_CALLOC(parmesh,sdispl,nprocs+1,int,"sdispl",ier = 0);
+  PMMG_CALLOC(parmesh,rcnt,nprocs,int,"rcnt",ier = 0);
+  PMMG_CALLOC(parmesh,rdispl,nprocs+1,int,"rdispl",ier = 0);
+  PMMG_CALLOC(parmesh,pos,nprocs,int,"pos",ier = 0);
+  PMMG_MALLOC(parmesh,vstart,nprocs+1,int,"vstart",ier = 0);
+  PMMG_MALLOC(parmesh,estart,nprocs+1,int,"estart",ier = 0);
+  PMMG_MALLOC(parmesh,tstart,nprocs+1,int,"tstart",ier = 0);
+  PMMG_MALLOC(parmesh,mstart,nprocs+1,int,"mstart",ier = 0);
+  PMMG_MALLOC(parmesh,vert,sec[PMMG_PREAD_Vertices].nloc+1,PMMG_preadVert,
+              "vertices",ier = 0);
+  PMMG_MALLOC(parmesh,tet,5*sec[PMMG_PREAD_Tetrahedra].nloc+1,int,"tetra",ier = 0);
+  PMMG_MALLOC(parmesh,tria,4*sec[PMMG_PREAD_Triangles].nloc+1,int,"triangles",ier = 0);
+  PMMG_CALLOC(parmesh,ttag,sec[PMMG_PREAD_Triangles].nloc+1,int8_t,"tria tags",ier = 0);
+  PMMG_MALLOC(parmesh,edg,3*sec[PMMG_PREAD_Edges].nloc+1,int,"edges",ier = 0);
+  PMMG_CALLOC(parmesh,etag,sec[PMMG_PREAD_Edges].nloc+1,int8_t,"edge tags",ier = 0);
+  PMMG_CALLOC(parmesh,vtag,sec[PMMG_PREAD_Vertices].nloc+1,int8_t,"vertex tags",ier = 0);
+  if ( hasMet ) {
+    PMMG_MALLOC(parmesh,sol,(size_t)secm[PMMG_PREAD_SolAtVertices].rec*
+                secm[PMMG_PREAD_SolAtVertices].nloc+1,double,"solution",ier = 0);
+  }
+
+  if ( ier ) {
+    p = chk.buf + sec[PMMG_PREAD_Vertices].pos;
+    for ( k=0; k<sec[PMMG_PREAD_Vertices].nloc; ++k ) {
+      for ( i=0; i<3; ++i ) {
+        if ( !PMMG_pread_real(&p,&vert[k].c[i]) ) ok = 0;
+      }
+      if ( !PMMG_pread_int(&p,&vert[k].ref) ) ok = 0;
+      vert[k].ref = abs(vert[k].ref);
+      if ( !ok ) break;
+    }
+    p = chk.buf + sec[PMMG_PREAD_Tetrahedra].pos;
+    for ( k=0; ok && k<5*sec[PMMG_PREAD_Tetrahedra].nloc; ++k ) {
+      if ( !PMMG_pread_int(&p,&tet[k]) ) ok = 0;
+    }
+    p = chk.buf + sec[PMMG_PREAD_Triangles].pos;
+    for ( k=0; ok && k<4*sec[PMMG_PREAD_Triangles].nloc; ++k ) {
+      if ( !PMMG_pread_int(&p,&tria[k]) ) ok = 0;
+    }
+    p = chk.buf + sec[PMMG_PREAD_Edges].pos;
+    for ( k=0; ok && k<3*sec[PMMG_PREAD_Edges].nloc; ++k ) {
+      if ( !PMMG_pread_int(&p,&edg[k]) ) ok = 0;
+    }
+    if ( hasMet ) {
+      p = chkm.buf + secm[PMMG_PREAD_SolAtVertices].pos;
+      for ( k=0; ok && k<secm[PMMG_PREAD_SolAtVertices].rec*
+              secm[PMMG_PREAD_SolAtVertices].nloc; ++k ) {
+        if ( !PMMG_pread_real(&p,&sol[k]) ) ok = 0;
+      }
+    }
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) { ier = 0; goto end; }
+
+  ier = PMMG_pread_ranges(parmesh,&sec[PMMG_PREAD_Vertices],vstart);
+  if ( ier ) ier = PMMG_pread_ranges(parmesh,&sec[PMMG_PREAD_Edges],estart);
+  if ( ier ) ier = PMMG_pread_ranges(parmesh,&sec[PMMG_PREAD_Triangles],tstart);
+  if ( ier && hasMet ) {
+    ier = PMMG_pread_ranges(parmesh,&secm[PMMG_PREAD_SolAtVertices],mstart);
+  }
+
+  /** Step 3: tag the entities listed in the index sections */
+  if ( ier ) ier = PMMG_pread_tag(parmesh,&chk,&sec[PMMG_PREAD_Corners],vstart,nv,
+                                  vtag,1,&ok);
+  if ( ier ) ier = PMMG_pread_tag(parmesh,&chk,&sec[PMMG_PREAD_RequiredVertices],
+                                  vstart,nv,vtag,2,&ok);
+  if ( ier ) ier = PMMG_pread_tag(parmesh,&chk,&sec[PMMG_PREAD_Ridges],estart,
+                                  sec[PMMG_PREAD_Edges].nrec,etag,1,&ok);
+  if ( ier ) ier = PMMG_pread_tag(parmesh,&chk,&sec[PMMG_PREAD_RequiredEdges],
+                                  estart,sec[PMMG_PREAD_Edges].nrec,etag,2,&ok);
+  if ( ier ) ier = PMMG_pread_tag(parmesh,&chk,&sec[PMMG_PREAD_RequiredTriangles],
+                                  tstart,sec[PMMG_PREAD_Triangles].nrec,ttag,1,&ok);
+
+  /* The text is no longer needed */
+  PMMG_DEL_MEM(parmesh,chk.buf,char,"file chunk");
+  PMMG_DEL_MEM(parmesh,chkm.buf,char,"file chunk");
+
+  for ( k=0; k<sec[PMMG_PREAD_Vertices].nloc; ++k ) {
+    vert[k].tag = vtag[k];
+  }
+
+  /** Step 4: block partition of the tetrahedra */
+  if ( ier ) {
+    for ( k=0; k<sec[PMMG_PREAD_Tetrahedra].nloc; ++k ) {
+      g = sec[PMMG_PREAD_Tetrahedra].first + k;
+      ++scnt[(int)((long long)g*nprocs/ne)];
+    }
+    for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+  }
+  if ( !PMMG_pread_exchange(parmesh,ier,5*sizeof(int),tet,scnt,sdispl,
+                            (void**)&rtet,rcnt,rdispl) ) {
+    ier = 0;
+    goto end;
+  }
+  PMMG_DEL_MEM(parmesh,tet,int,"tetra");
+  tet  = rtet;
+  rtet = NULL;
+  ntet = rdispl[nprocs];
+
+  /** Step 5: local vertices, fetched from the processes that have parsed them
+   * (the requests are kept to forward the edges) */
+  ier = 1;
+  PMMG_MALLOC(parmesh,gvert,4*ntet+1,int,"global vertices",ier = 0);
+  PMMG_MALLOC(parmesh,vreqdispl,nprocs+1,int,"vreqdispl",ier = 0);
+  np = 0;
+  if ( ier ) {
+    for ( k=0; k<ntet; ++k ) {
+      for ( i=0; i<4; ++i ) {
+        if ( tet[5*k+i] < 1 || tet[5*k+i] > nv ) ok = 0;
+        gvert[4*k+i] = MG_MIN(MG_MAX(tet[5*k+i],1),nv);
+      }
+    }
+    qsort(gvert,4*ntet,sizeof(int),PMMG_pread_compareInt);
+    for ( k=0; k<4*ntet; ++k ) {
+      if ( !np || gvert[k] != gvert[np-1] ) gvert[np++] = gvert[k];
+    }
+  }
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  if ( !ier_glob ) { ier = 0; goto end; }
+
+  if ( !PMMG_pread_fetch(parmesh,np,gvert,vstart,sizeof(PMMG_preadVert),
+                         (char*)vert,(char**)&vfetch,&vreq,vreqdispl) ) {
+    ier = 0;
+    goto end;
+  }
+  PMMG_DEL_MEM(parmesh,vert,PMMG_preadVert,"vertices");
+
+  if ( hasMet ) {
+    lrec = secm[PMMG_PREAD_SolAtVertices].rec*sizeof(double);
+    if ( !PMMG_pread_fetch(parmesh,np,gvert,mstart,lrec,(char*)sol,
+                           (char**)&mfetch,NULL,NULL) ) {
+      ier = 0;
+      goto end;
+    }
+    PMMG_DEL_MEM(parmesh,sol,double,"solution");
+  }
+
+  /** Step 6: edges, sent to the process that has parsed their first vertex and
+   * forwarded to the processes that use this vertex */
+  nfedg = 0;
+  if ( sec[PMMG_PREAD_Edges].nrec ) {
+    ier = 1;
+    for ( k=0; k<nprocs; ++k ) scnt[k] = pos[k] = 0;
+    for ( k=0; k<sec[PMMG_PREAD_Edges].nloc; ++k ) {
+      if ( edg[3*k] < 1 || edg[3*k] > nv || edg[3*k+1] < 1 || edg[3*k+1] > nv ) {
+        ok = 0;
+        continue;
+      }
+      ++scnt[PMMG_pread_owner(vstart,nprocs,edg[3*k]-1)];
+    }
+    for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+    PMMG_MALLOC(parmesh,fedg,4*sdispl[nprocs]+1,int,"edges to send",ier = 0);
+    if ( ier ) {
+      for ( k=0; k<sec[PMMG_PREAD_Edges].nloc; ++k ) {
+        if ( edg[3*k] < 1 || edg[3*k] > nv || edg[3*k+1] < 1 || edg[3*k+1] > nv )
+          continue;
+        dst = PMMG_pread_owner(vstart,nprocs,edg[3*k]-1);
+        j   = 4*(sdispl[dst]+pos[dst]++);
+        fedg[j  ] = edg[3*k];
+        fedg[j+1] = edg[3*k+1];
+        fedg[j+2] = abs(edg[3*k+2]);
+        fedg[j+3] = etag[k];
+      }
+    }
+    if ( !PMMG_pread_exchange(parmesh,ier,4*sizeof(int),fedg,scnt,sdispl,
+                              (void**)&redg,rcnt,rdispl) ) {
+      ier = 0;
+      goto end;
+    }
+    PMMG_DEL_MEM(parmesh,fedg,int,"edges to send");
+    nedg = rdispl[nprocs];
+
+    /* Processes that use each owned vertex (CSR) */
+    ier = 1;
+    l   = sec[PMMG_PREAD_Vertices].nloc;
+    PMMG_CALLOC(parmesh,req1,l+2,int,"vertex users",ier = 0);
+    PMMG_MALLOC(parmesh,req2,vreqdispl[nprocs]+1,int,"vertex users",ier = 0);
+    if ( ier ) {
+      for ( i=0; i<vreqdispl[nprocs]; ++i ) {
+        ++req1[vreq[i]-1-vstart[rank]+2];
+      }
+      for ( k=2; k<l+2; ++k ) req1[k] += req1[k-1];
+      for ( dst=0; dst<nprocs; ++dst ) {
+        for ( i=vreqdispl[dst]; i<vreqdispl[dst+1]; ++i ) {
+          req2[req1[vreq[i]-1-vstart[rank]+1]++] = dst;
+        }
+      }
+      /* req1[v]..req1[v+1] are now the users of v */
+
+      for ( k=0; k<nprocs; ++k ) scnt[k] = pos[k] = 0;
+      for ( i=0; i<nedg; ++i ) {
+        l = redg[4*i]-1-vstart[rank];
+        for ( j=req1[l]; j<req1[l+1]; ++j ) ++scnt[req2[j]];
+      }
+      for ( k=0; k<nprocs; ++k ) sdispl[k+1] = sdispl[k] + scnt[k];
+      PMMG_MALLOC(parmesh,fedg,4*sdispl[nprocs]+1,int,"edges to send",ier = 0);
+    }
+    if ( ier ) {
+      for ( i=0; i<nedg; ++i ) {
+        l = redg[4*i]-1-vstart[rank];
+        for ( j=req1[l]; j<req1[l+1]; ++j ) {
+          dst = req2[j];
+          memcpy(&fedg[4*(sdispl[dst]+pos[dst]++)],&redg[4*i],4*sizeof(int));
+        }
+      }
+    }
+    PMMG_DEL_MEM(parmesh,redg,int,"received edges");
+    if ( !PMMG_pread_exchange(parmesh,ier,4*sizeof(int),fedg,scnt,sdispl,
+                              (void**)&redg,rcnt,rdispl) ) {
+      ier = 0;
+      goto end;
+    }
+    PMMG_DEL_MEM(parmesh,fedg,int,"edges to send");
+
+    /* Keep the edges whose both vertices are local */
+    for ( i=0; i<rdispl[nprocs]; ++i ) {
+      if ( !PMMG_pread_local(gvert,np,redg[4*i+1]) ) continue;
+      memmove(&redg[4*nfedg],&redg[4*i],4*sizeof(int));
+      ++nfedg;
+    }
+  }
+  PMMG_DEL_MEM(parmesh,edg,int,"edges");
+
+  /** Step 7: faces, triangles and local mesh with face communicators */
+  ier = PMMG_pread_buildMesh(parmesh,ier,ok,nv,np,gvert,vfetch,ntet,tet,
+                             sec[PMMG_PREAD_Triangles].nloc,tria,ttag,nfedg,redg);
+  if ( ier < 1 ) goto end;
+
+  /** Step 8: metric */
+  if ( ier && hasMet ) {
+    typ = ( secm[PMMG_PREAD_SolAtVertices].rec == 1 ) ? MMG5_Scalar : MMG5_Tensor;
+    ier = PMMG_Set_metSize(parmesh,MMG5_Vertex,np,typ);
+    if ( ier ) {
+      if ( met->size == 1 ) {
+        for ( k=1; k<=np; ++k ) met->m[k] = mfetch[k-1];
+      }
+      else {
+        for ( k=1; k<=np; ++k ) {
+          memcpy(v,&mfetch[6*(k-1)],6*sizeof(double));
+          /* Medit stores m11 m12 m22 m13 m23 m33 */
+          met->m[6*k  ] = v[0];
+          met->m[6*k+1] = v[1];
+          met->m[6*k+2] = v[3];
+          met->m[6*k+3] = v[2];
+          met->m[6*k+4] = v[4];
+          met->m[6*k+5] = v[5];
+        }
+      }
+    }
+  }
+
+  MPI_CHECK( MPI_Allreduce(&ier,&ier_glob,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier_glob = 0 );
+  ier = ier_glob;
+
+  if ( ier && parmesh->info.imprim > PMMG_VERB_VERSION && !rank ) {
+    fprintf(stdout,"     NUMBER OF VERTICES    %8d\n",nv);
+    fprintf(stdout,"     NUMBER OF TETRAHEDRA  %8d\n",ne);
+    fprintf(stdout,"     INITIAL PARTITION: BLOCKS OF TETRAHEDRA\n");
+  }
+
+end:
+  PMMG_DEL_MEM(parmesh,chk.buf,char,"file chunk");
+  PMMG_DEL_MEM(parmesh,chkm.buf,char,"file chunk");
+  PMMG_DEL_MEM(parmesh,scnt,int,"scnt");
+  PMMG_DEL_MEM(parmesh,sdispl,int,"sdispl");
+  PMMG_DEL_MEM(parmesh,rcnt,int,"rcnt");
+  PMMG_DEL_MEM(parmesh,rdispl,int,"rdispl");
+  PMMG_DEL_MEM(parmesh,pos,int,"pos");
+  PMMG_DEL_MEM(parmesh,vstart,int,"vstart");
+  PMMG_DEL_MEM(parmesh,estart,int,"estart");
+  PMMG_DEL_MEM(parmesh,tstart,int,"tstart");
+  PMMG_DEL_MEM(parmesh,mstart,int,"mstart");
+  PMMG_DEL_MEM(parmesh,vert,PMMG_preadVert,"vertices");
+  PMMG_DEL_MEM(parmesh,vfetch,PMMG_preadVert,"vertices");
+  PMMG_DEL_MEM(parmesh,tet,int,"tetra");
+  PMMG_DEL_MEM(parmesh,rtet,int,"tetra");
+  PMMG_DEL_MEM(parmesh,gvert,int,"global vertices");
+  PMMG_DEL_MEM(parmesh,vreq,int,"requests");
+  PMMG_DEL_MEM(parmesh,vreqdispl,int,"vreqdispl");
+  PMMG_DEL_MEM(parmesh,edg,int,"edges");
+  PMMG_DEL_MEM(parmesh,redg,int,"received edges");
+  PMMG_DEL_MEM(parmesh,fedg,int,"edges to send");
+  PMMG_DEL_MEM(parmesh,req1,int,"vertex users");
+  PMMG_DEL_MEM(parmesh,req2,int,"vertex users");
+  PMMG_DEL_MEM(parmesh,tria,int,"triangles");
+  PMMG_DEL_MEM(parmesh,sol,double,"solution");
+  PMMG_DEL_MEM(parmesh,mfetch,double,"metric");
+  PMMG_DEL_MEM(parmesh,vtag,int8_t,"vertex tags");
+  PMMG_DEL_MEM(parmesh,etag,int8_t,"edge tags");
+  PMMG_DEL_MEM(parmesh,ttag,int8_t,"tria tags");
+
+  return ier;
+}
@@ -0,0 +1,51 @@
+/* =============================================================================
+**  This file is part of the parmmg software package for parallel tetrahedral
+**  mesh modification.
+**  Copyright (c) Bx INP/Inria/UBordeaux, 2017-
+**
+**  parmmg is free software: you can redistribute it and/or modify it
+**  under the terms of the GNU Lesser General Public License as published
+**  by the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  parmmg is distributed in the hope that it will be useful, but WITHOUT
+**  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+**  FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+**  License for more details.
+**
+**  You should have received a copy of the GNU Lesser General Public
+**  License and of the GNU General Public License along with parmmg (in
+**  files COPYING.LESSER and COPYING). If not, see
+**  <http://www.gnu.org/licenses/>. Please read their terms carefully and
+**  use this copy of the parmmg distribution only if you accept them.
+** =============================================================================
+*/
+
+/**
+ * \file inoutpar_pmmg.h
+ * \brief inoutpar_pmmg.c header file
+ * \copyright GNU Lesser General Public License.
+ */
+
+#ifndef INOUTPAR_PMMG_H
+
+#define INOUTPAR_PMMG_H
+
+#include "parmmg.h"
+
+/**
+ * \struct PMMG_preadVert
+ * \brief Vertex sent to the processes that use it.
+ */
+typedef struct {
+  double c[3];
+  int    ref;
+  int    tag;
+} PMMG_preadVert;
+
+int PMMG_pread_compareInt(const void *a,const void *b);
+int PMMG_pread_buildMesh(PMMG_pParMesh parmesh,int ier,int ok,int nv,int np,
+                         int *gvert,PMMG_preadVert *vert,int ntet,int *tet,
+                         int ntria,int *tria,int8_t *ttag,int na,int *edg);
+
+#endif
@@ -452,6 +452,11 @@ int PMMG_copyMetricsAndFields_point( MMG5_pMesh mesh ,MMG5_pMesh oldMesh,
  * \param oldMet pointer to the background metrics structure.
  * \param faceAreas pointer to the array of oriented face areas.
  * \param triaNormals pointer to the array of non-normalized triangle normals.
+ * \param nodeTrias pointer to the node-triangles graph of the background mesh.
+ * \param nstep pointer to the array storing the starting element and the
+ * number of localization steps of each point of the current mesh.
+ * \param startOld pointer to the array of neighbouring elements of the
+ * background points (only used with USE_POINTMAP).
  * \param permNodGlob permutation array of nodes.
  * \param inputMet 1 if user provided metric.
  * \param myrank process rank.
@@ -479,7 +484,7 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
                                       MMG5_pSol met,MMG5_pSol oldMet,
                                       MMG5_pSol field,MMG5_pSol oldField,
                                       double *faceAreas,double *triaNormals,int *nodeTrias,
-                                      int *permNodGlob,uint8_t inputMet,
+                                      int *nstep,int *startOld,int *permNodGlob,uint8_t inputMet,
                                       int myrank,int igrp,PMMG_locateStats *locStats ) {
   MMG5_pTetra pt;
   MMG5_pPoint ppt;
@@ -518,17 +523,15 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
   ier = PMMG_precompute_triaNormals( oldMesh,triaNormals );
 
   /** Interpolate metrics */
-  oldMesh->base = 0;
-  for ( ie = 1; ie < oldMesh->ne+1; ie++ ) {
-    pt = &oldMesh->tetra[ie];
-    if ( !MG_EOK(pt) ) continue;
-    pt->flag = oldMesh->base;
-  }
+  /* Remark: the tetra flags of the background mesh are visit stamps compared
+   * to oldMesh->base, which is incremented by each localization. They are
+   * initialized when the background group is created, so no reset pass over
+   * the background tetra is needed here. */
 
 #ifndef USE_POINTMAP
   ifoundTetra = ifoundTria = 1;
 #else
-  PMMG_locate_setStart( mesh,oldMesh );
+  PMMG_locate_setStart( mesh,oldMesh,nstep,startOld );
 #endif
   /* Loop on new tetrahedra, and localize their vertices in the old mesh */
   mesh->base++;
@@ -550,12 +553,13 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
       } else if ( ppt->tag & MG_BDY ) {
 
 #ifdef USE_POINTMAP
-        ifoundTria = ppt->s;
+        ifoundTria = nstep[ip];
 #endif
         /** Locate point in the old mesh */
         ier = PMMG_locatePointBdy( oldMesh, ppt,
                                    triaNormals, nodeTrias, barycoord,
-                                   &ifoundTria,&ifoundEdge, &ifoundVertex );
+                                   &ifoundTria,&ifoundEdge, &ifoundVertex,
+                                   &nstep[ip] );
 
         if( mesh->info.imprim > PMMG_VERB_ITWAVES )
           PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
@@ -600,11 +604,12 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
       } else {
 
 #ifdef USE_POINTMAP
-        ifoundTetra = ppt->s;
+        ifoundTetra = nstep[ip];
 #endif
         /** Locate point in the old volume mesh */
         ier = PMMG_locatePointVol( oldMesh, ppt,
-                                   faceAreas, barycoord, &ifoundTetra );
+                                   faceAreas, barycoord, &ifoundTetra,
+                                   &nstep[ip] );
 
         if( mesh->info.imprim > PMMG_VERB_ITWAVES )
           PMMG_locatePoint_errorCheck( mesh,ip,ier,myrank,igrp );
@@ -642,7 +647,7 @@ int PMMG_interpMetricsAndFields_mesh( MMG5_pMesh mesh,MMG5_pMesh oldMesh,
     }
   }
 #ifndef NDEBUG
-  PMMG_locate_postprocessing( mesh,oldMesh,locStats );
+  PMMG_locate_postprocessing( mesh,oldMesh,nstep,locStats );
 #endif
 
   return 1;
@@ -666,9 +671,10 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
   MMG5_pSol        met,oldMet,field,oldField;
   MMG5_Hash        hash;
   PMMG_locateStats *locStats,*mylocStats;
+  PMMG_ptMarkers   markers,oldMarkers;
   double           *faceAreas,*triaNormals;
   int              *nodeTrias;
-  int              igrp,ier;
+  int              igrp,ier,ier_alloc;
   int8_t           allocated;
 
   locStats = NULL;
@@ -699,34 +705,65 @@ int PMMG_interpMetricsAndFields( PMMG_pParMesh parmesh,int *permNodGlob ) {
     oldMet  = oldGrp->met;
     oldField = oldGrp->field;
 
-    /** Pre-allocate oriented face areas and surface unit normals */
+    /** Pre-allocate oriented face areas, surface unit normals and point
+     * markers */
     allocated = 0;
+    ier_alloc = 1;
+    faceAreas = triaNormals = NULL;
+    nodeTrias = NULL;
+    markers.flag    = markers.tmp    = markers.s    = NULL;
+    oldMarkers.flag = oldMarkers.tmp = oldMarkers.s = NULL;
     if ( mesh->nsols || (( parmesh->info.inputMet == 1 ) && ( mesh->info.hsiz <= 0.0 )) ) {
-      PMMG_MALLOC( parmesh,faceAreas,12*(oldMesh->ne+1),double,"faceAreas",return 0 );
-      PMMG_MALLOC( parmesh,triaNormals,3*(oldMesh->nt+1),double,"triaNormals",return 0 );
-      PMMG_precompute_nodeTrias( parmesh,oldMesh,&nodeTrias );
       allocated = 1;
+      PMMG_MALLOC( parmesh,faceAreas,12*(oldMesh->ne+1),double,"faceAreas",
+                   ier_alloc = 0 );
+      if ( ier_alloc ) {
+        PMMG_MALLOC( parmesh,triaNormals,3*(oldMesh->nt+1),double,"triaNormals",
+                     ier_alloc = 0 );
+      }
+      if ( ier_alloc && !PMMG_precompute_nodeTrias( parmesh,oldMesh,&nodeTrias ) ) {
+        ier_alloc = 0;
+      }
+      if ( ier_alloc && !PMMG_ptMarkers_init( parmesh,mesh,&markers,PMMG_MARK_s ) ) {
+        ier_alloc = 0;
+      }
+#ifdef USE_POINTMAP
+      if ( ier_alloc && !PMMG_ptMarkers_init( parmesh,oldMesh,&oldMarkers,PMMG_MARK_s ) ) {
+        ier_alloc = 0;
+      }
+#endif
     }
 
     mylocStats = NULL;
     if ( locStats ) {
       mylocStats = locStats + igrp;
     }
-    if( !PMMG_interpMetricsAndFields_mesh( mesh,oldMesh,met,oldMet,
-                                           field,oldField,
-                                           faceAreas,triaNormals,nodeTrias,
-                                           permNodGlob,parmesh->info.inputMet,
-                                           parmesh->myrank,igrp,mylocStats ) ) {
+    if ( !ier_alloc ) {
+      ier = 0;
+    }
+    else if( !PMMG_interpMetricsAndFields_mesh( mesh,oldMesh,met,oldMet,
+                                                field,oldField,
+                                                faceAreas,triaNormals,nodeTrias,
+                                                markers.s,oldMarkers.s,permNodGlob,
+                                                parmesh->info.inputMet,
+                                                parmesh->myrank,igrp,mylocStats ) ) {
       ier = 0;
     }
 
-    /** Deallocate oriented face areas and surface unit normals */
+    /** Deallocate oriented face areas, surface unit normals and point
+     * markers */
     if( allocated ) {
       PMMG_DEL_MEM(parmesh,faceAreas,double,"faceAreas");
       PMMG_DEL_MEM(parmesh,triaNormals,double,"triaNormals");
       PMMG_DEL_MEM(parmesh,nodeTrias,int,"nodeTrias");
+      PMMG_ptMarkers_free(parmesh,&markers);
+#ifdef USE_POINTMAP
+      PMMG_ptMarkers_free(parmesh,&oldMarkers);
+#endif
     }
 
+    /* Stop at the first allocation failure */
+    if ( !ier_alloc ) break;
   }
 
 #ifndef NDEBUG
@@ -331,6 +331,99 @@ int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh )
   return PMMG_SUCCESS;
 }
 
+/**
+ * \param  parmesh pointer to parmesh structure
+ *
+ * \return PMMG_SUCCESS if success, PMMG_LOWFAILURE if fail and return an
+ * unscaled mesh, PMMG_STRONGFAILURE if fail and return a scaled mesh.
+ *
+ * Mesh preprocessing (distributed mesh output by a previous persistent library
+ * call): set function pointers, scale mesh and display length and quality
+ * histos. The geometric analysis (tags, xtetra, xpoints) and the communicators
+ * computed during the previous call are reused, so only the metric and the
+ * fields have been updated by the user.
+ */
+int PMMG_preprocessMesh_persistent( PMMG_pParMesh parmesh )
+{
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+
+  mesh = parmesh->listgrp[0].mesh;
+  met  = parmesh->listgrp[0].met;
+
+  assert ( ( mesh != NULL ) && ( met != NULL ) && "Preprocessing empty args");
+  assert ( parmesh->analysed );
+
+  /** The mesh must be the one returned by the previous call */
+  if ( mesh->np != mesh->npi || mesh->ne != mesh->nei ) {
+    fprintf(stderr," ## Error: %s: mesh modified since the previous persistent"
+            " call.\n",__func__);
+    return PMMG_LOWFAILURE;
+  }
+
+  /** Function setters (must be assigned before quality computation) */
+  MMG3D_Set_commonFunc();
+
+  /** Mesh scaling and quality histogram */
+  if ( !MMG5_scaleMesh(mesh,met,NULL) ) {
+    return PMMG_LOWFAILURE;
+  }
+  /* Don't reset the hmin value computed when unscaling the mesh */
+  if ( !parmesh->info.sethmin ) {
+    mesh->info.sethmin = 1;
+  }
+  /* Don't reset the hmax value computed when unscaling the mesh */
+  if ( !parmesh->info.sethmax ) {
+    mesh->info.sethmax = 1;
+  }
+
+  /** specific meshing */
+  if ( mesh->info.optim && !met->np ) {
+    if ( !MMG3D_doSol(mesh,met) ) {
+      return PMMG_STRONGFAILURE;
+    }
+    MMG5_solTruncatureForOptim(mesh,met);
+  }
+
+  if ( mesh->info.hsiz > 0. ) {
+    if ( !MMG3D_Set_constantSize(mesh,met) ) {
+      return PMMG_STRONGFAILURE;
+    }
+  }
+
+  MMG3D_setfunc(mesh,met);
+  PMMG_setfunc(parmesh);
+
+  if ( !MMG3D_tetraQual( mesh, met, 0 ) ) {
+    return PMMG_STRONGFAILURE;
+  }
+
+  if ( parmesh->info.imprim > PMMG_VERB_ITWAVES && (!mesh->info.iso) && met->m ) {
+    MMG3D_prilen(mesh,met,0);
+  }
+
+  /** Mesh unscaling */
+  if ( !MMG5_unscaleMesh(mesh,met,NULL) ) {
+    return PMMG_STRONGFAILURE;
+  }
+
+  if ( !PMMG_qualhisto(parmesh,PMMG_INQUA,0) ) {
+    return PMMG_STRONGFAILURE;
+  }
+
+  /* Destroy the boundary triangles built for the previous output (the xtetra
+   * store the boundary) */
+  MMG5_DEL_MEM(mesh,mesh->tria);
+  mesh->nt = 0;
+
+  assert ( PMMG_check_extFaceComm ( parmesh ) );
+  assert ( PMMG_check_intFaceComm ( parmesh ) );
+  assert ( PMMG_check_extNodeComm ( parmesh ) );
+  assert ( PMMG_check_intNodeComm ( parmesh ) );
+
+  return PMMG_SUCCESS;
+}
+
 int PMMG_distributeMesh_centralized_timers( PMMG_pParMesh parmesh,mytime *ctim ) {
   MMG5_pMesh    mesh;
   MMG5_pSol     met;
@@ -1334,6 +1427,7 @@ int PMMG_parmmglib_post(PMMG_pParMesh parmesh) {
     break;
   case ( MMG5_FMT_VtkPvtu ): case ( PMMG_FMT_Distributed ):
   case ( PMMG_FMT_DistributedMeditASCII ): case ( PMMG_FMT_DistributedMeditBinary ):
+  case ( PMMG_FMT_HDF5 ):
 
     /* Distributed Output */
     tim = 1;
@@ -1573,11 +1667,26 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
     fprintf(stdout,"\n  -- PHASE 1 : ANALYSIS\n");
   }
 
-  assert ( parmesh->ngrp < 2 );
-  if ( parmesh->ngrp ) {
+  assert ( parmesh->restart || parmesh->ngrp < 2 );
+  met = NULL;
+  if ( parmesh->restart ) {
+    /** Restart from a checkpoint: the groups are already analysed */
+    if ( parmesh->ngrp ) {
+      met = parmesh->listgrp[0].met;
+    }
+    ier = PMMG_SUCCESS;
+  }
+  else if ( parmesh->ngrp ) {
     /** Mesh preprocessing: set function pointers, scale mesh, perform mesh
-     * analysis and display length and quality histos. */
-    ier  = PMMG_preprocessMesh_distributed( parmesh );
+     * analysis (unless it is kept from a previous persistent call) and display
+     * length and quality histos. */
+    if ( parmesh->info.persistent && parmesh->analysed ) {
+      ier  = PMMG_preprocessMesh_persistent( parmesh );
+    }
+    else {
+      ier  = PMMG_preprocessMesh_distributed( parmesh );
+    }
+    parmesh->analysed = 0;
     mesh = parmesh->listgrp[0].mesh;
     met  = parmesh->listgrp[0].met;
     if ( (ier==PMMG_STRONGFAILURE) && MMG5_unscaleMesh( mesh, met, NULL ) ) {
@@ -1602,7 +1711,7 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
   chrono(ON,&(ctim[tim]));
   if ( parmesh->info.imprim > PMMG_VERB_VERSION ) {
     fprintf( stdout,"\n  -- PHASE 2 : %s MESHING\n",
-             met->size < 6 ? "ISOTROPIC" : "ANISOTROPIC" );
+             ( met && met->size == 6 ) ? "ANISOTROPIC" : "ISOTROPIC" );
   }
 
   ier = PMMG_parmmglib1(parmesh);
@@ -1620,6 +1729,20 @@ int PMMG_parmmglib_distributed(PMMG_pParMesh parmesh) {
   ier = PMMG_parmmglib_post(parmesh);
   ierlib = MG_MAX ( ier, ierlib );
 
+  /** Persistent mode: keep the mesh analysis and the communicators for the next
+   * call if the output mesh remains distributed */
+  if ( parmesh->info.persistent && ierlib == PMMG_SUCCESS ) {
+    switch ( parmesh->info.fmtout ) {
+    case ( PMMG_UNSET ): case ( MMG5_FMT_VtkPvtu ): case ( PMMG_FMT_Distributed ):
+    case ( PMMG_FMT_DistributedMeditASCII ): case ( PMMG_FMT_DistributedMeditBinary ):
+    case ( PMMG_FMT_HDF5 ):
+      parmesh->analysed = 1;
+      break;
+    default:
+      parmesh->analysed = 0;
+    }
+  }
+
   chrono(OFF,&ctim[0]);
   printim(ctim[0].gdif,stim);
   if ( parmesh->info.imprim >= PMMG_VERB_VERSION ) {
@@ -1637,7 +1760,13 @@ int PMMG_distributeMesh_centralized( PMMG_pParMesh parmesh ) {
   int ier,iresult;
 
   /** Check input data */
-  ier = PMMG_check_inputData( parmesh );
+  if ( parmesh->restart ) {
+    /* Groups loaded from a checkpoint: options have already been checked */
+    ier = 1;
+  }
+  else {
+    ier = PMMG_check_inputData( parmesh );
+  }
   MPI_Allreduce( &ier, &iresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
   if ( !iresult ) return PMMG_LOWFAILURE;
 
@@ -80,6 +80,11 @@ enum PMMG_Param {
   PMMG_IPARAM_APImode,           /*!< [0/1], Initialize parallel library through interface faces or nodes */
   PMMG_IPARAM_globalNum,         /*!< [1,0], Compute nodes and triangles global numbering in output */
   PMMG_IPARAM_niter,             /*!< [n], Set the number of remeshing iterations */
+  PMMG_IPARAM_persistent,        /*!< [1/0], Keep the analysed mesh and the communicators between distributed library calls */
+  PMMG_IPARAM_parallelInput,     /*!< [1/0], Read centralized Medit ASCII input files on all the processes */
+  PMMG_IPARAM_loadbalancingMode, /*!< [1/2/4], Partitioner used to split the meshes into groups (see PMMG_LOADBALANCING_*) */
+  PMMG_IPARAM_partitioners,      /*!< [n], Number of processes computing the group partition in background (0 to block on the root); only the quality computation of the load balancing is overlapped */
+  PMMG_IPARAM_solPrecision,      /*!< [0/1], Send the metric and fields in double/single precision when migrating groups (see PMMG_SOLPREC_*) */
   PMMG_DPARAM_angleDetection,    /*!< [val], Value for angle detection */
   PMMG_DPARAM_hmin,              /*!< [val], Minimal mesh size */
   PMMG_DPARAM_hmax,              /*!< [val], Maximal mesh size */
@@ -135,6 +140,16 @@ enum PMMG_Param {
  *
  * Main program for the parallel remesh library for distributed meshes.
  *
+ * \remark If the \ref PMMG_IPARAM_persistent parameter is set, the mesh
+ * analysis and the communicators are kept at the end of a successful call
+ * with distributed output. The next call then only updates the quality
+ * histograms before remeshing: between the two calls, the user may only update
+ * the metric and the fields, not the mesh (calling \ref PMMG_Set_meshSize
+ * restarts from a new mesh).
+ *
+ * \remark After a call to \ref PMMG_loadCheckpoint, the preprocessing is skipped
+ * and the remeshing loop resumes at the checkpointed iteration.
+ *
  * \remark Fortran interface:
  * >   SUBROUTINE PMMG_parmmglib_distributed(parmesh,retval)\n
  * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
@@ -307,6 +322,45 @@ int  PMMG_Set_outputSolsName(PMMG_pParMesh parmesh, const char* solout);
  *
  */
 int  PMMG_Set_outputMetName(PMMG_pParMesh parmesh, const char* metout);
+/**
+ * \param parmesh pointer toward a parmesh structure.
+ * \param chkptout name of the checkpoint file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the name of the checkpoint file written at the end of each adaptation
+ * iteration (see \ref PMMG_saveCheckpoint). No checkpoint is written if the
+ * name is not set.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SET_OUTPUTCHECKPOINTNAME(parmesh,chkptout,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: chkptout\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int  PMMG_Set_outputCheckpointName(PMMG_pParMesh parmesh, const char* chkptout);
+/**
+ * \param parmesh pointer toward a parmesh structure.
+ * \param partname name of the partition file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Set the name of the file storing the initial partition of a centralized
+ * mesh. If the file holds the partition of the same mesh on the same number of
+ * processes, it is used instead of calling Metis. Otherwise the partition is
+ * computed and saved in the file for the next runs.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SET_PARTITIONNAME(parmesh,partname,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: partname\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int  PMMG_Set_partitionName(PMMG_pParMesh parmesh, const char* partname);
 
 /**
  * \param parmesh pointer toward the parmesh structure.
@@ -1713,6 +1767,155 @@ int PMMG_Get_tensorMet(PMMG_pParMesh parmesh, double *m11,double *m12, double *m
  */
 int PMMG_Get_tensorMets(PMMG_pParMesh parmesh, double *mets);
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param coor pointer toward the coordinates of the first vertex.
+ * \param cstride stride (in doubles) between two consecutive vertices in \a coor.
+ * \param refs pointer toward the reference of the first vertex (may be NULL).
+ * \param rstride stride (in integers) between two consecutive vertices in \a refs.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Give a direct access to the vertices stored in the mesh, without copy:
+ * coordinates of the \f$i^{th}\f$ vertex are (*coor)[(i-1)*cstride]\@3 and its
+ * reference is (*refs)[(i-1)*rstride]. The arrays remain owned by ParMmg:
+ * they must not be freed by the user and they are valid until the next call
+ * that allocates or remeshes the mesh (\ref PMMG_Set_meshSize,
+ * \ref PMMG_parmmglib_centralized, \ref PMMG_parmmglib_distributed, ...) or
+ * until the mesh is freed.
+ *
+ * It can be used to fill the vertices in place after \ref PMMG_Set_meshSize
+ * (in that case, \ref PMMG_Set_meshFromPtr must be called once the mesh is
+ * filled) or to read the output mesh after remeshing.
+ *
+ * \remark Fortran interface (use C_F_POINTER to access the arrays):
+ * >   SUBROUTINE PMMG_GET_VERTICESPTR(parmesh,coor,cstride,refs,rstride,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     TYPE(C_PTR), INTENT(OUT)      :: coor,refs\n
+ * >     INTEGER, INTENT(OUT)          :: cstride,rstride\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Get_verticesPtr(PMMG_pParMesh parmesh, double **coor, int *cstride,
+                         int **refs, int *rstride);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param tetra pointer toward the vertices of the first tetrahedron.
+ * \param refs pointer toward the reference of the first tetrahedron (may be NULL).
+ * \param stride stride (in integers) between two consecutive tetrahedra.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Give a direct access to the tetrahedra stored in the mesh, without copy:
+ * the vertices of the \f$i^{th}\f$ tetra are (*tetra)[(i-1)*stride]\@4 and its
+ * reference is (*refs)[(i-1)*stride]. Ownership and lifetime of the arrays
+ * are the same than for \ref PMMG_Get_verticesPtr.
+ *
+ * \remark Fortran interface (use C_F_POINTER to access the arrays):
+ * >   SUBROUTINE PMMG_GET_TETRAHEDRAPTR(parmesh,tetra,refs,stride,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     TYPE(C_PTR), INTENT(OUT)      :: tetra,refs\n
+ * >     INTEGER, INTENT(OUT)          :: stride\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Get_tetrahedraPtr(PMMG_pParMesh parmesh, int **tetra, int **refs,
+                           int *stride);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param tria pointer toward the vertices of the first triangle.
+ * \param refs pointer toward the reference of the first triangle (may be NULL).
+ * \param stride stride (in integers) between two consecutive triangles.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Give a direct access to the triangles stored in the mesh, without copy:
+ * the vertices of the \f$i^{th}\f$ triangle are (*tria)[(i-1)*stride]\@3 and
+ * its reference is (*refs)[(i-1)*stride]. Ownership and lifetime of the arrays
+ * are the same than for \ref PMMG_Get_verticesPtr.
+ *
+ * \remark Fortran interface (use C_F_POINTER to access the arrays):
+ * >   SUBROUTINE PMMG_GET_TRIANGLESPTR(parmesh,tria,refs,stride,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     TYPE(C_PTR), INTENT(OUT)      :: tria,refs\n
+ * >     INTEGER, INTENT(OUT)          :: stride\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Get_trianglesPtr(PMMG_pParMesh parmesh, int **tria, int **refs,
+                          int *stride);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param mets pointer toward the metric at the first vertex.
+ * \param size number of doubles per vertex (1 for isotropic metrics, 6 for
+ * anisotropic ones).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Give a direct access to the metric array, without copy: the metric at
+ * vertex \f$i\f$ is (*mets)[(i-1)*size]\@size (the array is contiguous, with
+ * the same layout than in \ref PMMG_Set_tensorMets). The array remains owned
+ * by ParMmg: it can be filled in place after \ref PMMG_Set_metSize and read in
+ * place after remeshing, and it is valid until the next call that allocates or
+ * remeshes the mesh or until the mesh is freed.
+ *
+ * \remark Fortran interface (use C_F_POINTER to access the arrays):
+ * >   SUBROUTINE PMMG_GET_METPTR(parmesh,mets,size,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     TYPE(C_PTR), INTENT(OUT)      :: mets\n
+ * >     INTEGER, INTENT(OUT)          :: size\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Get_metPtr(PMMG_pParMesh parmesh, double **mets, int *size);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param i position of the solution field (from 1 to the number of fields).
+ * \param s pointer toward the values of the field at the first vertex.
+ * \param size number of doubles per vertex (1, 3 or 6 for scalar, vector or
+ * tensor fields).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Give a direct access to the \a i th solution field, without copy: its value
+ * at vertex \f$k\f$ is (*s)[(k-1)*size]\@size (the same layout than in \ref
+ * PMMG_Set_ithSols_inSolsAtVertices). Ownership and lifetime of the array are
+ * the same than for \ref PMMG_Get_metPtr.
+ *
+ * \remark Fortran interface (use C_F_POINTER to access the arrays):
+ * >   SUBROUTINE PMMG_GET_ITHSOLSPTR(parmesh,i,s,size,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     INTEGER, INTENT(IN)           :: i\n
+ * >     TYPE(C_PTR), INTENT(OUT)      :: s\n
+ * >     INTEGER, INTENT(OUT)          :: size\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Get_ithSolsPtr(PMMG_pParMesh parmesh, int i, double **s, int *size);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Finalize a mesh whose vertices, tetrahedra and triangles have been filled
+ * in place through \ref PMMG_Get_verticesPtr, \ref PMMG_Get_tetrahedraPtr and
+ * \ref PMMG_Get_trianglesPtr: check the vertex indices, mark the unused
+ * vertices and reorient the tetrahedra as \ref PMMG_Set_vertex and
+ * \ref PMMG_Set_tetrahedron do.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SET_MESHFROMPTR(parmesh,retval)\n
+ * >     MMG5_DATA_PTR_T,INTENT(INOUT) :: parmesh\n
+ * >     INTEGER, INTENT(OUT)          :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+int PMMG_Set_meshFromPtr(PMMG_pParMesh parmesh);
+
 /* libparmmg_tools.c: Tools for the library */
 /**
  * \param parmesh pointer to pmmg structure
@@ -1812,6 +2015,38 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_loadMesh_centralized(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the centralized mesh file (Medit ASCII format).
+ * \param metname name of the centralized metric file (Medit ASCII format),
+ * NULL if no metric has to be read.
+ * \return 1 if success, 0 if fail, -1 if the file content can't be read in
+ * parallel (the mesh is not modified).
+ *
+ * Read a centralized mesh, and its metric if any, on all the processes (the
+ * processes read disjoint parts of the files) and distribute its tetrahedra
+ * by blocks. The parmesh is then set as a distributed mesh with face
+ * communicators, as by \ref PMMG_Set_ithFaceCommunicator_faces. Only the
+ * Vertices, Edges, Triangles, Tetrahedra, Corners, RequiredVertices, Ridges,
+ * RequiredEdges and RequiredTriangles keywords (and a SolAtVertices keyword
+ * with one scalar or tensor solution in the metric file) are supported, with
+ * one entity per line. If -1 is returned, \ref PMMG_loadMesh_centralized can
+ * be used instead.
+ *
+ * \remark Collective on the parmesh communicator.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADMESH_PARALLEL(parmesh,filename,strlen0,metname,&\n
+ * >                                     strlen1,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename,metname\n
+ * >     INTEGER, INTENT(IN)            :: strlen0,strlen1\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadMesh_parallel(PMMG_pParMesh parmesh,const char *filename,
+                             const char *metname);
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename name of file.
@@ -1917,6 +2152,79 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_loadAllSols_centralized(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return -1 data invalid, 0 no file, 1 ok.
+ *
+ * Load the level-set field of a distributed mesh. The solution file must
+ * contains only 1 solution. Insert rank index in the file name.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADLS_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadLs_distributed(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return -1 data invalid, 0 no file, 1 ok.
+ *
+ * Load the displacement field of a distributed mesh. The solution file must
+ * contains only 1 solution. Insert rank index in the file name.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADDISP_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadDisp_distributed(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return -1 data invalid, 0 no file, 1 ok.
+ *
+ * Load displacement, level-set or metric field of a distributed mesh
+ * depending on the option setted. The solution file must contains only 1
+ * solution. Insert rank index in the file name.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADSOL_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadSol_distributed(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return -1 data invalid, 0 no file, 1 ok.
+ *
+ * Load 1 or more solutions of a distributed mesh in a solution file at medit
+ * file format. Insert rank index in the file name.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADALLSOLS_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadAllSols_distributed(PMMG_pParMesh parmesh,const char *filename);
 /**
  * \param parmesh pointer toward the parmesh structure.
  * \param filename pointer toward the name of file.
@@ -2008,9 +2316,160 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog);
  *
  */
   int PMMG_saveAllSols_centralized(PMMG_pParMesh parmesh, const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the level-set field of a distributed mesh (insert rank index to
+ * filename).
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVELS_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveLs_distributed(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write the displacement field of a distributed mesh (insert rank index to
+ * filename).
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEDISP_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveDisp_distributed(PMMG_pParMesh parmesh,const char *filename);
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Write 1 or more than 1 solution of a distributed mesh in a file at medit
+ * format (insert rank index to filename).
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEALLSOLS_DISTRIBUTED(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveAllSols_distributed(PMMG_pParMesh parmesh,const char *filename);
 
 int PMMG_savePvtuMesh(PMMG_pParMesh parmesh, const char * filename);
 
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the HDF5 file (if NULL, the output mesh name is used).
+ * \return -1 if the HDF5 library is not available, 0 if failed, 1 otherwise.
+ *
+ * Collective save of the distributed mesh, metric and fields into one HDF5
+ * file (datasets shared by all the processes and indexed by the global
+ * numbering) and write the matching XDMF descriptor (file name with the .xdmf
+ * extension). Only the owned vertices and boundary triangles of each process
+ * are written.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVEMESH_HDF5(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveMesh_hdf5(PMMG_pParMesh parmesh, const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the HDF5 file (if NULL, the input mesh name is used).
+ * \return -1 if data are invalid, if the mesh has less tetrahedra than
+ * processes or if the HDF5 library is not available, 0 if the file is not
+ * found or if the reading fails, 1 otherwise.
+ *
+ * Load a mesh, a metric and fields saved by \ref PMMG_saveMesh_hdf5 (collective
+ * call). The file is opened through MPI-IO: each process reads a block of
+ * tetrahedra and of triangles, then the rows of the vertices, metric and fields
+ * that its tetrahedra use. The parmesh is set as a distributed mesh with face
+ * communicators (\a PMMG_APIDISTRIB_faces mode).
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADMESH_HDF5(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadMesh_hdf5(PMMG_pParMesh parmesh, const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the checkpoint file (if NULL, the name given to
+ * \ref PMMG_Set_outputCheckpointName is used).
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Save in a single file, shared by all the processes, the state of the parmesh
+ * between two adaptation iterations: groups (meshes, metrics and fields),
+ * communicators, current iteration and run parameters. This function is
+ * called by the remeshing loop at the end of each iteration when a checkpoint
+ * name is provided. The file is first written as \a filename.tmp and then
+ * renamed, so an interrupted writing doesn't destroy the previous checkpoint.
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_SAVECHECKPOINT(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_saveCheckpoint(PMMG_pParMesh parmesh, const char *filename);
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param filename name of the checkpoint file.
+ * \return 0 if failed, 1 otherwise.
+ *
+ * Load a checkpoint saved by \ref PMMG_saveCheckpoint, possibly on a different
+ * number of processes: the data of the old process \a o is loaded on the
+ * process \a o modulo the number of processes and the communicators are
+ * remapped. The next call to \ref PMMG_parmmglib_distributed skips the
+ * preprocessing and resumes the remeshing loop at the iteration following the
+ * checkpointed one.
+ *
+ * \remark The number of iterations is read from the checkpoint unless it has
+ * been set by the user (\ref PMMG_Set_iparameter with \a PMMG_IPARAM_niter or
+ * -niter option).
+ *
+ * \remark Fortran interface:
+ * >   SUBROUTINE PMMG_LOADCHECKPOINT(parmesh,filename,strlen,retval)\n
+ * >     MMG5_DATA_PTR_T, INTENT(INOUT) :: parmesh\n
+ * >     CHARACTER(LEN=*), INTENT(IN)   :: filename\n
+ * >     INTEGER, INTENT(IN)            :: strlen\n
+ * >     INTEGER, INTENT(OUT)           :: retval\n
+ * >   END SUBROUTINE\n
+ *
+ */
+  int PMMG_loadCheckpoint(PMMG_pParMesh parmesh, const char *filename);
+
 /**
  * \param parmesh pointer toward the parmesh structure
  * \param next_comm number of communicators
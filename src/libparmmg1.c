@@ -294,12 +294,12 @@ int PMMG_packParMesh( PMMG_pParMesh parmesh )
  *
  * Store in \a facesVertices the nodes indices of the interface faces.  The \f$
  * i^th \f$ face is stored at the \f$ [ 3*i;3$i+2 ] positions of the \a
- * facesData array. The \a facesData array is allocated in this function.
+ * facesData array, that must be allocated at size 3*nitem_int_face_comm.
  *
  */
 static inline
 int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
-                                      int **facesData) {
+                                      int *facesData) {
   PMMG_pGrp   grp;
   MMG5_pMesh  mesh;
   MMG5_pTetra pt;
@@ -312,8 +312,6 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
   grp                 = &parmesh->listgrp[igrp];
   nitem_int_face_comm = grp->nitem_int_face_comm;
 
-  PMMG_MALLOC(parmesh,*facesData,3*nitem_int_face_comm,int,"facesData",return 0);
-
   face2int_face_comm_index1 = grp->face2int_face_comm_index1;
   mesh                      = parmesh->listgrp[igrp].mesh;
   for ( k=0; k<nitem_int_face_comm; ++k ) {
@@ -333,9 +331,9 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
     ic = pt->v[MMG5_idir[ifac][(iploc+2)%3]];
 
     /** Store the face vertices */
-    (*facesData)[3*k]   = ia;
-    (*facesData)[3*k+1] = ib;
-    (*facesData)[3*k+2] = ic;
+    facesData[3*k]   = ia;
+    facesData[3*k+1] = ib;
+    facesData[3*k+2] = ic;
   }
 
   return 1;
@@ -353,8 +351,7 @@ int PMMG_store_faceVerticesInIntComm( PMMG_pParMesh parmesh, int igrp,
  *
  * Find the index of the interface tetras from the data stored in the
  * \a facesData array (by the \ref store_faceVerticesInIntComm function) and
- * update the face2int_face_comm_index1 array. This function frees the \a
- * facesData array.
+ * update the face2int_face_comm_index1 array.
  *
  */
 static inline
@@ -378,8 +375,7 @@ int  PMMG_update_face2intInterfaceTetra( PMMG_pParMesh parmesh, int igrp,
   /** Step 1: Hash the MG_PARBDY faces */
   mesh = parmesh->listgrp[igrp].mesh;
   if ( !MMG5_hashNew(mesh,&hash,0.51*nitem,1.51*nitem) ) {
-    ier = 0;
-    goto facesData;
+    return 0;
   }
 
   for ( k=1; k<=mesh->ne; ++k ) {
@@ -440,9 +436,6 @@ int  PMMG_update_face2intInterfaceTetra( PMMG_pParMesh parmesh, int igrp,
 hash:
   MMG5_DEL_MEM(mesh,hash.item);
 
-facesData:
-  PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
-
   return ier;
 }
 
@@ -470,7 +463,7 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   MMG5_pSol  met,field;
   int        *facesData;
   int        k,imprim;
-  int8_t     warnScotch;
+  int8_t     warnScotch = 0;
 
   mesh  = parmesh->listgrp[igrp].mesh;
   met   = parmesh->listgrp[igrp].met;
@@ -485,9 +478,13 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
     }
   }
 
-  if( !PMMG_store_faceVerticesInIntComm(parmesh,igrp,&facesData) ){
+  PMMG_MALLOC(parmesh,facesData,3*parmesh->listgrp[igrp].nitem_int_face_comm,
+              int,"facesData",return 0);
+
+  if( !PMMG_store_faceVerticesInIntComm(parmesh,igrp,facesData) ){
     fprintf(stderr,"\n  ## Interface faces storage problem."
             " Exit program.\n");
+    PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
     return 0;
   }
 
@@ -517,8 +514,11 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   /** Update interface tetra indices in the face communicator */
   if ( ! PMMG_update_face2intInterfaceTetra(parmesh,igrp,facesData,permNodGlob) ) {
     fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
+    PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
     return 0;
   }
+  PMMG_DEL_MEM(parmesh,facesData,int,"facesData");
+
   /** Update nodal communicators if node renumbering is enabled */
   if ( mesh->info.renum &&
     !PMMG_update_node2intRnbg(&parmesh->listgrp[igrp],permNodGlob) ) {
@@ -534,6 +534,427 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
   return 1;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure of a group.
+ *
+ * \return 1 if the mesh has reached its memory capacity, 0 otherwise.
+ *
+ * Check if the remesher has stopped because it has run out of memory: one of
+ * the point, tetra or boundary entity arrays is full and the memory left is
+ * not enough to grow it (Mmg grows its arrays by a factor mesh->gap). The
+ * caller must still check that the mesh is valid as Mmg may have failed for
+ * another reason.
+ *
+ */
+static inline
+int PMMG_remesh_isFull( MMG5_pMesh mesh ) {
+  size_t avMem,tetSize;
+
+  avMem = ( mesh->memMax > mesh->memCur ) ? mesh->memMax - mesh->memCur : 0;
+
+  tetSize = sizeof(MMG5_Tetra);
+  if ( mesh->adja ) tetSize += 4*sizeof(int);
+
+  if ( (!mesh->npnil) &&
+       (size_t)(mesh->gap*mesh->npmax)*sizeof(MMG5_Point) > avMem ) {
+    return 1;
+  }
+  if ( (!mesh->nenil) && (size_t)(mesh->gap*mesh->nemax)*tetSize > avMem ) {
+    return 1;
+  }
+  if ( (mesh->xp >= mesh->xpmax) &&
+       (size_t)(mesh->gap*mesh->xpmax)*sizeof(MMG5_xPoint) > avMem ) {
+    return 1;
+  }
+  if ( (mesh->xt >= mesh->xtmax) &&
+       (size_t)(mesh->gap*mesh->xtmax)*sizeof(MMG5_xTetra) > avMem ) {
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * \struct PMMG_remeshStage
+ *
+ * \brief Data of a group along the remeshing pipeline.
+ *
+ */
+typedef struct {
+  int *facesData;   /*!< vertices of the interface faces of the group */
+  int *permNodGlob; /*!< node permutation (if scotch renumbering is enabled) */
+  int ier;          /*!< 1 if success, 0 if we can save the mesh, -1 otherwise */
+  int done;         /*!< 1 if the group has been scaled and hashed */
+  int full;         /*!< 1 if the group has reached its memory capacity */
+} PMMG_remeshStage;
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group
+ * \param stage pointer toward the pipeline data of the group
+ *
+ * Preprocessing of a group before the remeshing (no Mmg call): storage of the
+ * interface faces and initialization of the node permutation.
+ *
+ */
+static
+void PMMG_remesh_preprocess( PMMG_pParMesh parmesh,int igrp,
+                             PMMG_remeshStage *stage ) {
+  MMG5_pMesh mesh;
+  int        k;
+
+  mesh = parmesh->listgrp[igrp].mesh;
+
+#ifdef USE_POINTMAP
+  for( k = 1; k <= mesh->np; k++ )
+    mesh->point[k].src = k;
+#endif
+
+  /* Reset the value of the fem mode */
+  mesh->info.fem = parmesh->info.fem;
+
+  if ( (!mesh->np) && (!mesh->ne) ) {
+    /* Empty mesh */
+    return;
+  }
+
+  /** Store the vertices of interface faces in the internal communicator */
+  if ( !PMMG_store_faceVerticesInIntComm(parmesh,igrp,stage->facesData) ) {
+    /* We are not able to remesh */
+    fprintf(stderr,"\n  ## Interface faces storage problem."
+            " Exit program.\n");
+    stage->ier = 0;
+    return;
+  }
+
+  if ( stage->permNodGlob ) {
+    for ( k=1; k<=mesh->np; ++k ) {
+      stage->permNodGlob[k] = k;
+    }
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group
+ * \param stage pointer toward the pipeline data of the group
+ * \param warnScotch pointer toward the flag telling if the renumbering warning
+ * has already been printed
+ *
+ * Mmg preprocessing of a group: scotch renumbering, marks reset, mesh scaling
+ * and tetra hashing.
+ *
+ */
+static
+void PMMG_remesh_scale( PMMG_pParMesh parmesh,int igrp,
+                        PMMG_remeshStage *stage,int8_t *warnScotch ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  int        k,ier;
+
+  mesh = parmesh->listgrp[igrp].mesh;
+  met  = parmesh->listgrp[igrp].met;
+
+  if ( (!mesh->np) && (!mesh->ne) ) {
+    /* Empty mesh */
+    return;
+  }
+
+#ifdef USE_SCOTCH
+  if ( stage->permNodGlob ) {
+    /* renumerotation if available: no need to renum the field here (they
+     * will be interpolated) */
+    assert ( mesh->npi==mesh->np );
+    if ( !MMG5_scotchCall(mesh,met,NULL,stage->permNodGlob) && !*warnScotch ) {
+      PMMG_scotch_message(warnScotch);
+    }
+  }
+#endif
+
+  /* Mark reinitialisation in order to be able to remesh all the mesh.
+   * Unused tetra (above ne) are zeroed when they are allocated or
+   * released, so only the used ones need a reset. */
+  mesh->mark = 0;
+  mesh->base = 0;
+  for ( k=1 ; k<=mesh->ne ; k++ ) {
+    mesh->tetra[k].mark = mesh->mark;
+    mesh->tetra[k].flag = mesh->base;
+  }
+
+  /* Here we need to scale the mesh and to hash the tetra */
+  ier = MMG5_scaleMesh(mesh,met,NULL);
+  if ( ier && !mesh->adja ) {
+    ier = MMG3D_hashTetra(mesh,0);
+    if ( !ier ) {
+      fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
+    }
+  }
+  if ( !ier ) {
+    stage->ier = -1;
+    return;
+  }
+
+  stage->done = 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group
+ * \param stage pointer toward the pipeline data of the group
+ *
+ * Remeshing of a preprocessed group.
+ *
+ */
+static
+void PMMG_remesh_run( PMMG_pParMesh parmesh,int igrp,PMMG_remeshStage *stage ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+  int        ier;
+
+  mesh = parmesh->listgrp[igrp].mesh;
+  met  = parmesh->listgrp[igrp].met;
+
+#ifdef PATTERN
+  ier = MMG5_mmg3d1_pattern( mesh, met, stage->permNodGlob );
+#else
+  ier = MMG5_mmg3d1_delone( mesh, met, stage->permNodGlob );
+#endif
+  mesh->npi = mesh->np;
+  mesh->nei = mesh->ne;
+
+  if ( !ier && PMMG_remesh_isFull(mesh) && mesh->adja && MMG5_chkmsh(mesh,0,0) ) {
+    /* The group has reached its memory capacity and its mesh is still valid:
+     * keep the partially adapted mesh, it will be split into smaller groups by
+     * the load balancing and adapted again at next iteration */
+    if ( parmesh->info.imprim > PMMG_VERB_QUAL ) {
+      fprintf(stdout,"\n  ## Warning: group %d of proc %d has reached"
+              " its memory capacity. Adaptation deferred to next"
+              " iteration.\n",igrp,parmesh->myrank);
+    }
+    stage->full = 1;
+    ier = 1;
+  }
+  if ( !ier ) {
+    fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
+    stage->ier = 0;
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group
+ * \param stage pointer toward the pipeline data of the group
+ *
+ * Mmg postprocessing of a preprocessed group (remeshed or not): tetra packing,
+ * update of the face communicator (through the Mmg face hashing) and mesh
+ * unscaling.
+ *
+ */
+static
+void PMMG_remesh_unscale( PMMG_pParMesh parmesh,int igrp,
+                          PMMG_remeshStage *stage ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  met;
+
+  mesh  = parmesh->listgrp[igrp].mesh;
+  met   = parmesh->listgrp[igrp].met;
+
+  if ( parmesh->iter < PMMG_niter_eff(parmesh)-1 && (!parmesh->info.inputMet) ) {
+    /* Delete the metrec computed by Mmg except at last iter */
+    PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
+  }
+
+  /** Pack the tetra */
+  if ( mesh->adja )
+    PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
+
+  if ( !MMG5_paktet(mesh) ) {
+    fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
+    stage->ier = -1;
+    return;
+  }
+
+  /** Update interface tetra indices in the face communicator */
+  if ( ! PMMG_update_face2intInterfaceTetra(parmesh,igrp,stage->facesData,
+                                            stage->permNodGlob) ) {
+    fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
+    stage->ier = -1;
+    return;
+  }
+
+  if ( !MMG5_unscaleMesh(mesh,met,NULL) ) {
+    stage->ier = -1;
+    return;
+  }
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param igrp index of the group
+ * \param stage pointer toward the pipeline data of the group
+ *
+ * Postprocessing of an unscaled group (no Mmg call): fields reallocation,
+ * update of the node communicators and copy of the metrics and fields of the
+ * required points.
+ *
+ */
+static
+void PMMG_remesh_postprocess( PMMG_pParMesh parmesh,int igrp,
+                              PMMG_remeshStage *stage ) {
+  MMG5_pMesh mesh;
+  MMG5_pSol  field,psl;
+  int        is;
+
+  mesh  = parmesh->listgrp[igrp].mesh;
+  field = parmesh->listgrp[igrp].field;
+
+  /* Realloc the solution fields at the same size than other structures */
+  if ( mesh->nsols ) {
+    for ( is=0; is<mesh->nsols; ++is ) {
+      psl    = field + is;
+      assert ( psl && psl->m );
+      PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
+                   psl->size*(psl->npmax+1),double,
+                   "field array",stage->ier = -1; return);
+      psl->npmax = mesh->npmax;
+    }
+  }
+
+#ifdef USE_SCOTCH
+  /** Update nodal communicators if node renumbering is enabled */
+  if ( mesh->info.renum &&
+       !PMMG_update_node2intRnbg(&parmesh->listgrp[igrp],stage->permNodGlob) ) {
+    fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
+    stage->ier = -1;
+    return;
+  }
+#endif
+
+  if ( !PMMG_copyMetricsAndFields_point( parmesh->listgrp[igrp].mesh,
+                                         parmesh->old_listgrp[igrp].mesh,
+                                         parmesh->listgrp[igrp].met,
+                                         parmesh->old_listgrp[igrp].met,
+                                         parmesh->listgrp[igrp].field,
+                                         parmesh->old_listgrp[igrp].field,
+                                         stage->permNodGlob,
+                                         parmesh->info.inputMet) ) {
+    stage->ier = -1;
+    return;
+  }
+
+  /* Reset the mesh->gap field in case Mmg have modified it */
+  mesh->gap = MMG5_GAP;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nfull pointer toward the number of groups that have reached their
+ * memory capacity
+ *
+ * \return 1 if success, 0 if fail but we can save the mesh, -1 if we cannot.
+ *
+ * Remesh the groups of the process through a pipeline: while one thread
+ * scales, remeshes and unscales group i, another thread (if OpenMP is enabled)
+ * preprocesses group i+1 and postprocesses group i-1. After a failure, the
+ * following groups are not remeshed anymore but the groups already scaled are
+ * still unscaled and postprocessed.
+ *
+ * \remark Mmg is not documented as thread-safe (static warning flags, global
+ * function pointers): all the Mmg calls (renumbering, scaling, hashing,
+ * remeshing, packing, face hashing and unscaling) are performed by the same
+ * thread, the other thread runs only Parmmg code on another group.
+ *
+ * \remark the per-group buffers (interface faces and node permutation) are
+ * allocated up front for all the groups, and freed at the end, sequentially as
+ * the memory counters of the parmesh are not thread-safe: the peak memory is
+ * higher than with a group by group allocation (3 integers per interface face
+ * of the process, and 1 per point with scotch).
+ *
+ */
+static
+int PMMG_remesh_grps( PMMG_pParMesh parmesh,int *nfull ) {
+  PMMG_remeshStage *stages;
+  MMG5_pMesh       mesh;
+  int              ngrp,failed,ier,i,s;
+  int8_t           warnScotch;
+
+  ngrp       = parmesh->ngrp;
+  *nfull     = 0;
+  warnScotch = 0;
+  if ( !ngrp ) return 1;
+
+  PMMG_CALLOC(parmesh,stages,ngrp,PMMG_remeshStage,"remesh stages",return 0);
+
+  /** Allocation of the per-group buffers */
+  for ( i=0; i<ngrp; ++i ) {
+    stages[i].ier = 1;
+    mesh = parmesh->listgrp[i].mesh;
+    if ( (!mesh->np) && (!mesh->ne) ) continue;
+
+    PMMG_MALLOC(parmesh,stages[i].facesData,
+                3*parmesh->listgrp[i].nitem_int_face_comm,int,"facesData",
+                stages[i].ier = 0);
+#ifdef USE_SCOTCH
+    /* Allocation of the array that will store the node permutation */
+    PMMG_MALLOC(parmesh,stages[i].permNodGlob,mesh->np+1,int,"node permutation",
+                if ( !warnScotch ) PMMG_scotch_message(&warnScotch) );
+#endif
+  }
+
+  /** Pipeline: at step s, preprocess group s, scale, remesh and unscale group
+   * s-1 and postprocess group s-2 */
+  failed = 0;
+  for ( s=0; s<ngrp+2; ++s ) {
+#ifdef _OPENMP
+#pragma omp parallel sections if(ngrp>1)
+#endif
+    {
+#ifdef _OPENMP
+#pragma omp section
+#endif
+      {
+        /* Parmmg only */
+        if ( s < ngrp && (!failed) && stages[s].ier == 1 ) {
+          PMMG_remesh_preprocess(parmesh,s,&stages[s]);
+        }
+        if ( s >= 2 && stages[s-2].done && stages[s-2].ier != -1 ) {
+          PMMG_remesh_postprocess(parmesh,s-2,&stages[s-2]);
+        }
+      }
+#ifdef _OPENMP
+#pragma omp section
+#endif
+      {
+        /* All the Mmg calls */
+        if ( s >= 1 && s-1 < ngrp && (!failed) && stages[s-1].ier == 1 ) {
+          PMMG_remesh_scale(parmesh,s-1,&stages[s-1],&warnScotch);
+          if ( stages[s-1].done ) {
+            PMMG_remesh_run(parmesh,s-1,&stages[s-1]);
+            PMMG_remesh_unscale(parmesh,s-1,&stages[s-1]);
+          }
+        }
+      }
+    }
+
+    /* Stop remeshing new groups after a failure */
+    for ( i=MG_MAX(0,s-2); i<=MG_MIN(s,ngrp-1); ++i ) {
+      if ( stages[i].ier < 1 ) failed = 1;
+    }
+  }
+
+  /** Free the per-group buffers */
+  ier = 1;
+  for ( i=0; i<ngrp; ++i ) {
+    ier     = MG_MIN(ier,stages[i].ier);
+    *nfull += stages[i].full;
+    PMMG_DEL_MEM(parmesh,stages[i].facesData,int,"facesData");
+    PMMG_DEL_MEM(parmesh,stages[i].permNodGlob,int,"node permutation");
+  }
+  PMMG_DEL_MEM(parmesh,stages,PMMG_remeshStage,"remesh stages");
+
+  return ier;
+}
+
 /**
  * \param parmesh pointer toward a parmesh structure where the boundary entities
  * are stored into xtetra and xpoint strucutres
@@ -543,6 +964,12 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
  * (with moving of the proc boundaries between two iterations) and last, merge
  * the groups over each proc.
  *
+ * \remark A group that reaches its memory capacity is kept partially adapted:
+ * the load balancing splits it into smaller groups and its adaptation continues
+ * at next iteration (at most \ref PMMG_REMESH_NRETRY_MAX iterations are added
+ * to the iterations of the current call for this purpose, parmesh->niter is
+ * not modified).
+ *
  * \return PMMG_STRONGFAILURE if  we can't save the mesh (non-conform),
  *         PMMG_LOWFAILURE    if  we can save the mesh
  *         PMMG_SUCCESS
@@ -550,10 +977,11 @@ int PMMG_scotchCall( PMMG_pParMesh parmesh,int igrp,int *permNodGlob ) {
 int PMMG_parmmglib1( PMMG_pParMesh parmesh )
 {
   MMG5_pMesh mesh;
-  MMG5_pSol  met,field,psl;
+  MMG5_pSol  met;
   mytime     ctim[TIMEMAX];
-  int        ier,ier_end,ieresult,i,k,is,*facesData,*permNodGlob;
-  int8_t     tim,warnScotch;
+  int        ier,ier_end,ieresult,i,*permNodGlob;
+  int        nfull,nfullresult;
+  int8_t     tim;
   char       stim[32];
   uint8_t    inputMet;
 
@@ -561,16 +989,20 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
 
   ier_end = PMMG_SUCCESS;
 
-  assert ( parmesh->ngrp >= 1 );
-  assert ( parmesh->listgrp[0].mesh );
+  /* On restart, the groups are loaded from the checkpoint and a process may
+   * have no group until the first load balancing */
+  assert ( parmesh->restart || parmesh->ngrp >= 1 );
+  assert ( parmesh->restart || parmesh->listgrp[0].mesh );
 
-  /** Set inputMet flag */
-  parmesh->info.inputMet = 0;
-  for ( i=0; i<parmesh->ngrp; ++i ) {
-    met         = parmesh->listgrp[i].met;
-    if ( met && met->m ) {
-      parmesh->info.inputMet = 1;
-      break;
+  /** Set inputMet flag (stored in the checkpoint on restart) */
+  if ( !parmesh->restart ) {
+    parmesh->info.inputMet = 0;
+    for ( i=0; i<parmesh->ngrp; ++i ) {
+      met         = parmesh->listgrp[i].met;
+      if ( met && met->m ) {
+        parmesh->info.inputMet = 1;
+        break;
+      }
     }
   }
 
@@ -593,7 +1025,7 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     chrono(ON,&(ctim[tim]));
   }
 
-  if ( ier ) {
+  if ( ier && !parmesh->restart ) {
     ier = PMMG_splitPart_grps( parmesh,PMMG_GRPSPL_MMG_TARGET,0,
                                PMMG_REDISTRIBUTION_graph_balancing );
   }
@@ -632,8 +1064,14 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
   }
 
   /** Mesh adaptation */
-  warnScotch = 0;
-  for ( parmesh->iter = 0; parmesh->iter < parmesh->niter; parmesh->iter++ ) {
+  permNodGlob = NULL;
+  parmesh->nretry = 0;
+  if ( !parmesh->restart ) {
+    parmesh->iter = 0;
+  }
+  parmesh->restart = 0;
+
+  for ( ; parmesh->iter < PMMG_niter_eff(parmesh); parmesh->iter++ ) {
     if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
       tim = 1;
       if ( parmesh->iter > 0 ) {
@@ -652,161 +1090,17 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     /** Update old groups for metrics and solution interpolation */
     PMMG_update_oldGrps( parmesh );
 
-
     tim = 4;
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
       chrono(RESET,&(ctim[tim]));
       chrono(ON,&(ctim[tim]));
     }
 
-    for ( i=0; i<parmesh->ngrp; ++i ) {
-      mesh         = parmesh->listgrp[i].mesh;
-      met          = parmesh->listgrp[i].met;
-      field        = parmesh->listgrp[i].field;
-
-#ifdef USE_POINTMAP
-      for( k = 1; k <= mesh->np; k++ )
-        mesh->point[k].src = k;
-#endif
-
-      /* Reset the value of the fem mode */
-      mesh->info.fem = parmesh->info.fem;
-
-      if ( (!mesh->np) && (!mesh->ne) ) {
-        /* Empty mesh */
-        continue;
-      }
-
-      /** Store the vertices of interface faces in the internal communicator */
-      if ( !(ier = PMMG_store_faceVerticesInIntComm(parmesh,i,&facesData) ) ) {
-        /* We are not able to remesh */
-        fprintf(stderr,"\n  ## Interface faces storage problem."
-                " Exit program.\n");
-        break;
-      }
-      else {
-        /* We can remesh */
-
-        permNodGlob = NULL;
-
-#ifdef USE_SCOTCH
-        /* Allocation of the array that will store the node permutation */
-        PMMG_MALLOC(parmesh,permNodGlob,mesh->np+1,int,"node permutation",
-                    PMMG_scotch_message(&warnScotch) );
-        if ( permNodGlob ) {
-          for ( k=1; k<=mesh->np; ++k ) {
-            permNodGlob[k] = k;
-          }
-          for ( k=1; k<=mesh->npi; ++k ) {
-            assert  ( permNodGlob[k] >0 );
-          }
-
-        }
-
-        /* renumerotation if available: no need to renum the field here (they
-         * will be interpolated) */
-        assert ( mesh->npi==mesh->np );
-        if ( permNodGlob ) {
-          if ( !MMG5_scotchCall(mesh,met,NULL,permNodGlob) )
-          {
-            PMMG_scotch_message(&warnScotch);
-          }
-        }
-#endif
-
-        /* Mark reinitialisation in order to be able to remesh all the mesh */
-        mesh->mark = 0;
-        mesh->base = 0;
-        for ( k=1 ; k<=mesh->nemax ; k++ ) {
-          mesh->tetra[k].mark = mesh->mark;
-          mesh->tetra[k].flag = mesh->base;
-        }
-
-        /** Call the remesher */
-        /* Here we need to scale the mesh */
-        if ( !MMG5_scaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !mesh->adja ) {
-          if ( !MMG3D_hashTetra(mesh,0) ) {
-            fprintf(stderr,"\n  ## Hashing problem. Exit program.\n");
-            goto strong_failed;
-          }
-        }
-
-#ifdef PATTERN
-        ier = MMG5_mmg3d1_pattern( mesh, met, permNodGlob );
-#else
-        ier = MMG5_mmg3d1_delone( mesh, met, permNodGlob );
-#endif
-        mesh->npi = mesh->np;
-        mesh->nei = mesh->ne;
-
-        if ( !ier ) {
-          fprintf(stderr,"\n  ## MMG remeshing problem. Exit program.\n");
-        }
-
-        /* Realloc the solution fields at the same size than other structures */
-        if ( mesh->nsols ) {
-          for ( is=0; is<mesh->nsols; ++is ) {
-            psl    = field + is;
-            assert ( psl && psl->m );
-            PMMG_REALLOC(mesh,psl->m,psl->size*(mesh->npmax+1),
-                         psl->size*(psl->npmax+1),double,
-                         "field array",goto strong_failed);
-            psl->npmax = mesh->npmax;
-          }
-        }
-
-        if ( parmesh->iter < parmesh->niter-1 && (!parmesh->info.inputMet) ) {
-          /* Delete the metrec computed by Mmg except at last iter */
-          PMMG_DEL_MEM(mesh,met->m,double,"internal metric");
-        }
-
-        /** Pack the tetra */
-        if ( mesh->adja )
-          PMMG_DEL_MEM(mesh,mesh->adja,int,"adja table");
-
-        if ( !MMG5_paktet(mesh) ) {
-          fprintf(stderr,"\n  ## Tetra packing problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-        /** Update interface tetra indices in the face communicator */
-        if ( ! PMMG_update_face2intInterfaceTetra(parmesh,i,facesData,permNodGlob) ) {
-          fprintf(stderr,"\n  ## Interface tetra updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-
-
-#ifdef USE_SCOTCH
-        /** Update nodal communicators if node renumbering is enabled */
-        if ( mesh->info.renum &&
-             !PMMG_update_node2intRnbg(&parmesh->listgrp[i],permNodGlob) ) {
-          fprintf(stderr,"\n  ## Nodal communicator updating problem. Exit program.\n");
-          goto strong_failed;
-        }
-#endif
-
-        if ( !MMG5_unscaleMesh(mesh,met,NULL) ) { goto strong_failed; }
-
-        if ( !PMMG_copyMetricsAndFields_point( parmesh->listgrp[i].mesh,
-                                               parmesh->old_listgrp[i].mesh,
-                                               parmesh->listgrp[i].met,
-                                               parmesh->old_listgrp[i].met,
-                                               parmesh->listgrp[i].field,
-                                               parmesh->old_listgrp[i].field,
-                                               permNodGlob,parmesh->info.inputMet) ) {
-          goto strong_failed;
-        }
-
-        if ( !ier ) { break; }
-      }
-      /* Reset the mesh->gap field in case Mmg have modified it */
-      mesh->gap = MMG5_GAP;
-
-#ifdef USE_SCOTCH
-      PMMG_DEL_MEM(parmesh,permNodGlob,int,"node permutation");
-#endif
+    /** Remesh the groups (pipelined over the groups of the process) */
+    ier = PMMG_remesh_grps( parmesh,&nfull );
+    if ( ier < 0 ) {
+      ier = 0;
+      goto strong_failed;
     }
 
     MPI_Allreduce( &ier, &ieresult, 1, MPI_INT, MPI_MIN, parmesh->comm );
@@ -819,6 +1113,26 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     if ( !ieresult )
       goto failed_handling;
 
+    /* Groups that have reached their memory capacity at last iteration need
+     * another one to finish their adaptation */
+    MPI_Allreduce( &nfull, &nfullresult, 1, MPI_INT, MPI_MAX, parmesh->comm );
+    if ( nfullresult && parmesh->iter == PMMG_niter_eff(parmesh)-1 &&
+         parmesh->nretry < PMMG_REMESH_NRETRY_MAX ) {
+      ++parmesh->nretry;
+      if ( (!parmesh->myrank) && parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"\n  ## Warning: %s: groups have reached their memory"
+                " capacity. Add a remeshing iteration.\n",__func__);
+      }
+    }
+    else if ( nfullresult && parmesh->iter == PMMG_niter_eff(parmesh)-1 ) {
+      /* The output mesh is valid but not fully adapted */
+      if ( !parmesh->myrank ) {
+        fprintf(stderr,"\n  ## Warning: %s: groups have reached their memory"
+                " capacity at last iteration. Incomplete adaptation.\n",__func__);
+      }
+      ier_end = PMMG_LOWFAILURE;
+    }
+
     /** Interpolate metrics and solution fields */
     if ( parmesh->info.imprim > PMMG_VERB_ITWAVES ) {
       tim = 2;
@@ -841,8 +1155,10 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_STRONGFAILURE);
     }
 
-    /* Compute quality in the interpolated metrics */
-    ier = PMMG_tetraQual( parmesh,1 );
+    /* Compute quality in the interpolated metrics (hidden behind the group
+     * partitioning when it is computed in background) */
+    if ( !PMMG_asyncPartitioning(parmesh) )
+      ier = PMMG_tetraQual( parmesh,1 );
 
     /** load Balancing at group scale and communicators reconstruction */
     tim = 3;
@@ -851,7 +1167,7 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
       chrono(ON,&(ctim[tim]));
     }
 
-    if ( parmesh->iter == parmesh->niter-1 ) {
+    if ( parmesh->iter == PMMG_niter_eff(parmesh)-1 ) {
 
       if ( !parmesh->info.nobalancing ) {
         /** Load balancing of the output mesh */
@@ -893,6 +1209,14 @@ int PMMG_parmmglib1( PMMG_pParMesh parmesh )
     /** update geometric analysis */
     if( !PMMG_update_analys(parmesh) )
       PMMG_CLEAN_AND_RETURN(parmesh,PMMG_LOWFAILURE);
+
+    /** Checkpoint to be able to restart at the next iteration */
+    if ( parmesh->chkptout && parmesh->iter < PMMG_niter_eff(parmesh)-1 ) {
+      if ( !PMMG_saveCheckpoint(parmesh,parmesh->chkptout) && !parmesh->myrank ) {
+        fprintf(stderr,"\n  ## Warning: unable to save the checkpoint of"
+                " iteration %d.\n",parmesh->iter+1);
+      }
+    }
   }
 
   if ( parmesh->info.imprim > PMMG_VERB_STEPS ) {
@@ -121,6 +121,10 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog )
     fprintf(stdout,"-sol   file  load level-set, displacement or metric file\n");
     fprintf(stdout,"-field file  load sol field to interpolate from init onto final mesh\n");
     fprintf(stdout,"-noout       do not write output triangulation\n");
+    fprintf(stdout,"-parallel-input  read the centralized input mesh on all the processes\n");
+    fprintf(stdout,"-part       file  reuse (or save) the initial partition of a centralized mesh\n");
+    fprintf(stdout,"-checkpoint file  save a checkpoint at the end of each iteration\n");
+    fprintf(stdout,"-restart    file  restart from a checkpoint (input mesh is not read)\n");
 
     fprintf(stdout,"\n**  Parameters\n");
     fprintf(stdout,"-niter        val  number of remeshing iterations\n");
@@ -129,6 +133,10 @@ int PMMG_usage( PMMG_pParMesh parmesh, char * const prog )
     fprintf(stdout,"-nlayers      val  number of layers for interface displacement\n");
     fprintf(stdout,"-groups-ratio val  allowed imbalance between current and desired groups size\n");
     fprintf(stdout,"-nobalance         switch off load balancing of the output mesh\n");
+    fprintf(stdout,"-sfc               split the meshes along a space-filling curve instead of metis\n");
+    fprintf(stdout,"-partitioners val  number of processes computing the group partition in background\n");
+    fprintf(stdout,"                   (overlapped with the quality computation of the load balancing)\n");
+    fprintf(stdout,"-float-sol         send the metric and fields in single precision when migrating groups\n");
 
     //fprintf(stdout,"-ar     val  angle detection\n");
     //fprintf(stdout,"-nr          no angle detection\n");
@@ -219,6 +227,20 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto fail_proc;
           }
         }
+        else if ( !strcmp(argv[i],"-checkpoint") ) {
+          /* checkpoint file written at the end of each iteration */
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            if ( !PMMG_Set_outputCheckpointName(parmesh,argv[i]) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %c\n", argv[i-1][1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
         else {
           ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
                       " adding to mmgArgv for mmg: ",
@@ -242,6 +264,13 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
             goto fail_mmgargv;
           }
         }
+        else if ( !strcmp(argv[i],"-float-sol") ) {
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_solPrecision,
+                                    PMMG_SOLPREC_float) ) {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
         else {
           ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
                       " adding to mmgArgv for mmg: ",
@@ -406,6 +435,7 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
           ++i;
           if ( isdigit( argv[i][0] ) && ( atoi( argv[i] ) >= 0 ) ) {
             parmesh->niter = atoi( argv[i] );
+            parmesh->info.setniter = 1;
           } else {
             parmesh->niter = PMMG_NITER;
             fprintf( stderr,
@@ -464,20 +494,91 @@ int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh )
                       ret_val = 0; goto fail_proc );
         }
         break;
-#ifdef USE_SCOTCH
       case 'r':
-        if ( !strcmp(argv[i],"-rn") ) {
+        if ( !strcmp(argv[i],"-restart") ) {
+          /* restart from a checkpoint file */
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            if ( !PMMG_Set_name(parmesh,&parmesh->chkptin,argv[i],NULL) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %c\n", argv[i-1][1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+#ifdef USE_SCOTCH
+        else if ( !strcmp(argv[i],"-rn") ) {
           ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
                       " adding to mmgArgv for mmg: ",
                       ret_val = 0; goto fail_proc );
         }
-        break;
 #endif
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
+
+      case 'p':
+        if ( !strcmp(argv[i],"-parallel-input") ) {
+          /* read the centralized Medit ASCII mesh on all the processes */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_parallelInput,1) )  {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-partitioners") ) {
+          /* number of processes computing the group partition in background */
+          if ( ++i < argc && isdigit(argv[i][0]) ) {
+            if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_partitioners,
+                                      atoi(argv[i])) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %c\n", argv[i-1][1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else if ( !strcmp(argv[i],"-part") ) {
+          /* initial partition file */
+          if ( ++i < argc && isascii(argv[i][0]) && argv[i][0]!='-' ) {
+            if ( !PMMG_Set_partitionName(parmesh,argv[i]) ) {
+              ret_val = 0;
+              goto fail_proc;
+            }
+          }
+          else {
+            fprintf( stderr, "\nMissing argument option %c\n", argv[i-1][1] );
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
+        else {
+          ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
+                      " adding to mmgArgv for mmg: ",
+                      ret_val = 0; goto fail_proc );
+        }
+        break;
 
       case 's':
         if ( 0 == strncmp( argv[i], "-surf", 4 ) ) {
           parmesh->listgrp[0].mesh->info.nosurf = 0;
         }
+        else if ( !strcmp(argv[i],"-sfc") ) {
+          /* space-filling curve partitioning instead of metis */
+          if ( !PMMG_Set_iparameter(parmesh,PMMG_IPARAM_loadbalancingMode,
+                                    PMMG_LOADBALANCING_sfc) ) {
+            ret_val = 0;
+            goto fail_proc;
+          }
+        }
         else {
           ARGV_APPEND(parmesh, argv, mmgArgv, i, mmgArgc,
                       " adding to mmgArgv for mmg: ",
@@ -209,6 +209,15 @@
  */
 #define PMMG_LOADBALANCING_parmetis 2
 
+/**
+ * \def PMMG_LOADBALANCING_sfc
+ *
+ * Use a Hilbert space-filling curve on the element barycenters instead of metis
+ * to split the meshes into groups (no graph is built)
+ *
+ */
+#define PMMG_LOADBALANCING_sfc 4
+
 /**
  * \def PMMG_APIDISTRIB_faces
  *
@@ -227,6 +236,23 @@
  */
 #define PMMG_APIDISTRIB_nodes 1
 
+/**
+ * \def PMMG_SOLPREC_double
+ *
+ * Send the metric and solution fields in double precision when migrating groups
+ *
+ */
+#define PMMG_SOLPREC_double 0
+
+/**
+ * \def PMMG_SOLPREC_float
+ *
+ * Send the metric and solution fields in single precision when migrating groups
+ * (point coordinates remain in double precision)
+ *
+ */
+#define PMMG_SOLPREC_float 1
+
 /**
  * \def PMMG_UNSET
  *
@@ -324,14 +350,19 @@ typedef struct {
   double grps_ratio;  /*!< allowed imbalance ratio between current and demanded groups size */
   int nobalancing; /*!< switch off final load balancing */
   int loadbalancing_mode; /*!< way to perform the loadbalanding (see LOADBALANCING) */
+  int npartitioners; /*!< nb of processes computing the group partition in background (0: blocking partition on root) */
   int contiguous_mode; /*!< force/don't force partitions contiguity */
   int metis_ratio; /*!< wanted ratio between the number of meshes and the number of metis super nodes */
   int target_mesh_size; /*!< target mesh size for Mmg */
   int API_mode; /*!< use faces or nodes information to build communicators */
   int globalNum; /*!< compute nodes and triangles global numbering in output */
   int fmtout; /*!< store the output format asked */
+  int8_t persistent; /*!< 1 if the analysed mesh and the communicators are kept between library calls */
+  int8_t parallelInput; /*!< 1 if centralized ASCII input files are read on all the processes */
+  int8_t solPrecision; /*!< precision of the metric and fields sent during the groups migration (see PMMG_SOLPREC_*) */
   int8_t sethmin; /*!< 1 if user set hmin, 0 otherwise (needed for multiple library calls) */
   int8_t sethmax; /*!< 1 if user set hmin, 0 otherwise (needed for multiple library calls) */
+  int8_t setniter; /*!< 1 if user set the number of iterations, 0 otherwise (not overwritten by a checkpoint) */
   uint8_t inputMet; /* 1 if User prescribe a metric or a size law */
 } PMMG_Info;
 
@@ -359,6 +390,8 @@ typedef struct {
   char     *lsin;
   char     *dispin;
   char     *fieldin,*fieldout;
+  char     *chkptin,*chkptout;
+  char     *partname; /*!< initial partition file (read if it matches the mesh, written otherwise) */
 
   /* grp */
   int       ngrp;       /*!< Number of grp */
@@ -384,6 +417,9 @@ typedef struct {
   int            ddebug; //! Debug level
   int            iter;   //! Current adaptation iteration
   int            niter;  //! Number of adaptation iterations
+  int            nretry; //! Number of iterations added to niter by the current call (groups at memory capacity)
+  int8_t         analysed; //! 1 if the mesh analysis and the communicators of the previous (persistent) call are valid
+  int8_t         restart;  //! 1 if the groups and communicators have been loaded from a checkpoint
 
   /* parameters of the run */
   PMMG_Info      info; /*!< \ref PMMG_Info structure */
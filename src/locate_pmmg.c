@@ -126,59 +126,58 @@ int PMMG_precompute_faceAreas( MMG5_pMesh mesh,double *faceAreas ) {
  * \param mesh pointer to the current mesh structure.
  * \param nodeTrias double pointer to the node triangles graph.
  *
- * \return 1.
+ * \return 1 if success, 0 if fail.
  *
  *  Precompute node triangles graph on the surface.
  *
  */
 int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeTrias ) {
-  MMG5_pTria  ptr;
-  MMG5_pPoint ppt;
-  int         ip,k,iloc;
-  int         np,offset;
+  PMMG_ptMarkers markers;
+  MMG5_pTria     ptr;
+  int            ip,k,iloc;
+  int            np,*count,*offset;
 
-  /* Use flag to count triangles for each point, tmp to store the offset in the
-   * graph */
-  for( ip = 1; ip <= mesh->np; ip++ ) {
-    ppt = &mesh->point[ip];
-    ppt->tmp = 0;
-    ppt->flag = 0;
-  }
+  /* Count triangles for each point in a compact flag array, store the offset
+   * in the graph in a compact tmp array */
+  if ( !PMMG_ptMarkers_init(parmesh,mesh,&markers,PMMG_MARK_flag|PMMG_MARK_tmp) )
+    return 0;
+  count  = markers.flag;
+  offset = markers.tmp;
 
   /* Count boundary points and triangles for each point */
   np = 0;
   for( k = 1; k <= mesh->nt; k++ ) {
     ptr = &mesh->tria[k];
     for( iloc = 0; iloc < 3; iloc++ ) {
-      ppt = &mesh->point[ptr->v[iloc]];
+      ip = ptr->v[iloc];
       /* Count point */
-      if( !ppt->flag ) np++;
+      if( !count[ip] ) np++;
       /* Count triangle on node */
-      ppt->flag++;
+      count[ip]++;
     }
   }
 
   /* Allocate */
-  PMMG_MALLOC( parmesh,*nodeTrias,np+3*mesh->nt,int,"nodeTrias",return 0 );
+  PMMG_MALLOC( parmesh,*nodeTrias,np+3*mesh->nt,int,"nodeTrias",
+               PMMG_ptMarkers_free(parmesh,&markers);return 0 );
 
   for( ip = 2; ip <= mesh->np; ip++ )
-    mesh->point[ip].tmp = mesh->point[ip-1].flag ? mesh->point[ip-1].tmp+mesh->point[ip-1].flag+1 : mesh->point[ip-1].tmp;
+    offset[ip] = count[ip-1] ? offset[ip-1]+count[ip-1]+1 : offset[ip-1];
 
 #ifndef NDEBUG
   int sum;
   sum = 0;
-  for( ip = 1; ip <= mesh->np; ip++ ) sum += mesh->point[ip].flag;
+  for( ip = 1; ip <= mesh->np; ip++ ) sum += count[ip];
   assert( sum == 3*mesh->nt );
   for( ip = 1; ip <= mesh->np; ip++ )
-    if( mesh->point[ip].flag ) assert( mesh->point[ip].tmp < np+3*mesh->nt );
+    if( count[ip] ) assert( offset[ip] < np+3*mesh->nt );
 #endif
 
   /* Store nb. of triangles */
   for( ip = 1; ip <= mesh->np; ip++ ) {
-    ppt = &mesh->point[ip];
-    if( !ppt->flag ) continue;
-    (*nodeTrias)[ppt->tmp] = ppt->flag;
-    ppt->flag = 0;
+    if( !count[ip] ) continue;
+    (*nodeTrias)[offset[ip]] = count[ip];
+    count[ip] = 0;
   }
 
   /* Store triangles */
@@ -186,11 +185,12 @@ int PMMG_precompute_nodeTrias( PMMG_pParMesh parmesh,MMG5_pMesh mesh,int **nodeT
     ptr = &mesh->tria[k];
     for( iloc = 0; iloc < 3; iloc++ ) {
       ip = ptr->v[iloc];
-      ppt = &mesh->point[ip];
-      (*nodeTrias)[ppt->tmp+1+ppt->flag++] = k;
+      (*nodeTrias)[offset[ip]+1+count[ip]++] = k;
     }
   }
 
+  PMMG_ptMarkers_free(parmesh,&markers);
+
   return 1;
 }
 
@@ -467,6 +467,8 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
  * \param iTria pointer to the index of the found triangle
  * \param closestTria pointer to the index of the closest triangle
  * \param closestDist pointer to the closest distance
+ * \param nstep pointer to the number of steps of the search path (decreased
+ * at each step of the exhaustive search)
  *
  * \return 1 if found, 0 otherwise.
  *
@@ -476,14 +478,15 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
  */
 int PMMG_locatePoint_exhaustTria( MMG5_pMesh mesh,MMG5_pPoint ppt,
                                   double *triaNormals,PMMG_barycoord *barycoord,
-                                  int *iTria,int *closestTria,double *closestDist ) {
+                                  int *iTria,int *closestTria,double *closestDist,
+                                  int *nstep ) {
   MMG5_pTria     ptr;
   double         h;
 
   for( *iTria = 1; *iTria <= mesh->nt; (*iTria)++ ) {
 
     /* Increase step counter */
-    ppt->s--;
+    (*nstep)--;
 
     /** Get tetra */
     ptr = &mesh->tria[*iTria];
@@ -576,6 +579,8 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
  * \param iTria pointer to the index of the triangle
  * \param ifoundEdge pointer to the index of the local edge
  * \param ifoundVertex pointer to the index of the local vertex
+ * \param nstep pointer to the number of steps of the search path (negative if
+ * an exhaustive search has been performed)
  *
  * \return 0 if not found (closest), 1 if found, -1 if found through exhaustive
  * search.
@@ -586,7 +591,8 @@ int PMMG_locatePoint_foundConvex( MMG5_pMesh mesh,MMG5_pPoint ppt,int *kfound,
  */
 int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
-                         int *iTria,int *ifoundEdge,int *ifoundVertex ) {
+                         int *iTria,int *ifoundEdge,int *ifoundVertex,
+                         int *nstep ) {
   MMG5_pTria     ptr,ptr1;
   int            *adjt,j,i,k,k1,kprev,step,closestTria,stuck,backward;
   int            iloc;
@@ -644,14 +650,14 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
         if( iloc == PMMG_UNSET ) continue;
         if( iloc == 4 ) {
           *ifoundEdge = i;
-          ppt->s = step;
+          *nstep = step;
           *iTria = k;
           return 1;
         } else {
           ier = PMMG_locatePointInCone( mesh,nodeTrias,k,iloc,ppt );
           if( ier ) {
             *ifoundVertex = iloc;
-            ppt->s = step;
+            *nstep = step;
             *iTria = k;
             return 1;
           }
@@ -671,9 +677,9 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   /* Store number of steps in the path for postprocessing */
   if( stuck )
-    ppt->s = -step;
+    *nstep = -step;
   else
-    ppt->s = step;
+    *nstep = step;
 
   if( step > mesh->nt ) {
     /* Recompute barycentric coordinates to the closest point */
@@ -702,7 +708,8 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
     }
 
     ier = PMMG_locatePoint_exhaustTria( mesh, ppt,triaNormals,barycoord,
-                                           iTria,&closestTria,&closestDist );
+                                           iTria,&closestTria,&closestDist,
+                                           nstep );
     if( ier ) {
       return -1;
     } else {
@@ -729,6 +736,8 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
  * \param idxTet pointer to the index of the found tetrahedron
  * \param closestTet pointer to the index of the closest tetrahedron
  * \param closestDist pointer to the distance from the closest tetrahedron
+ * \param nstep pointer to the number of steps of the search path (decreased
+ * at each step of the exhaustive search)
  *
  * \return 1 if found, 0 otherwise.
  *  Exhaustive point search on the background tetrahedra.
@@ -736,14 +745,15 @@ int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
  */
 int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
                                    double *faceAreas,PMMG_barycoord *barycoord,
-                                   int *idxTet,int *closestTet,double *closestDist ) {
+                                   int *idxTet,int *closestTet,double *closestDist,
+                                   int *nstep ) {
   MMG5_pTetra    pt;
   double         vol;
 
   for( *idxTet = 1; *idxTet <= mesh->ne; (*idxTet)++ ) {
 
     /* Increase step counter */
-    ppt->s--;
+    (*nstep)--;
 
     /** Get tetra */
     pt = &mesh->tetra[*idxTet];
@@ -776,6 +786,8 @@ int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
  * \param faceAreas oriented face areas of the all tetrahedra in the mesh
  * \param barycoord barycentric coordinates of the point to be located
  * \param idxTet pointer to the index of the found tetrahedron.
+ * \param nstep pointer to the number of steps of the search path (negative if
+ * an exhaustive search has been performed)
  *
  * \return 0 if not found (closest), 1 if found, -1 if found through exhaustive
  * search.
@@ -785,7 +797,7 @@ int PMMG_locatePoint_exhaustTetra( MMG5_pMesh mesh,MMG5_pPoint ppt,
  */
 int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet ) {
+                         int *idxTet,int *nstep ) {
   MMG5_pTetra    pt,pt1;
   int            *adja,iel,i,step,closestTet,stuck;
   double         vol,eps,closestDist;
@@ -839,9 +851,9 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
 
   /* Store number of steps in the path for postprocessing */
   if( stuck )
-    ppt->s = -step;
+    *nstep = -step;
   else
-    ppt->s = step;
+    *nstep = step;
 
   if( step > mesh->ne ) {
     /* Recompute barycentric coordinates to the closest point */
@@ -862,7 +874,8 @@ int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
     }
 
     ier = PMMG_locatePoint_exhaustTetra( mesh,ppt,faceAreas,barycoord,
-                                         idxTet,&closestTet,&closestDist );
+                                         idxTet,&closestTet,&closestDist,
+                                         nstep );
 
     if( ier ) {
       return -1;
@@ -923,34 +936,33 @@ void PMMG_locatePoint_errorCheck( MMG5_pMesh mesh,int ip,int ier,
 /**
  * \param mesh pointer to the current mesh structure
  * \param meshOld pointer to the background mesh structure
+ * \param start starting element of the search for each point of the current
+ * mesh
+ * \param startOld neighbouring element of each point of the background mesh
  *
  *  For each point in the background mesh, store the index of a neighbouring
  *  triangle or tetrahedron.
  *
+ * \remark \a start and \a startOld have to be zero-initialized (as the point
+ * markers allocated by \ref PMMG_ptMarkers_init).
+ *
  */
-void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
+void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld,
+                           int *start,int *startOld ) {
   MMG5_pPoint ppt;
   MMG5_pTria  ptr;
   MMG5_pTetra pt;
   int         ie,iloc,ip;
 
 #ifdef USE_POINTMAP
-  /* Reset indices */
-  for( ip = 1; ip <= meshOld->np; ip++ )
-    meshOld->point[ip].s = 0;
-  for( ip = 1; ip <= mesh->np; ip++ )
-    mesh->point[ip].s = 0;
-
-
   /* Store triangle index */
   for( ie = 1; ie <= meshOld->nt; ie++ ) {
     ptr = &meshOld->tria[ie];
     for( iloc = 0; iloc < 3; iloc++ ) {
       ip = ptr->v[iloc];
-      ppt = &meshOld->point[ip];
-      assert( ppt->tag & MG_BDY );
-      if( ppt->s ) continue;
-      ppt->s = -ie;
+      assert( meshOld->point[ip].tag & MG_BDY );
+      if( startOld[ip] ) continue;
+      startOld[ip] = -ie;
     }
   }
 
@@ -958,7 +970,7 @@ void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
   for( ip = 1; ip <= mesh->np; ip++ ) {
     ppt = &mesh->point[ip];
     if( !(ppt->tag & MG_BDY) ) continue;
-    ppt->s = -meshOld->point[ppt->src].s;
+    start[ip] = -startOld[ppt->src];
   }
 
 
@@ -967,9 +979,8 @@ void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
     pt = &meshOld->tetra[ie];
     for( iloc = 0; iloc < 4; iloc++ ) {
       ip = pt->v[iloc];
-      ppt = &meshOld->point[ip];
-      if( ppt->s > 0 ) continue;
-      ppt->s = ie;
+      if( startOld[ip] > 0 ) continue;
+      startOld[ip] = ie;
     }
   }
 
@@ -978,8 +989,8 @@ void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
     ppt = &mesh->point[ip];
     if( !MG_VOK(ppt) ) continue;
     if( ppt->tag & MG_BDY ) continue;
-    ppt->s = meshOld->point[ppt->src].s;
-    assert(ppt->s);
+    start[ip] = startOld[ppt->src];
+    assert(start[ip]);
   }
 #endif
 
@@ -988,12 +999,15 @@ void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld ) {
 /**
  * \param mesh pointer to the current mesh structure
  * \param meshOld pointer to the background mesh structure
+ * \param nstep number of steps of the search path of each point of the
+ * current mesh
  * \param locStats localization statistics structure
  *
  *  Compute localization statistics.
  *
  */
-void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateStats *locStats ) {
+void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,int *nstep,
+                                 PMMG_locateStats *locStats ) {
   MMG5_pPoint ppt;
   int         ip,np;
 
@@ -1007,7 +1021,7 @@ void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateS
   locStats->nexhaust = 0;
   np = 0;
 
-  /* Get the number of steps from the ppt->s field */
+  /* Get the number of steps from the nstep array */
   for( ip = 1; ip <= mesh->np; ip++ ) {
     ppt = &mesh->point[ip];
     if( !MG_VOK(ppt) ) continue;
@@ -1015,15 +1029,15 @@ void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateS
     /* Exhaustive searches are identified by a negative number of steps
      * (counting both the number of steps before and after the exhaustive
      * search) */
-    if( ppt->s < 0 ) {
+    if( nstep[ip] < 0 ) {
       locStats->nexhaust++;
-      ppt->s *= -1;
+      nstep[ip] *= -1;
     }
     np++;
-    assert( ppt->s );
-    if( ppt->s < locStats->stepmin ) locStats->stepmin = ppt->s;
-    if( ppt->s > locStats->stepmax ) locStats->stepmax = ppt->s;
-    locStats->stepav += ppt->s;
+    assert( nstep[ip] );
+    if( nstep[ip] < locStats->stepmin ) locStats->stepmin = nstep[ip];
+    if( nstep[ip] > locStats->stepmax ) locStats->stepmax = nstep[ip];
+    locStats->stepav += nstep[ip];
   }
   locStats->stepav *= 1.0/np;
 
@@ -60,13 +60,15 @@ int PMMG_locatePointInTetra( MMG5_pMesh mesh,MMG5_pTetra pt,int k,MMG5_pPoint pp
                              double *closestDist,int *closestTet);
 int PMMG_locatePointBdy( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *triaNormals,int *nodeTrias,PMMG_barycoord *barycoord,
-                         int *iTria,int *foundWedge,int *foundCone );
+                         int *iTria,int *foundWedge,int *foundCone,int *nstep );
 int PMMG_locatePointVol( MMG5_pMesh mesh,MMG5_pPoint ppt,
                          double *faceAreas,PMMG_barycoord *barycoord,
-                         int *idxTet );
+                         int *idxTet,int *nstep );
 void PMMG_locatePoint_errorCheck( MMG5_pMesh mesh,int ip,int ier,int myrank,int igrp );
-void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld );
-void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,PMMG_locateStats *locStats );
+void PMMG_locate_setStart( MMG5_pMesh mesh,MMG5_pMesh meshOld,
+                           int *start,int *startOld );
+void PMMG_locate_postprocessing( MMG5_pMesh mesh,MMG5_pMesh meshOld,int *nstep,
+                                 PMMG_locateStats *locStats );
 void PMMG_locate_print( PMMG_locateStats *locStats,int ngrp,int myrank );
 
 #endif
@@ -125,110 +125,58 @@ int PMMG_saveGraph( PMMG_pParMesh parmesh,idx_t *xadj,idx_t *adjncy,
 }
 
 /**
- * \param parmesh pointer toward the parmesh structure.
- * \param hgrp pointer toward the hatable.
- * \param hsiz initial size of hash table.
- * \param hmax maximal size of the hash table.
+ * \param a pointer toward a PMMG_grpAdja structure.
+ * \param b pointer toward a PMMG_grpAdja structure.
  *
- * \return 1 if success, 0 if fail.
+ * \return -1 if \a a is before \a b, 1 if it is after, 0 if they are equal.
  *
- * Initialisation of the hash table of group adjacency.
+ * Compare two contributions to the group graph by local group index, then by
+ * global index of the adjacent group.
  *
  */
-static inline
-int PMMG_hashNew( PMMG_pParMesh parmesh,PMMG_HGrp *hash,int hsiz,int hmax ) {
-  int k;
-
-  /* adjust hash table params */
-  hash->siz  = hsiz+1;
-  hash->max  = hmax + 2;
-  hash->nxt  = hash->siz;
-
-  PMMG_CALLOC(parmesh,hash->item,hash->max+1,PMMG_hgrp,"group hash table",return 0);
+static int PMMG_compare_grpAdja( const void *a,const void *b ) {
+  const PMMG_grpAdja *adja_a = (const PMMG_grpAdja*)a;
+  const PMMG_grpAdja *adja_b = (const PMMG_grpAdja*)b;
 
-  for (k=0; k<hash->siz; ++k ) {
-    hash->item[k].adj = PMMG_UNSET;
-    hash->item[k].wgt = PMMG_NUL;
-  }
+  if ( adja_a->grp != adja_b->grp )
+    return ( adja_a->grp < adja_b->grp ) ? -1 : 1;
 
-  for (k=hash->siz; k<hash->max; ++k) {
-    hash->item[k].adj = PMMG_UNSET;
-    hash->item[k].wgt = PMMG_NUL;
-    hash->item[k].nxt = k+1;
-  }
+  if ( adja_a->adj != adja_b->adj )
+    return ( adja_a->adj < adja_b->adj ) ? -1 : 1;
 
-  return 1;
+  return 0;
 }
 
 /**
- * \param parmesh pointer toward the parmesh structure.
- * \param hash pointer toward the hash table of group adja
- * \param k    local id (in the parmesh) of the group to which we want to add
- *             an adjacent.
- * \param adj  global id of the adjacent group
+ * \param x exponent (non-negative).
  *
- * \return 2 if adj is already listed, 1 if we success to add \a adj to the hash
- * table, 0 if fail
+ * \return an approximation of exp(x) bounded by PMMG_WGTVAL_HUGEINT.
  *
- * Add the group id \a adj to the hash table at key \a k+1. The group is added
- * in such way that the key \a k+1 gives a list of groups sorted in ascending
- * order (except for the first item of the list that is not ordered).
+ * Cheap evaluation of the interface weights: exp(x) is the product of a table
+ * of exp(k) for the integer part k of x and of a fourth order expansion for its
+ * fractional part (relative error below 0.4%, far below the truncation of the
+ * weights to integers).
  *
  */
 static inline
-int PMMG_hashGrp( PMMG_pParMesh parmesh,PMMG_HGrp *hash, int k, idx_t adj,
-                  idx_t wgt ) {
-  PMMG_hgrp  *ph;
-  int        tmp_nxt,j,newsize;
-
-  ph  = &hash->item[k+1];
-
-  if ( ph->adj == adj ) {
-    ph->wgt += wgt;
-    return 2;
-  }
-
-  tmp_nxt = 0;
-  if ( PMMG_UNSET != ph->adj ) {
-    while ( ph->nxt && (ph->nxt<hash->max) && (hash->item[ph->nxt].adj<adj) )
-      ph = &hash->item[ph->nxt];
-
-    if ( hash->item[ph->nxt].adj == adj ) {
-      hash->item[ph->nxt].wgt += wgt;
-      return 2;
-    }
-
-    tmp_nxt   = ph->nxt;
-    ph->nxt   = hash->nxt;
-    ph        = &hash->item[hash->nxt];
-
-    if ( hash->nxt >= hash->max-1 ) {
-      newsize = MG_MAX((int)((1+PMMG_GAP)*hash->max),hash->max+1);
-      PMMG_RECALLOC(parmesh,hash->item,newsize,hash->max,PMMG_hgrp,
-                    "grp hash table: if we pass too much time here"
-                    " (on true cases (more than 20 procs)), it means"
-                    " that the hmax value is not a good estimation of the"
-                    " interprocessor adjacency... TO CHANGE",return 0);
-      hash->max = newsize;
-
-      /* ph pointer may be false after realloc */
-      ph        = &hash->item[hash->nxt];
-
-      for (j=ph->nxt; j<hash->max; j++) {
-        hash->item[j].adj = PMMG_UNSET;
-        hash->item[j].wgt = PMMG_NUL;
-        hash->item[j].nxt = j+1;
-      }
-    }
-    hash->nxt = ph->nxt;
-  }
-
-  /* insert new group */
-  ph->adj  = adj;
-  ph->wgt += wgt;
-  ph->nxt  = tmp_nxt;
-
-  return 1;
+double PMMG_expWgt( double x ) {
+  static const double expint[PMMG_WGTVAL_NEXP] = {
+    1.0,                 2.718281828459045,   7.38905609893065,
+    20.085536923187668,  54.598150033144236,  148.4131591025766,
+    403.4287934927351,   1096.6331584284585,  2980.9579870417283,
+    8103.083927575384,   22026.465794806718,  59874.14171519782,
+    162754.79141900392,  442413.3920089205 };
+  double f;
+  int    k;
+
+  if ( x <= 0.0 ) return 1.0;
+  if ( x >= (double)PMMG_WGTVAL_NEXP ) return PMMG_WGTVAL_HUGEINT;
+
+  k = (int)x;
+  f = x - (double)k;
+
+  return MG_MIN(expint[k]*(1.0+f*(1.0+f*(0.5+f*(1.0/6.0+f/24.0)))),
+                PMMG_WGTVAL_HUGEINT);
 }
 
 /**
@@ -291,7 +239,7 @@ double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac )
       else
         res += 1.0/len-1.0;
     }
-    res = MG_MIN(1.0/exp(alpha*res/3.0),PMMG_WGTVAL_HUGEINT);
+    res = PMMG_expWgt(-alpha*res/3.0);
   }
   else {
     res = PMMG_WGTVAL_HUGEINT;
@@ -788,7 +736,7 @@ int PMMG_graph_meshElts2metis( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol m
   }
   /* Don't compute weights at mesh distribution, or if output load balancing is required at last iter */
   if( (parmesh->iter != PMMG_UNSET) &&
-      ((parmesh->iter < parmesh->niter-1) || parmesh->info.nobalancing) ) {
+      ((parmesh->iter < PMMG_niter_eff(parmesh)-1) || parmesh->info.nobalancing) ) {
     PMMG_CALLOC(parmesh, (*adjwgt), (*nadjncy), idx_t, "allocate adjwgt", ier=0;);
     if( !ier ) {
       PMMG_DEL_MEM(parmesh, (*xadj), idx_t, "deallocate xadj" );
@@ -839,7 +787,12 @@ int PMMG_graph_meshElts2metis( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_pSol m
  *
  * \return  1 if success, 0 if fail
  *
- * Build the metis graph with the mesh elements as metis nodes.
+ * Build the metis graph with the mesh groups as metis nodes.
+ *
+ * \remark the group adjacency is read directly from the face communicators:
+ * each interface face of a group produces at most one (group,adjacent,weight)
+ * contribution, the contributions are sorted and merged once, so the cost only
+ * depends on the interface size.
  *
  */
 int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
@@ -850,8 +803,7 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   PMMG_pGrp      grp;
   PMMG_pExt_comm ext_face_comm;
   PMMG_pInt_comm int_face_comm;
-  PMMG_HGrp      hash;
-  PMMG_hgrp      *ph;
+  PMMG_grpAdja   *adja;
   MMG5_pMesh     mesh;
   MMG5_pSol      met;
   MMG5_pTetra    pt;
@@ -860,11 +812,11 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   MPI_Status     status;
   int            *face2int_face_comm_index1,*face2int_face_comm_index2;
   int            *intvalues,*itosend,*itorecv;
-  double         *doublevalues,*rtosend,*rtorecv;
-  int            found,color;
+  double         *doublevalues,*rtosend,*rtorecv,wgtface;
+  int            color,nadja,grpval;
   int            ngrp,myrank,nitem,k,igrp,igrp_adj,i,idx,ie,ifac,ishift,wgt;
 
-  if( (parmesh->iter == parmesh->niter-1) && !parmesh->info.nobalancing ) {
+  if( (parmesh->iter == PMMG_niter_eff(parmesh)-1) && !parmesh->info.nobalancing ) {
     /* Switch off weights for output load balancing */
     *wgtflag = PMMG_WGTFLAG_NONE;
   } else {
@@ -878,6 +830,8 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   grp    = parmesh->listgrp;
   myrank = parmesh->myrank;
   ngrp   = parmesh->ngrp;
+  adja   = NULL;
+  *adjncy = NULL;
 
   /** Step 1: Fill vtxdist array with the range of groups local to each
    * processor */
@@ -918,9 +872,9 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   for ( k=0; k < (*ncon); ++k )
     (*ubvec)[k] = PMMG_UBVEC_DEF;
 
-  /** Step 3: Fill the internal communicator with the greater index of the 2
-   * groups to which the face belong. Use a minus sign to mark old parallel
-   * faces.*/
+  /** Step 3: Allocate the list of graph contributions: each face of the
+   * internal communicator is seen once per group, and gives at most one
+   * contribution per group. */
   PMMG_CALLOC(parmesh,*xadj,ngrp+1,idx_t,"parmetis xadj", goto fail_4);
 
   int_face_comm = parmesh->int_face_comm;
@@ -930,17 +884,28 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
   PMMG_CALLOC(parmesh,int_face_comm->doublevalues,int_face_comm->nitem,double,
               "face communicator",goto fail_5);
 
+  nadja = 0;
+  for ( igrp=0; igrp<ngrp; ++igrp )
+    nadja += parmesh->listgrp[igrp].nitem_int_face_comm;
+
+  PMMG_MALLOC(parmesh,adja,nadja,PMMG_grpAdja,"group graph contributions",
+              goto fail_6);
+
   /* Face communicator initialization */
   intvalues = parmesh->int_face_comm->intvalues;
   doublevalues = parmesh->int_face_comm->doublevalues;
   for ( k=0; k < int_face_comm->nitem; ++k )
     intvalues[k] = PMMG_UNSET;
 
-  /*Fill the internal communicator with the greater index of the 2 groups to
-   * which the face belong (igrp+ishift, to avoid ambiguity on grp 0 and with
-   * PMMG_UNSET) */
+  /** Step 4: Travel the interface faces of the groups. The first group that
+   * reaches a face stores its index (igrp+ishift, to avoid ambiguity on grp 0
+   * and with PMMG_UNSET, with a minus sign if the face was parallel in the
+   * previous adaptation iteration) and its part of the face weight in the
+   * internal communicator. The second group that reaches the face (faces shared
+   * by two local groups) directly adds the graph edge in both directions. */
   ishift = abs(PMMG_UNSET)+1;
-  for ( igrp=ngrp-1; igrp>=0; --igrp ) {
+  nadja  = 0;
+  for ( igrp=0; igrp<ngrp; ++igrp ) {
     grp                       = &parmesh->listgrp[igrp];
     mesh                      = grp->mesh;
     met                       = grp->met;
@@ -950,187 +915,123 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
     for ( k=0; k<grp->nitem_int_face_comm; ++k ) {
       ie   =  face2int_face_comm_index1[k]/12;
       ifac = (face2int_face_comm_index1[k]%12)/3;
+      idx  =  face2int_face_comm_index2[k];
       pt = &mesh->tetra[ie];
       assert( MG_EOK(pt) && pt->xt );
       pxt = &mesh->xtetra[pt->xt];
 
       /* Increase grp weight by the inverse of the interface element quality */
-      if( pxt->ftag[ifac] & MG_OLDPARBDY )
-        doublevalues[face2int_face_comm_index2[k]] += PMMG_computeWgt(mesh,met,pt,ifac);
+      if( pxt->ftag[ifac] & MG_OLDPARBDY ) {
+        wgtface = PMMG_computeWgt(mesh,met,pt,ifac);
+        grpval  = -(igrp+ishift);
+      }
+      else {
+        wgtface = 0.;
+        grpval  = igrp+ishift;
+      }
 
-      if ( PMMG_UNSET == intvalues[face2int_face_comm_index2[k] ] ) {
+      if ( PMMG_UNSET == intvalues[idx] ) {
+        intvalues[idx]    = grpval;
+        doublevalues[idx] = wgtface;
+        continue;
+      }
 
-        /* Save group ID with a minus sign if the face was parallel in the
-         * previous adaptation iteration */
-        if( pxt->ftag[ifac] & MG_OLDPARBDY )
-          intvalues[face2int_face_comm_index2[k]]= -(igrp+ishift);
-        else
-          intvalues[face2int_face_comm_index2[k]]= igrp+ishift;
+      /* Face shared by two local groups */
+      igrp_adj = abs(intvalues[idx])-ishift;
+      if ( igrp_adj == igrp ) continue;
 
-      }
+      if ( intvalues[idx] <= -ishift )
+        wgt = (int)( doublevalues[idx]+wgtface );
+      else
+        wgt = 0;
+
+      adja[nadja].grp   = igrp;
+      adja[nadja].adj   = igrp_adj+(*vtxdist)[myrank];
+      adja[nadja++].wgt = wgt;
+
+      adja[nadja].grp   = igrp_adj;
+      adja[nadja].adj   = igrp+(*vtxdist)[myrank];
+      adja[nadja++].wgt = wgt;
     }
   }
 
-  /** Step 4: Send and receive external communicators filled by the (group id +
-   * ishift) of the neighbours (through the faces) */
+  /** Step 5: Send and receive external communicators filled by the (group id +
+   * ishift) of the neighbours (through the faces) and add the graph edges
+   * toward the groups of the other processors */
   for ( k=0; k<parmesh->next_face_comm; ++k ) {
     ext_face_comm = &parmesh->ext_face_comm[k];
     nitem         = ext_face_comm->nitem;
     color         = ext_face_comm->color_out;
 
     PMMG_CALLOC(parmesh,ext_face_comm->itosend,nitem,int,"itosend array",
-                goto fail_6);
+                goto fail_7);
     itosend = ext_face_comm->itosend;
 
     PMMG_CALLOC(parmesh,ext_face_comm->itorecv,nitem,int,"itorecv array",
-                goto fail_6);
+                goto fail_7);
     itorecv       = ext_face_comm->itorecv;
 
     PMMG_CALLOC(parmesh,ext_face_comm->rtosend,nitem,double,"rtosend array",
-                goto fail_6);
+                goto fail_7);
     rtosend = ext_face_comm->rtosend;
 
     PMMG_CALLOC(parmesh,ext_face_comm->rtorecv,nitem,double,"rtorecv array",
-                goto fail_6);
+                goto fail_7);
     rtorecv       = ext_face_comm->rtorecv;
 
     for ( i=0; i<nitem; ++i ) {
       idx            = ext_face_comm->int_comm_index[i];
       rtosend[i]     = doublevalues[idx] ;
       itosend[i]     = intvalues[idx] ;
-      /* Mark the face as boundary in the intvalues array */
-      intvalues[idx] = PMMG_UNSET;
     }
 
     MPI_CHECK(
       MPI_Sendrecv(itosend,nitem,MPI_INT,color,MPI_PARMESHGRPS2PARMETIS_TAG,
                    itorecv,nitem,MPI_INT,color,MPI_PARMESHGRPS2PARMETIS_TAG,
-                   comm,&status),goto fail_6 );
+                   comm,&status),goto fail_7 );
     MPI_CHECK(
       MPI_Sendrecv(rtosend,nitem,MPI_DOUBLE,color,MPI_PARMESHGRPS2PARMETIS_TAG,
                    rtorecv,nitem,MPI_DOUBLE,color,MPI_PARMESHGRPS2PARMETIS_TAG,
-                   comm,&status),goto fail_6 );
-  }
-
-   /** Step 5: Process the external communicators to count for each group the
-    * adjacent groups located on another processor and fill the sorted linked
-    * list of adjacency */
-
-  /* hash is used to store the sorted list of adjacent groups to a group */
-  if ( !PMMG_hashNew(parmesh,&hash,ngrp+1,PMMG_NBADJA_GRPS*ngrp+1) )
-    goto fail_6;
-
-  for (  k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
-    itosend       = ext_face_comm->itosend;
-    itorecv       = ext_face_comm->itorecv;
-    rtosend       = ext_face_comm->rtosend;
-    rtorecv       = ext_face_comm->rtorecv;
-    nitem         = ext_face_comm->nitem;
+                   comm,&status),goto fail_7 );
 
-    /* i2send array contains the group id of the boundary faces and i2recv the
-     * group id of the same face in the other proc */
     for ( i=0; i<nitem; ++i ) {
       /* Get the group id (+ishift) of the face in our proc and the group id
        * (+ishift) of the face in the adjacent proc */
       igrp     = itosend[i];
       igrp_adj = itorecv[i];
 
-      /* Put high weight on old parallel faces (marked by a minus sign)
-       * and reset signs; then, get grp indices starting from 0 */
+      /* Put high weight on old parallel faces (marked by a minus sign) */
       if( igrp_adj <= -ishift ) {
         assert( igrp <= -ishift );
         wgt = (int)( rtosend[i]+rtorecv[i] );
-        igrp     *= -1;
-        igrp_adj *= -1;
       } else {
         assert( igrp >=  ishift );
         wgt = 0;
       }
-      igrp     -= ishift;
-      igrp_adj -= ishift;
-
-      assert ( igrp != PMMG_UNSET );
-      assert ( igrp_adj != PMMG_UNSET );
-
-      /* Search the neighbour in the hash table and insert it if not found */
-      found = PMMG_hashGrp(parmesh,&hash,igrp,igrp_adj
-                           +(*vtxdist)[ext_face_comm->color_out],wgt);
-
-      if ( !found ) {
-        fprintf(stderr,"  ## Error: %s: unable to add a new group in adjacency"
-                " hash table.\n",__func__);
-        goto fail_7;
-      }
-      if ( found==2 ) continue; // The group is already in the adja list
-
-      ++(*xadj)[ igrp+1 ];
-    }
-  }
-
-  /** Step 6: Foreach group, process the internal communicator arrays and count
-   * the number of neighbours of the group. Update at the same time the linked
-   * list of adjacency */
-  for ( igrp=0; igrp<ngrp; ++igrp ) {
-    grp                       = &parmesh->listgrp[igrp];
-    face2int_face_comm_index2 = grp->face2int_face_comm_index2;
-
-    for ( i=0; i<grp->nitem_int_face_comm; ++i ) {
-      igrp_adj = intvalues[face2int_face_comm_index2[i]];
-
-      /* Put high weight on old parallel faces (marked by a minus sign) and
-       * reset signs; then, get grp index starting from 0 */
-      if ( igrp_adj <= -ishift ) {
-        wgt = (int)doublevalues[face2int_face_comm_index2[i]];
-        igrp_adj *= -1;
-      } else {
-        wgt = 0;
-      }
-      igrp_adj -= ishift;
 
-      if ( igrp_adj==PMMG_UNSET || igrp_adj<=igrp ) continue;
-
-      /* Insert igrp_adj in the sorted list of igrp if not already found,
-       * increment weight if found */
-      found = PMMG_hashGrp(parmesh,&hash,igrp,igrp_adj+(*vtxdist)[myrank],wgt);
-      if ( !found ) {
-        fprintf(stderr,"  ## Error: %s: unable to add a new group in adjacency"
-                " hash table.\n",__func__);
-        goto fail_7;
-      }
-      /* Count group only if not already in the adja list */
-      if ( found!=2 ) ++(*xadj)[ igrp+1 ];
-
-      /* Insert igrp in the sorted list of igrp_adj if not already found,
-       * increment weight if found */
-      found = PMMG_hashGrp(parmesh,&hash,igrp_adj,igrp+(*vtxdist)[myrank],wgt);
-      if ( !found ) {
-        fprintf(stderr,"  ## Error: %s: unable to add a new group in adjacency"
-                " hash table.\n",__func__);
-        goto fail_7;
-      }
-      /* Count group only if not already in the adja list */
-      if ( found !=2 ) ++(*xadj)[ igrp_adj+1 ];
+      adja[nadja].grp   = abs(igrp)-ishift;
+      adja[nadja].adj   = abs(igrp_adj)-ishift+(*vtxdist)[color];
+      adja[nadja++].wgt = wgt;
     }
   }
-#ifndef NDEBUG
-  /* Check that the sum of shared faces for each grp is equal to the nb. of its
-   * faces in the communicator */
-  for ( igrp=0; igrp<ngrp; ++igrp ) {
-    grp  = &parmesh->listgrp[igrp];
-
-    found = 0;
-    ph = &hash.item[igrp+1];
-    if( PMMG_UNSET==ph->adj ) continue;
 
+  /** Step 6: Sort the contributions by group then by adjacent group, merge the
+   * contributions of a same pair of groups and count the number of adjacents
+   * of each group */
+  if ( nadja )
+    qsort(adja,nadja,sizeof(PMMG_grpAdja),PMMG_compare_grpAdja);
 
-    found += ph->wgt;
-    while ( ph->nxt ) {
-      ph = &hash.item[ph->nxt];
-      found += ph->wgt;
+  (*nadjncy) = 0;
+  for ( k=0; k<nadja; ++k ) {
+    assert ( adja[k].grp >= 0 && adja[k].grp < ngrp );
+    if ( (*nadjncy) && adja[(*nadjncy)-1].grp == adja[k].grp
+         && adja[(*nadjncy)-1].adj == adja[k].adj ) {
+      adja[(*nadjncy)-1].wgt += adja[k].wgt;
+      continue;
     }
+    adja[(*nadjncy)++] = adja[k];
+    ++(*xadj)[ adja[k].grp+1 ];
   }
-#endif
 
   /** Step 7: xadj array contains the number of adja per group, fill it for
    * Metis (it must contains the index of the first adja of the group in the
@@ -1139,27 +1040,16 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
     (*xadj)[igrp] += (*xadj)[igrp-1];
 
   /** Step 8: Fill adjncy array at metis format */
+  assert ( (*nadjncy)==(*xadj)[ngrp] );
   PMMG_CALLOC(parmesh,*adjncy,(*xadj)[ngrp],idx_t,"adjcncy parmetis array",
               goto fail_7);
   PMMG_CALLOC(parmesh,*adjwgt,(*xadj)[ngrp],idx_t,"parmetis adjwgt",
               goto fail_7);
 
-  (*nadjncy) = 0;
-  for ( igrp=0; igrp<=ngrp; ++igrp ) {
-
-    ph = &hash.item[igrp+1];
-    if ( PMMG_UNSET==ph->adj ) continue;
-
-    (*adjncy)[(*nadjncy)]   = ph->adj;
-    (*adjwgt)[(*nadjncy)++] = MG_MAX(ph->wgt,1);
-
-    while ( ph->nxt ) {
-      ph                = &hash.item[ph->nxt];
-      (*adjncy)[(*nadjncy)]   = ph->adj;
-      (*adjwgt)[(*nadjncy)++] = MG_MAX(ph->wgt,1);
-    }
+  for ( k=0; k<(*nadjncy); ++k ) {
+    (*adjncy)[k] = adja[k].adj;
+    (*adjwgt)[k] = MG_MAX(adja[k].wgt,1);
   }
-  assert ( (*nadjncy)==(*xadj)[ngrp] );
 
 #ifndef NDEBUG
   /* Print graph to file */
@@ -1199,7 +1089,6 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
 
   for ( k=0; k<parmesh->next_face_comm; ++k ) {
     ext_face_comm = &parmesh->ext_face_comm[k];
-    nitem = ext_face_comm->nitem;
 
     if ( ext_face_comm->itorecv )
       PMMG_DEL_MEM(parmesh,ext_face_comm->itorecv,int,"itorecv array");
@@ -1210,36 +1099,29 @@ int PMMG_graph_parmeshGrps2parmetis( PMMG_pParMesh parmesh,idx_t **vtxdist,
     if ( ext_face_comm->rtosend )
       PMMG_DEL_MEM(parmesh,ext_face_comm->rtosend,double,"rtosend array");
   }
-  PMMG_DEL_MEM(parmesh,hash.item,PMMG_hgrp,"group hash table");
+  PMMG_DEL_MEM(parmesh,adja,PMMG_grpAdja,"group graph contributions");
   PMMG_DEL_MEM(parmesh,int_face_comm->intvalues,int,"face communicator");
   PMMG_DEL_MEM(parmesh,int_face_comm->doublevalues,double,"face communicator");
 
   return 1;
 
 fail_7:
-  if ( hash.item )
-    PMMG_DEL_MEM(parmesh,hash.item,PMMG_hgrp,"group hash table");
-fail_6:
   for ( k=0; k<parmesh->next_face_comm; ++k ) {
     ext_face_comm = &parmesh->ext_face_comm[k];
     if ( ext_face_comm->itorecv )
       PMMG_DEL_MEM(parmesh,ext_face_comm->itorecv,int,"itorecv array");
-  }
-  for ( k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
     if ( ext_face_comm->itosend )
       PMMG_DEL_MEM(parmesh,ext_face_comm->itosend,int,"itosend array");
-  }
-  for ( k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
     if ( ext_face_comm->rtorecv )
       PMMG_DEL_MEM(parmesh,ext_face_comm->rtorecv,double,"rtorecv array");
-  }
-  for ( k=0; k<parmesh->next_face_comm; ++k ) {
-    ext_face_comm = &parmesh->ext_face_comm[k];
     if ( ext_face_comm->rtosend )
       PMMG_DEL_MEM(parmesh,ext_face_comm->rtosend,double,"rtosend array");
   }
+  if ( *adjncy )
+    PMMG_DEL_MEM(parmesh,*adjncy,idx_t,"adjcncy parmetis array");
+  if ( adja )
+    PMMG_DEL_MEM(parmesh,adja,PMMG_grpAdja,"group graph contributions");
+fail_6:
   if ( int_face_comm->intvalues )
     PMMG_DEL_MEM(parmesh,int_face_comm->intvalues,int,"face communicator");
   if ( int_face_comm->doublevalues )
@@ -1284,6 +1166,11 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
 
   xadj = adjncy = vwgt = adjwgt = NULL;
 
+  if ( parmesh->info.loadbalancing_mode == PMMG_LOADBALANCING_sfc ) {
+    /* No graph: cut a space-filling curve */
+    return PMMG_part_meshElts2sfc( parmesh, part, nproc );
+  }
+
   /* Set contiguity of partitions if using Metis also for graph partitioning */
   METIS_SetDefaultOptions(options);
   options[METIS_OPTION_CONTIG] = ( parmesh->info.contiguous_mode &&
@@ -1330,6 +1217,71 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
   return status;
 }
 
+/**
+ * \param x integer coordinates (\a PMMG_SFC_NBITS bits each), overwritten.
+ *
+ * \return the index of the point along the Hilbert curve.
+ *
+ * Hilbert index computed with the transposition algorithm of J. Skilling
+ * (Programming the Hilbert curve, AIP Conf. Proc. 707, 2004).
+ *
+ */
+static inline
+uint64_t PMMG_sfc_hilbertKey( uint32_t x[3] ) {
+  uint64_t key;
+  uint32_t p,q,t;
+  int      i,j;
+
+  /* Inverse undo excess work */
+  for ( q=1u<<(PMMG_SFC_NBITS-1); q>1; q>>=1 ) {
+    p = q-1;
+    for ( i=0; i<3; ++i ) {
+      if ( x[i] & q ) {
+        x[0] ^= p;
+      }
+      else {
+        t = (x[0]^x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  /* Gray encode */
+  for ( i=1; i<3; ++i ) x[i] ^= x[i-1];
+  t = 0;
+  for ( q=1u<<(PMMG_SFC_NBITS-1); q>1; q>>=1 ) {
+    if ( x[2] & q ) t ^= q-1;
+  }
+  for ( i=0; i<3; ++i ) x[i] ^= t;
+
+  /* Interleave the transposed bits */
+  key = 0;
+  for ( j=PMMG_SFC_NBITS-1; j>=0; --j ) {
+    for ( i=0; i<3; ++i ) {
+      key = (key<<1) | ((x[i]>>j) & 1u);
+    }
+  }
+  return key;
+}
+
+/**
+ * \param a pointer toward a PMMG_sfcItem.
+ * \param b pointer toward a PMMG_sfcItem.
+ *
+ * \return -1, 0 or 1 whether \a a is before, equal or after \a b along the
+ * curve.
+ *
+ */
+static
+int PMMG_sfc_compare( const void *a,const void *b ) {
+  const PMMG_sfcItem *i0 = (const PMMG_sfcItem*)a;
+  const PMMG_sfcItem *i1 = (const PMMG_sfcItem*)b;
+
+  if ( i0->key != i1->key ) return ( i0->key > i1->key ) ? 1 : -1;
+  return ( i0->idx > i1->idx ) - ( i0->idx < i1->idx );
+}
+
 /**
  * \param parmesh pointer toward the parmesh structure
  * \param part pointer of an array containing the partitions (at the end)
@@ -1337,68 +1289,143 @@ int PMMG_part_meshElts2metis( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
  *
  * \return  1 if success, 0 if fail
  *
- * Use metis to partition the first mesh in the list of meshes into nproc groups
+ * Partition the first mesh in the list of meshes into nproc groups by sorting
+ * the element barycenters along a Hilbert curve and cutting the curve into
+ * chunks of equal number of elements. No graph is built: it is much cheaper
+ * than Metis but the interfaces between groups are larger.
  *
  */
-int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
+int PMMG_part_meshElts2sfc( PMMG_pParMesh parmesh, idx_t* part, idx_t nproc )
+{
+  MMG5_pMesh   mesh = parmesh->listgrp[0].mesh;
+  MMG5_pTetra  pt;
+  MMG5_pPoint  ppt;
+  PMMG_sfcItem *item;
+  double       min[3],max[3],bary[3],scale[3];
+  uint32_t     x[3],imax;
+  int          ne,k,i,j;
+
+  ne = mesh->ne;
+
+  /** Bounding box of the mesh */
+  for ( j=0; j<3; ++j ) {
+    min[j] =  DBL_MAX;
+    max[j] = -DBL_MAX;
+  }
+  for ( k=1; k<=mesh->np; ++k ) {
+    ppt = &mesh->point[k];
+    if ( !MG_VOK(ppt) ) continue;
+    for ( j=0; j<3; ++j ) {
+      min[j] = MG_MIN(min[j],ppt->c[j]);
+      max[j] = MG_MAX(max[j],ppt->c[j]);
+    }
+  }
+  imax = (1u<<PMMG_SFC_NBITS)-1;
+  for ( j=0; j<3; ++j ) {
+    scale[j] = ( max[j] > min[j] ) ? imax / (max[j]-min[j]) : 0.;
+  }
+
+  /** Hilbert index of the barycenters */
+  PMMG_MALLOC(parmesh,item,ne,PMMG_sfcItem,"sfc items",return 0);
+
+  for ( k=1; k<=ne; ++k ) {
+    pt = &mesh->tetra[k];
+    for ( j=0; j<3; ++j ) {
+      bary[j] = 0.;
+      for ( i=0; i<4; ++i ) {
+        bary[j] += mesh->point[pt->v[i]].c[j];
+      }
+      bary[j] *= 0.25;
+      x[j] = (uint32_t)MG_MIN((double)imax,MG_MAX(0.,(bary[j]-min[j])*scale[j]));
+    }
+    item[k-1].key = PMMG_sfc_hilbertKey(x);
+    item[k-1].idx = k-1;
+  }
+
+  /** Sort and cut the curve */
+  qsort(item,ne,sizeof(PMMG_sfcItem),PMMG_sfc_compare);
+
+  for ( k=0; k<ne; ++k ) {
+    part[item[k].idx] = (idx_t)( ((int64_t)k * nproc) / ne );
+  }
+
+  PMMG_DEL_MEM(parmesh,item,PMMG_sfcItem,"sfc items");
+
+  /** Correct partitioning to avoid empty partitions */
+  if( !PMMG_correct_meshElts2metis( parmesh,part,ne,nproc ) ) return 0;
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nproc number of partitions asked
+ * \param root process on which the graph is gathered
+ * \param vtxdist pointer toward the range of groups local to each processor
+ * \param xadj_seq pointer toward the position of the group adjacents (on root)
+ * \param adjncy_seq pointer toward the list of group adjacents (on root)
+ * \param vwgt_seq pointer toward the metis node weights (on root)
+ * \param adjwgt_seq pointer toward the metis edge weights (on root)
+ * \param wgtflag how to apply the metis weights
+ * \param ncon number of weights per metis node
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Build the graph of the groups and gather it on the process \a root.
+ *
+ */
+static
+int PMMG_gather_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t nproc,int root,
+                                   idx_t **vtxdist,idx_t **xadj_seq,
+                                   idx_t **adjncy_seq,idx_t **vwgt_seq,
+                                   idx_t **adjwgt_seq,idx_t *wgtflag,idx_t *ncon )
 {
   real_t     *tpwgts,*ubvec;
-  idx_t      *xadj,*adjncy,*vwgt,*adjwgt,*vtxdist,adjsize;
-  idx_t      *xadj_seq,*adjncy_seq,*vwgt_seq,*adjwgt_seq,*part_seq;
+  idx_t      *xadj,*adjncy,*vwgt,*adjwgt,adjsize;
   idx_t      sendcounts,*recvcounts,*displs;
-  idx_t      wgtflag,numflag;
-  idx_t      ncon = 1; // number of balancing constraint
-  idx_t      options[METIS_NOPTIONS];
-  idx_t      objval = 0;
-  int        ngrp,nprocs,ier;
-  int        iproc,root,ip,status;
-
-  ngrp   = parmesh->ngrp;
-  nprocs = parmesh->nprocs;
-  ier    = 1;
+  idx_t      numflag;
+  int        iproc,ip;
 
   /** Build the parmetis graph */
-  xadj   = adjncy = vwgt = adjwgt = vtxdist = NULL;
+  xadj   = adjncy = vwgt = adjwgt = *vtxdist = NULL;
   tpwgts = ubvec  =  NULL;
 
-  if ( !PMMG_graph_parmeshGrps2parmetis(parmesh,&vtxdist,&xadj,&adjncy,&adjsize,
-                                        &vwgt,&adjwgt,&wgtflag,&numflag,&ncon,
+  if ( !PMMG_graph_parmeshGrps2parmetis(parmesh,vtxdist,&xadj,&adjncy,&adjsize,
+                                        &vwgt,&adjwgt,wgtflag,&numflag,ncon,
                                         nproc,&tpwgts,&ubvec) ) {
     fprintf(stderr,"\n  ## Error: Unable to build parmetis graph.\n");
     return 0;
   }
 
-  /** Gather the graph on proc 0 */
-  root = 0;
-  vwgt_seq = adjwgt_seq = NULL;
+  /** Gather the graph on proc root */
+  *xadj_seq = *adjncy_seq = *vwgt_seq = *adjwgt_seq = NULL;
   PMMG_CALLOC(parmesh,recvcounts,nproc,idx_t,"recvcounts", return 0);
   PMMG_CALLOC(parmesh,displs,nproc,idx_t,"displs", return 0);
 
   /** xadj, vwgt */
   for( iproc = 0; iproc<nproc; iproc++ ) {
-    recvcounts[iproc] = vtxdist[iproc+1]-vtxdist[iproc];
-    displs[iproc] = vtxdist[iproc];
+    recvcounts[iproc] = (*vtxdist)[iproc+1]-(*vtxdist)[iproc];
+    displs[iproc] = (*vtxdist)[iproc];
   }
 
-  xadj_seq = NULL;
   if(parmesh->myrank == root)
-    PMMG_CALLOC(parmesh,xadj_seq,vtxdist[nproc]+1,idx_t,"xadj_seq", return 0);
+    PMMG_CALLOC(parmesh,*xadj_seq,(*vtxdist)[nproc]+1,idx_t,"xadj_seq", return 0);
 
   MPI_CHECK( MPI_Gatherv(&xadj[1],recvcounts[parmesh->myrank],MPI_INT,
-                         &xadj_seq[1],recvcounts,displs,MPI_INT,
+                         &(*xadj_seq)[1],recvcounts,displs,MPI_INT,
                          root,parmesh->comm), return 0);
 
   if(parmesh->myrank == root)
     for( iproc = 0; iproc < nproc; iproc++ )
-      for( ip = 1; ip <= vtxdist[iproc+1]-vtxdist[iproc]; ip++ )
-          xadj_seq[vtxdist[iproc]+ip] += xadj_seq[vtxdist[iproc]];
+      for( ip = 1; ip <= (*vtxdist)[iproc+1]-(*vtxdist)[iproc]; ip++ )
+          (*xadj_seq)[(*vtxdist)[iproc]+ip] += (*xadj_seq)[(*vtxdist)[iproc]];
 
-  if(wgtflag == PMMG_WGTFLAG_VTX || wgtflag == PMMG_WGTFLAG_BOTH ) {
+  if(*wgtflag == PMMG_WGTFLAG_VTX || *wgtflag == PMMG_WGTFLAG_BOTH ) {
     if(parmesh->myrank == root)
-      PMMG_CALLOC(parmesh,vwgt_seq,vtxdist[nproc]+1,idx_t,"vwgt_seq", return 0);
+      PMMG_CALLOC(parmesh,*vwgt_seq,(*vtxdist)[nproc]+1,idx_t,"vwgt_seq", return 0);
 
     MPI_CHECK( MPI_Gatherv(vwgt,recvcounts[parmesh->myrank],MPI_INT,
-                           vwgt_seq,recvcounts,displs,MPI_INT,
+                           *vwgt_seq,recvcounts,displs,MPI_INT,
                            root,parmesh->comm), return 0);
   }
 
@@ -1412,20 +1439,19 @@ int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
     displs[iproc+1] = displs[iproc]+recvcounts[iproc];
   }
 
-  adjncy_seq = NULL;
   if ( parmesh->myrank == root )
-    PMMG_CALLOC(parmesh,adjncy_seq,xadj_seq[vtxdist[nproc]],idx_t,"xadj_seq", return 0);
+    PMMG_CALLOC(parmesh,*adjncy_seq,(*xadj_seq)[(*vtxdist)[nproc]],idx_t,"xadj_seq", return 0);
 
   MPI_CHECK( MPI_Gatherv(adjncy,recvcounts[parmesh->myrank],MPI_INT,
-                         adjncy_seq,recvcounts,displs,MPI_INT,
+                         *adjncy_seq,recvcounts,displs,MPI_INT,
                          root,parmesh->comm), return 0);
 
-  if(wgtflag == PMMG_WGTFLAG_ADJ || wgtflag == PMMG_WGTFLAG_BOTH ) {
+  if(*wgtflag == PMMG_WGTFLAG_ADJ || *wgtflag == PMMG_WGTFLAG_BOTH ) {
     if(parmesh->myrank == root)
-      PMMG_CALLOC(parmesh,adjwgt_seq,xadj_seq[vtxdist[nproc]],idx_t,"xadj_seq", return 0);
+      PMMG_CALLOC(parmesh,*adjwgt_seq,(*xadj_seq)[(*vtxdist)[nproc]],idx_t,"xadj_seq", return 0);
 
     MPI_CHECK( MPI_Gatherv(adjwgt,recvcounts[parmesh->myrank],MPI_INT,
-                           adjwgt_seq,recvcounts,displs,MPI_INT,
+                           *adjwgt_seq,recvcounts,displs,MPI_INT,
                            root,parmesh->comm), return 0);
   }
 
@@ -1433,56 +1459,154 @@ int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
   PMMG_DEL_MEM(parmesh,recvcounts,idx_t,"recvcounts");
   PMMG_DEL_MEM(parmesh,displs,idx_t,"displs");
 
+  PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
+  PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
+  PMMG_DEL_MEM(parmesh, ubvec, real_t,"parmetis ubvec");
+  PMMG_DEL_MEM(parmesh, tpwgts, real_t, "deallocate tpwgts" );
+  PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
+  PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param xadj_seq pointer toward the position of the group adjacents
+ * \param adjncy_seq pointer toward the list of group adjacents
+ * \param vwgt_seq pointer toward the metis node weights
+ * \param adjwgt_seq pointer toward the metis edge weights
+ *
+ * Free the centralized graph of the groups.
+ *
+ */
+static
+void PMMG_free_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t **xadj_seq,
+                                  idx_t **adjncy_seq,idx_t **vwgt_seq,
+                                  idx_t **adjwgt_seq ) {
+
+  PMMG_DEL_MEM(parmesh,*xadj_seq,idx_t,"xadj_seq");
+  PMMG_DEL_MEM(parmesh,*adjncy_seq,idx_t,"adjcncy_seq");
+  PMMG_DEL_MEM(parmesh,*vwgt_seq,idx_t,"vwgt_seq");
+  PMMG_DEL_MEM(parmesh,*adjwgt_seq,idx_t,"adjwgt_seq");
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param nvtx number of groups
+ * \param ncon number of weights per metis node
+ * \param xadj_seq position of the group adjacents
+ * \param adjncy_seq list of group adjacents
+ * \param vwgt_seq metis node weights (may be NULL)
+ * \param adjwgt_seq metis edge weights (may be NULL)
+ * \param nproc number of partitions asked
+ * \param seed seed of the metis random generator (metis default if negative)
+ * \param part_seq partition of the groups (at the end)
+ * \param objval edge cut of the partition (at the end)
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Call metis on the centralized graph of the groups.
+ *
+ */
+static
+int PMMG_metis_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t nvtx,idx_t *ncon,
+                                  idx_t *xadj_seq,idx_t *adjncy_seq,
+                                  idx_t *vwgt_seq,idx_t *adjwgt_seq,idx_t nproc,
+                                  int seed,idx_t *part_seq,idx_t *objval ) {
+  idx_t      options[METIS_NOPTIONS];
+  int        status;
+
+  /* Set contiguity of partitions */
+  METIS_SetDefaultOptions(options);
+  options[METIS_OPTION_CONTIG] = parmesh->info.contiguous_mode;
+  if ( seed >= 0 )
+    options[METIS_OPTION_SEED] = seed;
+
+  /** Call metis and get the partition array */
+  if( parmesh->nprocs >= 8 )
+    status = METIS_PartGraphKway( &nvtx,ncon,xadj_seq,adjncy_seq,
+                                  vwgt_seq,NULL,adjwgt_seq,&nproc,
+                                  NULL,NULL,options,objval, part_seq );
+  else
+    status = METIS_PartGraphRecursive( &nvtx,ncon,xadj_seq,adjncy_seq,
+                                       vwgt_seq,NULL,adjwgt_seq,&nproc,
+                                       NULL,NULL,options,objval, part_seq );
+
+  if ( status != METIS_OK ) {
+    switch ( status ) {
+      case METIS_ERROR_INPUT:
+        fprintf(stderr, "Group redistribution --- METIS_ERROR_INPUT: input data error\n" );
+        break;
+      case METIS_ERROR_MEMORY:
+        fprintf(stderr, "Group redistribution --- METIS_ERROR_MEMORY: could not allocate memory error\n" );
+        break;
+      case METIS_ERROR:
+        fprintf(stderr, "Group redistribution --- METIS_ERROR: generic error\n" );
+        break;
+      default:
+        fprintf(stderr, "Group redistribution --- METIS_ERROR: update your METIS error handling\n" );
+        break;
+    }
+    return 0;
+  }
+#ifndef NDEBUG
+  /* Print graph to file */
+/*  FILE* fid;
+  char filename[48];
+  int  iproc;
+  sprintf(filename,"part_centralized");
+  fid = fopen(filename,"w");
+  for( iproc = 0; iproc < nvtx; iproc++ )
+    fprintf(fid,"%d\n",part_seq[iproc]);
+  fclose(fid);*/
+#endif
+
+  return 1;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param nproc number of partitions asked
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Use metis to partition the first mesh in the list of meshes into nproc groups
+ *
+ */
+int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
+{
+  idx_t      *vtxdist,*xadj_seq,*adjncy_seq,*vwgt_seq,*adjwgt_seq,*part_seq;
+  idx_t      *recvcounts;
+  idx_t      wgtflag;
+  idx_t      ncon = 1; // number of balancing constraint
+  idx_t      objval = 0;
+  int        nprocs,ier;
+  int        iproc,root;
+
+  nprocs = parmesh->nprocs;
+  ier    = 1;
+
+  /** Build the graph and gather it on proc 0 */
+  root = 0;
+  if ( !PMMG_gather_parmeshGrps2metis(parmesh,nproc,root,&vtxdist,&xadj_seq,
+                                      &adjncy_seq,&vwgt_seq,&adjwgt_seq,
+                                      &wgtflag,&ncon) ) {
+    return 0;
+  }
 
   /** Call metis and get the partition array */
   if ( nprocs > 1 ) {
 
+    part_seq = NULL;
     if(parmesh->myrank == root) {
       PMMG_CALLOC(parmesh,part_seq,vtxdist[nproc],idx_t,"part_seq", return 0);
 
-
-      /* Set contiguity of partitions */
-      METIS_SetDefaultOptions(options);
-      options[METIS_OPTION_CONTIG] = parmesh->info.contiguous_mode;
-
-      /** Call metis and get the partition array */
-      if( nprocs >= 8 )
-        status = METIS_PartGraphKway( &vtxdist[nproc],&ncon,xadj_seq,adjncy_seq,
-                                      vwgt_seq,NULL,adjwgt_seq,&nproc,
-                                      NULL,NULL,options,&objval, part_seq );
-      else
-        status = METIS_PartGraphRecursive( &vtxdist[nproc],&ncon,xadj_seq,adjncy_seq,
-                                      vwgt_seq,NULL,adjwgt_seq,&nproc,
-                                      NULL,NULL,options,&objval, part_seq );
- 
-
-      if ( status != METIS_OK ) {
-        switch ( status ) {
-          case METIS_ERROR_INPUT:
-            fprintf(stderr, "Group redistribution --- METIS_ERROR_INPUT: input data error\n" );
-            break;
-          case METIS_ERROR_MEMORY:
-            fprintf(stderr, "Group redistribution --- METIS_ERROR_MEMORY: could not allocate memory error\n" );
-            break;
-          case METIS_ERROR:
-            fprintf(stderr, "Group redistribution --- METIS_ERROR: generic error\n" );
-            break;
-          default:
-            fprintf(stderr, "Group redistribution --- METIS_ERROR: update your METIS error handling\n" );
-            break;
-        }
+      if ( !PMMG_metis_parmeshGrps2metis(parmesh,vtxdist[nproc],&ncon,xadj_seq,
+                                         adjncy_seq,vwgt_seq,adjwgt_seq,nproc,
+                                         PMMG_UNSET,part_seq,&objval) ) {
         return 0;
       }
-#ifndef NDEBUG
-      /* Print graph to file */
-/*      FILE* fid;
-      char filename[48];
-      sprintf(filename,"part_centralized");
-      fid = fopen(filename,"w");
-      for( iproc = 0; iproc < vtxdist[nproc]; iproc++ )
-        fprintf(fid,"%d\n",part_seq[iproc]);
-      fclose(fid);*/
-#endif
     }
 
     /** Scatter the partition array */
@@ -1503,45 +1627,209 @@ int PMMG_part_parmeshGrps2metis( PMMG_pParMesh parmesh,idx_t* part,idx_t nproc )
 
   }
 
-  PMMG_DEL_MEM(parmesh, adjncy, idx_t, "deallocate adjncy" );
-  PMMG_DEL_MEM(parmesh, xadj, idx_t, "deallocate xadj" );
-  PMMG_DEL_MEM(parmesh, ubvec, real_t,"parmetis ubvec");
-  PMMG_DEL_MEM(parmesh, tpwgts, real_t, "deallocate tpwgts" );
   PMMG_DEL_MEM(parmesh, vtxdist, idx_t, "deallocate vtxdist" );
-  switch (wgtflag) {
-    case PMMG_WGTFLAG_ADJ:
-      PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
-      break;
-    case PMMG_WGTFLAG_VTX:
-      PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
-      break;
-    case PMMG_WGTFLAG_BOTH:
-      PMMG_DEL_MEM(parmesh, vwgt, idx_t, "deallocate vwgt" );
-      PMMG_DEL_MEM(parmesh, adjwgt, idx_t, "deallocate adjwgt" );
-      break;
-    default:
-      break;
+  PMMG_free_parmeshGrps2metis(parmesh,&xadj_seq,&adjncy_seq,&vwgt_seq,&adjwgt_seq);
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (filled at the end
+ * of \ref PMMG_part_parmeshGrps2metis_wait)
+ * \param nproc number of partitions asked
+ * \param req pointer toward the request of the partition
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Start the computation of the group partition on the subset of partitioner
+ * processes (the \a parmesh->info.npartitioners last ranks). The graph is
+ * gathered on the first partitioner and broadcasted to the others, each
+ * partitioner calls metis with its own seed and the partition with the lower
+ * edge cut is scattered to all the processes through a non-blocking scatter.
+ *
+ * The other processes return as soon as the scatter is posted and may compute
+ * until \ref PMMG_part_parmeshGrps2metis_wait is called. The scatter is posted
+ * by all the processes even if the partitioning fails: the returned error has
+ * to be given to \ref PMMG_part_parmeshGrps2metis_wait, that reduces it.
+ *
+ * \remark the partitioner processes also own groups: they receive their part
+ * of the partition as the others.
+ *
+ */
+int PMMG_part_parmeshGrps2metis_start( PMMG_pParMesh parmesh,idx_t* part,
+                                       idx_t nproc,PMMG_partRequest *req )
+{
+  MPI_Comm   partcomm;
+  idx_t      *xadj_seq,*adjncy_seq,*vwgt_seq,*adjwgt_seq,*part_seq;
+  idx_t      wgtflag,nvtx,nadj;
+  idx_t      ncon = 1; // number of balancing constraint
+  idx_t      objval = 0;
+  int        npart,partrank,ier,iproc;
+  struct {
+    int val;
+    int rank;
+  } cut;
+
+  npart     = MG_MIN(parmesh->info.npartitioners,parmesh->nprocs);
+  req->root = parmesh->nprocs-npart;
+  req->nproc = nproc;
+  req->request = MPI_REQUEST_NULL;
+  req->vtxdist = req->counts = req->part_seq = NULL;
+  xadj_seq = adjncy_seq = vwgt_seq = adjwgt_seq = part_seq = NULL;
+  partcomm = MPI_COMM_NULL;
+
+  /** Build the graph and gather it on the first partitioner */
+  ier = PMMG_gather_parmeshGrps2metis(parmesh,nproc,req->root,&req->vtxdist,
+                                      &xadj_seq,&adjncy_seq,&vwgt_seq,
+                                      &adjwgt_seq,&wgtflag,&ncon);
+
+  if ( ier ) {
+    PMMG_CALLOC(parmesh,req->counts,nproc,idx_t,"recvcounts", ier = 0);
+  }
+  if ( ier ) {
+    for( iproc = 0; iproc<nproc; iproc++ )
+      req->counts[iproc] = req->vtxdist[iproc+1]-req->vtxdist[iproc];
+    assert(req->counts[parmesh->myrank] == parmesh->ngrp);
   }
 
-  if(parmesh->myrank == root) {
-    PMMG_DEL_MEM(parmesh,xadj_seq,idx_t,"xadj_seq");
-    PMMG_DEL_MEM(parmesh,adjncy_seq,idx_t,"adjcncy_seq");
-    switch (wgtflag) {
-     case PMMG_WGTFLAG_ADJ:
-        PMMG_DEL_MEM(parmesh,adjwgt_seq,idx_t,"adjwgt_seq");
-        break;
-     case PMMG_WGTFLAG_VTX:
-        PMMG_DEL_MEM(parmesh,vwgt_seq,idx_t,"vwgt_seq");
-        break;
-     case PMMG_WGTFLAG_BOTH:
-        PMMG_DEL_MEM(parmesh,vwgt_seq,idx_t,"vwgt_seq");
-        PMMG_DEL_MEM(parmesh,adjwgt_seq,idx_t,"adjwgt_seq");
-        break;
-      default:
-        break;
+  /* The partition to scatter is allocated on the root before the partitioning
+   * so the scatter can always be posted (a failed partition is scattered and
+   * ignored) */
+  if ( ier && parmesh->myrank == req->root ) {
+    PMMG_CALLOC(parmesh,req->part_seq,req->vtxdist[nproc],idx_t,"part_seq",
+                ier = 0);
+  }
+
+  /* Failures that happen before the scatter are reduced so all the processes
+   * skip it together (the request arrays are freed by
+   * PMMG_part_parmeshGrps2metis_wait) */
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier = 0 );
+  if ( !ier ) {
+    PMMG_free_parmeshGrps2metis(parmesh,&xadj_seq,&adjncy_seq,&vwgt_seq,&adjwgt_seq);
+    return 0;
+  }
+
+  /** Partitioners: share the graph and compute the partition */
+  MPI_CHECK( MPI_Comm_split(parmesh->comm,
+                            parmesh->myrank >= req->root ? 0 : MPI_UNDEFINED,
+                            parmesh->myrank,&partcomm),
+             ier = 0; partcomm = MPI_COMM_NULL );
+
+  if ( partcomm != MPI_COMM_NULL ) {
+    MPI_Comm_rank(partcomm,&partrank);
+
+    nvtx = req->vtxdist[nproc];
+    nadj = partrank ? 0 : xadj_seq[nvtx];
+    MPI_CHECK( MPI_Bcast(&nadj,1,MPI_INT,0,partcomm), ier = 0 );
+
+    if ( ier && partrank ) {
+      PMMG_CALLOC(parmesh,xadj_seq,nvtx+1,idx_t,"xadj_seq",ier = 0);
+      PMMG_CALLOC(parmesh,adjncy_seq,nadj,idx_t,"adjncy_seq",ier = 0);
+      if ( wgtflag == PMMG_WGTFLAG_VTX || wgtflag == PMMG_WGTFLAG_BOTH )
+        PMMG_CALLOC(parmesh,vwgt_seq,nvtx+1,idx_t,"vwgt_seq",ier = 0);
+      if ( wgtflag == PMMG_WGTFLAG_ADJ || wgtflag == PMMG_WGTFLAG_BOTH )
+        PMMG_CALLOC(parmesh,adjwgt_seq,nadj,idx_t,"adjwgt_seq",ier = 0);
+      PMMG_CALLOC(parmesh,part_seq,nvtx,idx_t,"part_seq",ier = 0);
+    }
+    else if ( !partrank ) {
+      /* The first partitioner is the root */
+      assert ( parmesh->myrank == req->root );
+      part_seq = req->part_seq;
+    }
+
+    /* All the partitioners must enter the broadcasts */
+    MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,partcomm),
+               ier = 0 );
+
+    if ( ier ) {
+      MPI_CHECK( MPI_Bcast(xadj_seq,nvtx+1,MPI_INT,0,partcomm), ier = 0 );
+      MPI_CHECK( MPI_Bcast(adjncy_seq,nadj,MPI_INT,0,partcomm), ier = 0 );
+      if ( vwgt_seq )
+        MPI_CHECK( MPI_Bcast(vwgt_seq,nvtx+1,MPI_INT,0,partcomm), ier = 0 );
+      if ( adjwgt_seq )
+        MPI_CHECK( MPI_Bcast(adjwgt_seq,nadj,MPI_INT,0,partcomm), ier = 0 );
+    }
+
+    if ( ier ) {
+      ier = PMMG_metis_parmeshGrps2metis(parmesh,nvtx,&ncon,xadj_seq,adjncy_seq,
+                                         vwgt_seq,adjwgt_seq,nproc,partrank,
+                                         part_seq,&objval);
+    }
+
+    /* Elect the partition with the lower edge cut (a failure counts as an
+     * infinite cut) */
+    cut.val  = ier ? (int)objval : INT_MAX;
+    cut.rank = partrank;
+    MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&cut,1,MPI_2INT,MPI_MINLOC,partcomm),
+               ier = 0 );
+
+    if ( cut.val == INT_MAX ) {
+      ier = 0;
+    }
+    else if ( cut.rank ) {
+      /* Send the elected partition to the first partitioner */
+      if ( partrank == cut.rank ) {
+        MPI_CHECK( MPI_Send(part_seq,nvtx,MPI_INT,0,MPI_PARMESHGRPS2PARMETIS_TAG,
+                            partcomm), ier = 0 );
+      }
+      else if ( !partrank ) {
+        MPI_CHECK( MPI_Recv(part_seq,nvtx,MPI_INT,cut.rank,
+                            MPI_PARMESHGRPS2PARMETIS_TAG,partcomm,
+                            MPI_STATUS_IGNORE), ier = 0 );
+      }
+    }
+    MPI_Comm_free(&partcomm);
+
+    if ( partrank ) {
+      PMMG_DEL_MEM(parmesh,part_seq,idx_t,"part_seq");
     }
   }
+  PMMG_free_parmeshGrps2metis(parmesh,&xadj_seq,&adjncy_seq,&vwgt_seq,&adjwgt_seq);
+
+  /** Post the scatter of the partition: all the processes must enter it (even
+   * if the partitioning has failed), the error is reduced in \ref
+   * PMMG_part_parmeshGrps2metis_wait. */
+  MPI_CHECK( MPI_Iscatterv(req->part_seq,req->counts,req->vtxdist,MPI_INT,
+                           part,req->counts[parmesh->myrank],MPI_INT,
+                           req->root,parmesh->comm,&req->request),
+             ier = 0; req->request = MPI_REQUEST_NULL );
+
+  return ier;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ * \param part pointer of an array containing the partitions (at the end)
+ * \param req pointer toward the request of the partition
+ * \param ier 0 if the local computations made during the partitioning failed
+ *
+ * \return  1 if success, 0 if fail
+ *
+ * Wait for the partition started by \ref PMMG_part_parmeshGrps2metis_start and
+ * correct it to avoid empty procs.
+ *
+ */
+int PMMG_part_parmeshGrps2metis_wait( PMMG_pParMesh parmesh,idx_t* part,
+                                      PMMG_partRequest *req,int ier )
+{
+  if ( req->request != MPI_REQUEST_NULL ) {
+    MPI_CHECK( MPI_Wait(&req->request,MPI_STATUS_IGNORE), ier = 0 );
+  }
+
+  /* The partitioners may have failed */
+  MPI_CHECK( MPI_Allreduce(MPI_IN_PLACE,&ier,1,MPI_INT,MPI_MIN,parmesh->comm),
+             ier = 0 );
+
+  /** Correct partitioning to avoid empty procs */
+  if ( ier ) {
+    ier = PMMG_correct_parmeshGrps2parmetis(parmesh,req->vtxdist,part,req->nproc);
+  }
 
+  PMMG_DEL_MEM(parmesh,req->part_seq,idx_t,"part_seq");
+  PMMG_DEL_MEM(parmesh,req->counts,idx_t,"recvcounts");
+  PMMG_DEL_MEM(parmesh,req->vtxdist,idx_t,"deallocate vtxdist");
 
   return ier;
 }
@@ -81,45 +81,68 @@
 
 
 /**
- * \def PMMG_NBADJA_GRPS
+ * \def PMMG_WGTVAL_NEXP
  *
- * Supposed maximum number of groups adjacent to one given group
+ * Size of the table of exponentials used for the interface weights (the
+ * weights are clipped to PMMG_WGTVAL_HUGEINT beyond exp(PMMG_WGTVAL_NEXP))
  *
  */
-#define PMMG_NBADJA_GRPS   30
+#define PMMG_WGTVAL_NEXP   14
 
 /**
- * \struct PMMG_hgrp
+ * \struct PMMG_grpAdja
  *
- * \brief Cell of the hastable HGrp
+ * \brief Contribution of an interface face to the edge between a group and an
+ * adjacent group in the group graph.
  *
  */
 typedef struct {
-  idx_t   adj; /*!< item to add */
+  idx_t   grp; /*!< local index of the group */
+  idx_t   adj; /*!< global index of the adjacent group */
   idx_t   wgt; /*!< Edge weight */
-  int     nxt; /*!< Next element of the linked list */
-} PMMG_hgrp;
+} PMMG_grpAdja;
+
+/** Number of bits per coordinate of the space-filling curve indices */
+#define PMMG_SFC_NBITS 21
+
+/**
+ * \struct PMMG_sfcItem
+ *
+ * \brief Element and its index along the space-filling curve.
+ *
+ */
+typedef struct {
+  uint64_t key; /*!< index along the curve */
+  int      idx; /*!< element index (from 0) */
+} PMMG_sfcItem;
 
 /**
- * \struct PMMG_HGrp
+ * \struct PMMG_partRequest
  *
- * \brief Hash table to store the list of adjacents groups to a given group.
+ * \brief Group partition computed in background by the partitioner processes.
  *
  */
 typedef struct {
-  int          siz,max,nxt;
-  PMMG_hgrp    *item;
-} PMMG_HGrp;
+  MPI_Request request;  /*!< request of the scatter of the partition */
+  idx_t       *vtxdist; /*!< range of groups local to each processor */
+  idx_t       *counts;  /*!< number of groups of each processor */
+  idx_t       *part_seq;/*!< partition of all the groups (on root only) */
+  idx_t       nproc;    /*!< number of partitions asked */
+  int         root;     /*!< process that scatters the partition */
+} PMMG_partRequest;
 
 int PMMG_checkAndReset_grps_contiguity( PMMG_pParMesh parmesh );
 int PMMG_check_grps_contiguity( PMMG_pParMesh parmesh );
 int PMMG_graph_meshElts2metis(PMMG_pParMesh,MMG5_pMesh,MMG5_pSol,idx_t**,idx_t**,idx_t**,idx_t*);
 int PMMG_part_meshElts2metis( PMMG_pParMesh,idx_t*,idx_t);
+int PMMG_part_meshElts2sfc( PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_graph_parmeshGrps2parmetis(PMMG_pParMesh,idx_t**,idx_t**,idx_t**,idx_t*,
                                     idx_t**,idx_t**,idx_t*,idx_t*,idx_t*,idx_t,
                                     real_t**,real_t**);
 int PMMG_part_parmeshGrps2parmetis(PMMG_pParMesh,idx_t*,idx_t);
 int PMMG_part_parmeshGrps2metis(PMMG_pParMesh,idx_t*,idx_t);
+int PMMG_part_parmeshGrps2metis_start(PMMG_pParMesh,idx_t*,idx_t,PMMG_partRequest*);
+int PMMG_part_parmeshGrps2metis_wait(PMMG_pParMesh,idx_t*,PMMG_partRequest*,int);
 int PMMG_correct_parmeshGrps2parmetis( PMMG_pParMesh parmesh, idx_t *vtxdist,
                                        idx_t* mypart,idx_t nproc );
 
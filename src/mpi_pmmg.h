@@ -47,6 +47,9 @@
 #define MPI_TRANSFER_GRP_TAG            8000
 #define MPI_COMMUNICATORS_REF_TAG       9000
 #define MPI_ANALYS_TAG                 10000
+#define MPI_FACEKEYS_TAG               11000
+#define MPI_FACEKEYS_REPLY_TAG         11001
+#define MPI_COMPLETENODECOMM_TAG       12000
 
 
 #define MPI_CHECK(func_call,on_failure) do {                            \
@@ -54,6 +54,7 @@ int PMMG_mpisizeof_meshSizes ( PMMG_pGrp grp ) {
   idx += sizeof(int); // mesh->ne
   idx += sizeof(int); // mesh->xt
   idx += sizeof(int); // mesh->nsols
+  idx += sizeof(int); // precision of the solution values
 
   /** Met size */
   idx += sizeof(int); // met && met->m
@@ -222,6 +223,7 @@ int PMMG_mpisizeof_infos ( MMG5_Info *info ) {
 
 /**
  * \param grp pointer toward a PMMG group
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  *
  * \return the computed size
  *
@@ -229,7 +231,7 @@ int PMMG_mpisizeof_infos ( MMG5_Info *info ) {
  *
  */
 static
-int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
+int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp,int prec ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
@@ -317,16 +319,16 @@ int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
 
   /** Pack metric */
   if ( met && met->m ) {
-    idx += met->size*met->np*sizeof(double); // met->m;
+    idx += met->size*met->np*PMMG_SOLPREC_SIZEOF(prec); // met->m;
   }
 
   /** Pack ls */
   if ( ls && ls->m ) {
-    idx += ls->size*ls->np*sizeof(double); // ls->m;
+    idx += ls->size*ls->np*PMMG_SOLPREC_SIZEOF(prec); // ls->m;
   }
   /** Pack disp */
   if ( disp && disp->m ) {
-    idx += disp->size*disp->np*sizeof(double); // disp->m;
+    idx += disp->size*disp->np*PMMG_SOLPREC_SIZEOF(prec); // disp->m;
   }
 
   /** Pack Fields  */
@@ -334,7 +336,7 @@ int PMMG_mpisizeof_meshArrays ( PMMG_pGrp grp ) {
     assert ( grp->field );
     for ( is=0; is<mesh->nsols; ++is ) {
       psl = &grp->field[is];
-      idx += psl->size*psl->np*sizeof(double); // psl->m;
+      idx += psl->size*psl->np*PMMG_SOLPREC_SIZEOF(prec); // psl->m;
     }
   }
 
@@ -421,6 +423,7 @@ int PMMG_mpisizeof_extnodecomm ( PMMG_pParMesh parmesh ) {
 
 /**
  * \param grp pointer toward a PMMG_Grp structure.
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \return the size (in char) of the packed group.
  *
  * \warning the mesh prisms are not treated.
@@ -428,7 +431,7 @@ int PMMG_mpisizeof_extnodecomm ( PMMG_pParMesh parmesh ) {
  * Compute the size of the compressed group.
  *
  */
-int PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
+int PMMG_mpisizeof_grp ( PMMG_pGrp grp,int prec ) {
   const MMG5_pMesh mesh = grp->mesh;
 
   int idx;
@@ -448,7 +451,7 @@ int PMMG_mpisizeof_grp ( PMMG_pGrp grp ) {
   idx += PMMG_mpisizeof_infos ( &mesh->info );
 
   /** Size of compressed points / tetra / metric / fields... */
-  idx += PMMG_mpisizeof_meshArrays ( grp );
+  idx += PMMG_mpisizeof_meshArrays ( grp,prec );
 
   /** Size of compressed internal group communicators */
   idx += PMMG_mpisizeof_grpintcomm ( grp );
@@ -489,7 +492,7 @@ int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh ) {
   idx += PMMG_mpisizeof_infos ( &parmesh->listgrp[0].mesh->info );
 
   /** Size of compressed points / tetra / metric / fields... */
-  idx += PMMG_mpisizeof_meshArrays ( grp );
+  idx += PMMG_mpisizeof_meshArrays ( grp,PMMG_SOLPREC_double );
 
   /** Size of intvalues array */
   idx += PMMG_mpisizeof_nodeintvalues ( parmesh );
@@ -502,6 +505,7 @@ int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh ) {
 
 /**
  * \param grp pointer toward a PMMG_Grp structure.
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \param buffer pointer toward the buffer in which we pack the group
  *
  * \warning the mesh prisms are not treated.
@@ -511,7 +515,7 @@ int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh ) {
  *
  */
 static
-void PMMG_mpipack_meshSizes ( PMMG_pGrp grp,char **buffer ) {
+void PMMG_mpipack_meshSizes ( PMMG_pGrp grp,int prec,char **buffer ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
@@ -529,6 +533,7 @@ void PMMG_mpipack_meshSizes ( PMMG_pGrp grp,char **buffer ) {
   *( (int *) tmp) = mesh->ne; tmp += sizeof(int);
   *( (int *) tmp) = mesh->xt; tmp += sizeof(int);
   *( (int *) tmp) = mesh->nsols; tmp += sizeof(int);
+  *( (int *) tmp) = prec; tmp += sizeof(int);
 
   /** Metric info and sizes */
   *( (int *) tmp) = ( (met && met->m) ? 1 : 0 );  tmp += sizeof(int);
@@ -798,22 +803,58 @@ void PMMG_mpipack_infos ( MMG5_Info *info,char **buffer ) {
   *buffer = tmp;
 }
 
+/**
+ * \param sol pointer toward a solution structure.
+ * \param prec precision of the packed values (see PMMG_SOLPREC_*)
+ * \param buffer pointer toward the buffer in which we pack the solution
+ *
+ * Pack the values of the solution in double or single precision and shift the
+ * buffer pointer at the end of the written area.
+ *
+ */
+static
+void PMMG_mpipack_solValues ( MMG5_pSol sol,int prec,char **buffer ) {
+  int   k,i;
+  char  *tmp;
+
+  tmp = *buffer;
+
+  if ( prec == PMMG_SOLPREC_float ) {
+    for ( k=1; k<=sol->np; ++k ) {
+      for ( i=0; i<sol->size; ++i ) {
+        *( (float *) tmp) = (float)sol->m[sol->size*k + i]; tmp += sizeof(float);
+      }
+    }
+  }
+  else {
+    for ( k=1; k<=sol->np; ++k ) {
+      for ( i=0; i<sol->size; ++i ) {
+        *( (double *) tmp) = sol->m[sol->size*k + i]; tmp += sizeof(double);
+      }
+    }
+  }
+
+  *buffer = tmp;
+}
+
 /**
  * \param grp pointer toward a PMMG_Grp structure.
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \param buffer pointer toward the buffer in which we pack the group
  *
- * Pack the mesh and solutions (metric, ls, disp and fields) arrays.
+ * Pack the mesh and solutions (metric, ls, disp and fields) arrays. Point
+ * coordinates are always packed in double precision.
  *
  */
 static
-void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
+void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,int prec,char **buffer ) {
   const MMG5_pMesh mesh = grp->mesh;
   const MMG5_pSol  met  = grp->met;
   const MMG5_pSol  ls   = grp->ls;
   const MMG5_pSol  disp = grp->disp;
   MMG5_pSol        psl;
 
-  int   k,i,is;
+  int   k,is;
   char  *tmp;
 
   tmp = *buffer;
@@ -905,40 +946,24 @@ void PMMG_mpipack_meshArrays ( PMMG_pGrp grp,char **buffer ) {
 
   /** Pack metric */
   if ( met && met->m ) {
-    for ( k=1; k<=met->np; ++k ) {
-      for ( i=0; i<met->size; ++i ) {
-        *( (double *) tmp) = met->m[met->size*k + i]; tmp += sizeof(double);
-      }
-    }
+    PMMG_mpipack_solValues(met,prec,&tmp);
   }
 
   /** Pack ls */
   if ( ls && ls->m ) {
-    for ( k=1; k<=ls->np; ++k ) {
-      for ( i=0; i<ls->size; ++i ) {
-        *( (double *) tmp) = ls->m[ls->size*k + i]; tmp += sizeof(double);
-      }
-    }
+    PMMG_mpipack_solValues(ls,prec,&tmp);
   }
 
   /** Pack disp */
   if ( disp && disp->m ) {
-    for ( k=1; k<=disp->np; ++k ) {
-      for ( i=0; i<disp->size; ++i ) {
-        *( (double *) tmp) = disp->m[disp->size*k + i]; tmp += sizeof(double);
-      }
-    }
+    PMMG_mpipack_solValues(disp,prec,&tmp);
   }
 
   /** Pack Fields */
   if ( mesh->nsols ) {
     for ( is=0; is<mesh->nsols; ++is ) {
       psl = &grp->field[is];
-      for ( k=1; k<=psl->np; ++k ) {
-        for ( i=0; i<psl->size; ++i ) {
-          *( (double *) tmp) = psl->m[psl->size*k + i]; tmp += sizeof(double);
-        }
-      }
+      PMMG_mpipack_solValues(psl,prec,&tmp);
     }
   }
 
@@ -1049,6 +1074,7 @@ void PMMG_mpipack_extnodecomm ( PMMG_pParMesh parmesh,char **buffer ) {
 
 /**
  * \param grp pointer toward a PMMG_Grp structure.
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \param buffer pointer toward the buffer in which we pack the group
  *
  * \return 1 if success, 0 if fail
@@ -1064,7 +1090,7 @@ void PMMG_mpipack_extnodecomm ( PMMG_pParMesh parmesh,char **buffer ) {
  * pointer at the end of the written area.
  *
  */
-int PMMG_mpipack_grp ( PMMG_pGrp grp,char **buffer ) {
+int PMMG_mpipack_grp ( PMMG_pGrp grp,int prec,char **buffer ) {
   int   ier;
   char  *tmp;
 
@@ -1084,11 +1110,11 @@ int PMMG_mpipack_grp ( PMMG_pGrp grp,char **buffer ) {
 
   *buffer = tmp;
 
-  PMMG_mpipack_meshSizes(grp,buffer);
+  PMMG_mpipack_meshSizes(grp,prec,buffer);
 
   PMMG_mpipack_infos(&(grp->mesh->info),buffer);
 
-  PMMG_mpipack_meshArrays(grp,buffer);
+  PMMG_mpipack_meshArrays(grp,prec,buffer);
 
   PMMG_mpipack_grpintcomm(grp,buffer);
 
@@ -1139,11 +1165,11 @@ int PMMG_mpipack_parmesh ( PMMG_pParMesh parmesh ,char **buffer ) {
 
   *buffer = tmp;
 
-  PMMG_mpipack_meshSizes(grp,buffer);
+  PMMG_mpipack_meshSizes(grp,PMMG_SOLPREC_double,buffer);
 
   PMMG_mpipack_infos(&(grp->mesh->info),buffer);
 
-  PMMG_mpipack_meshArrays(grp,buffer);
+  PMMG_mpipack_meshArrays(grp,PMMG_SOLPREC_double,buffer);
 
   PMMG_mpipack_nodeintvalues(parmesh,buffer);
 
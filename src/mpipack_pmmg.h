@@ -34,9 +34,9 @@
  */
 #include "libmmgtypes.h"
 
-int PMMG_mpisizeof_grp ( PMMG_pGrp grp );
+int PMMG_mpisizeof_grp ( PMMG_pGrp grp,int prec );
 int PMMG_mpisizeof_parmesh ( PMMG_pParMesh parmesh );
-int PMMG_mpipack_grp ( PMMG_pGrp grp,char **buffer );
+int PMMG_mpipack_grp ( PMMG_pGrp grp,int prec,char **buffer );
 int PMMG_mpipack_parmesh ( PMMG_pParMesh parmesh,char **buffer );
 
 #endif
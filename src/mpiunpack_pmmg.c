@@ -54,6 +54,7 @@
  * \param nsols number of solution fields
  * \param ier_field 1 if the sol fields  are allocated, 0 otherwise
  * \param fieldsize size of the solution fields.
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \return 0 if fail, 1 if success.
  *
  * \warning the mesh prisms are not treated.
@@ -72,7 +73,7 @@ int PMMG_mpiunpack_meshSizes ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,
                                 int *npls,int *ier_ls,int *lssize,
                                 int *npdisp,int *ier_disp,int *dispsize,
                                 int *nsols,int* ier_field,
-                                int *fieldsize ) {
+                                int *fieldsize,int *prec ) {
   PMMG_pGrp  const grp = &listgrp[igrp];
   MMG5_pMesh mesh;
   MMG5_pSol  met,ls,disp;
@@ -115,6 +116,9 @@ int PMMG_mpiunpack_meshSizes ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,
   /** Number of fields */
   (*nsols) = *( (int *) *buffer); *buffer += sizeof(int);
 
+  /** Precision of the solution values */
+  (*prec) = *( (int *) *buffer); *buffer += sizeof(int);
+
   /** Metric info and sizes */
   ismet     = *( (int *) *buffer); *buffer += sizeof(int);
 
@@ -569,6 +573,40 @@ void PMMG_mpiunpack_infos ( MMG5_Info *info,char **buffer,int *ier,int ier_mesh
   }
 }
 
+/**
+ * \param m array of the solution values
+ * \param np number of points of the solution
+ * \param size number of values per point
+ * \param prec precision of the packed values (see PMMG_SOLPREC_*)
+ * \param buffer pointer toward the buffer from which we unpack the solution
+ *
+ * Unpack the values of a solution packed in double or single precision and
+ * shift the buffer pointer toward the end of the readed area.
+ *
+ */
+static
+void PMMG_mpiunpack_solValues ( double *m,int np,int size,int prec,
+                                char **buffer ) {
+  int k,i;
+
+  if ( prec == PMMG_SOLPREC_float ) {
+    for ( k=1; k<=np; ++k ) {
+      for ( i=0; i<size; ++i ) {
+        m[size*k + i] = (double)*( (float *) *buffer);
+        *buffer += sizeof(float);
+      }
+    }
+  }
+  else {
+    for ( k=1; k<=np; ++k ) {
+      for ( i=0; i<size; ++i ) {
+        m[size*k + i] = *( (double *) *buffer);
+        *buffer += sizeof(double);
+      }
+    }
+  }
+}
+
 /**
  * \param listgrp pointer toward a PMMG_Grp structure array.
  * \param igrp index of the group to handle.
@@ -590,6 +628,7 @@ void PMMG_mpiunpack_infos ( MMG5_Info *info,char **buffer,int *ier,int ier_mesh
  * \param nsols number of solution fields
  * \param ier_field 1 if the sol fields  are allocated, 0 otherwise
  * \param fieldsize size of the solution fields (array allocated inside this function)
+ * \param prec precision of the packed solution values (see PMMG_SOLPREC_*)
  * \return 0 if fail, 1 if success.
  *
  * \warning the mesh prisms are not treated.
@@ -606,7 +645,7 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
                                 int npls,int ier_ls,int lssize,
                                 int npdisp,int ier_disp,int dispsize,
                                 int nsols,int ier_field,
-                                int *fieldsize ) {
+                                int *fieldsize,int prec ) {
   const PMMG_pGrp  grp   = &listgrp[igrp];
   const MMG5_pMesh mesh  = grp->mesh;
   const MMG5_pSol  met   = grp->met;
@@ -616,7 +655,7 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
   int const        nprocs = parmesh->nprocs;
   int              ier = 1;
 
-  int   k,i,is;
+  int   k,is;
 
   if ( !mesh ) ier = 0;
 
@@ -782,48 +821,33 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
   /** Unpack metric */
   if( npmet ) {/* only if the metrics size is non null, i.e. not default metrics */
     if ( ier_met ) {
-      for ( k=1; k<=np; ++k ) {
-        for ( i=0; i<metsize; ++i ) {
-          met->m[metsize*k + i] = *( (double *) *buffer);
-          *buffer += sizeof(double);
-        }
-      }
+      PMMG_mpiunpack_solValues(met->m,np,metsize,prec,buffer);
     }
     else {
       /* The metric array can't be allocated */
-      *buffer += np*metsize*sizeof(double);
+      *buffer += np*metsize*PMMG_SOLPREC_SIZEOF(prec);
     }
   }
 
   /** Unpack ls */
   if( npls ) {/* only if the ls size is non null */
     if ( ier_ls ) {
-      for ( k=1; k<=np; ++k ) {
-        for ( i=0; i<lssize; ++i ) {
-          ls->m[lssize*k + i] = *( (double *) *buffer);
-          *buffer += sizeof(double);
-        }
-      }
+      PMMG_mpiunpack_solValues(ls->m,np,lssize,prec,buffer);
     }
     else {
       /* The ls array can't be allocated */
-      *buffer += np*lssize*sizeof(double);
+      *buffer += np*lssize*PMMG_SOLPREC_SIZEOF(prec);
     }
   }
 
   /** Unpack metric */
   if( npdisp ) {/* only if the displacement size is non null */
     if ( ier_disp ) {
-      for ( k=1; k<=np; ++k ) {
-        for ( i=0; i<dispsize; ++i ) {
-          disp->m[dispsize*k + i] = *( (double *) *buffer);
-          *buffer += sizeof(double);
-        }
-      }
+      PMMG_mpiunpack_solValues(disp->m,np,dispsize,prec,buffer);
     }
     else {
       /* The metric array can't be allocated */
-      *buffer += np*dispsize*sizeof(double);
+      *buffer += np*dispsize*PMMG_SOLPREC_SIZEOF(prec);
     }
   }
 
@@ -831,17 +855,12 @@ int PMMG_mpiunpack_meshArrays ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp
     if ( ier_field ) {
       for ( is=0; is<nsols; ++is ) {
         psl = &grp->field[is];
-        for ( k=1; k<=np; ++k ) {
-          for ( i=0; i<psl->size; ++i ) {
-            psl->m[psl->size*k + i] = *( (double *) *buffer);
-            *buffer += sizeof(double);
-          }
-        }
+        PMMG_mpiunpack_solValues(psl->m,np,psl->size,prec,buffer);
       }
     }
     else {
       for ( is=0; is<nsols; ++is ) {
-        *buffer += np*fieldsize[is]*sizeof(double);
+        *buffer += np*fieldsize[is]*PMMG_SOLPREC_SIZEOF(prec);
       }
     }
   }
@@ -1042,7 +1061,7 @@ int PMMG_mpiunpack_grp ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,char *
   int        ier,ier_mesh,ier_met,ier_ls,ier_disp,ier_field;
   int        np,npmet,npdisp,npls,xp,ne,xt;
   int        metsize,lssize,dispsize,fieldsize[MMG5_NSOLS_MAX];
-  int        nsols,used;
+  int        nsols,used,prec;
 
   ier = 1;
 
@@ -1055,7 +1074,7 @@ int PMMG_mpiunpack_grp ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,char *
   ier = PMMG_mpiunpack_meshSizes ( parmesh,listgrp,igrp,buffer,&np,&ne,&xp,&xt,
                              &ier_mesh,&npmet,&ier_met,&metsize,
                              &npls,&ier_ls,&lssize,&npdisp,&ier_disp,&dispsize,
-                             &nsols,&ier_field,fieldsize );
+                             &nsols,&ier_field,fieldsize,&prec );
 
   PMMG_copy_filenames ( parmesh,grp,&ier,ier_mesh,ier_ls,ier_disp,nsols,ier_field );
 
@@ -1063,7 +1082,7 @@ int PMMG_mpiunpack_grp ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,char *
 
   ier = PMMG_mpiunpack_meshArrays( parmesh,listgrp,igrp,buffer,np,ne,xp,xt,ier_mesh,
                              npmet,ier_met,metsize,npls,ier_ls,lssize,npdisp,
-                             ier_disp,dispsize,nsols,ier_field,fieldsize );
+                             ier_disp,dispsize,nsols,ier_field,fieldsize,prec );
 
 
   PMMG_mpiunpack_grpintcomm ( parmesh,grp,buffer,&ier);
@@ -1102,7 +1121,7 @@ int PMMG_mpiunpack_parmesh ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,
   int        ier,ier_mesh,ier_met,ier_ls,ier_disp,ier_field;
   int        np,npmet,npdisp,npls,xp,ne,xt;
   int        metsize,lssize,dispsize,fieldsize[MMG5_NSOLS_MAX];
-  int        nsols,used;
+  int        nsols,used,prec;
 
   ier = 1;
 
@@ -1115,13 +1134,13 @@ int PMMG_mpiunpack_parmesh ( PMMG_pParMesh parmesh,PMMG_pGrp listgrp,int igrp,
   ier = PMMG_mpiunpack_meshSizes ( parmesh,listgrp,igrp,buffer,&np,&ne,&xp,&xt,
                              &ier_mesh,&npmet,&ier_met,&metsize,
                              &npls,&ier_ls,&lssize,&npdisp,&ier_disp,&dispsize,
-                             &nsols,&ier_field,fieldsize );
+                             &nsols,&ier_field,fieldsize,&prec );
 
   PMMG_mpiunpack_infos(&(grp->mesh->info),buffer,&ier,ier_mesh);
 
   ier = PMMG_mpiunpack_meshArrays( parmesh,listgrp,igrp,buffer,np,ne,xp,xt,ier_mesh,
                              npmet,ier_met,metsize,npls,ier_ls,lssize,npdisp,
-                             ier_disp,dispsize,nsols,ier_field,fieldsize );
+                             ier_disp,dispsize,nsols,ier_field,fieldsize,prec );
 
 
   PMMG_mpiunpack_nodeintvalues ( parmesh,int_node_comm,buffer,&ier);
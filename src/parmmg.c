@@ -63,7 +63,7 @@ int main( int argc, char *argv[] )
   PMMG_pGrp     grp;
   int           rank;
   int           ier,iermesh,iresult,ierSave,fmtin,fmtout;
-  int8_t        tim,distributedInput;
+  int8_t        tim,distributedInput,parallelInput;
   char          stim[32],*ptr;
 
   // Shared memory communicator: processes that are on the same node, sharing
@@ -145,18 +145,71 @@ int main( int argc, char *argv[] )
   ptr   = MMG5_Get_filenameExt(parmesh->meshin);
 
   fmtin = MMG5_Get_format(ptr,MMG5_FMT_MeditASCII);
+  if ( ptr && !strcmp(ptr,".h5") ) {
+    fmtin = PMMG_FMT_HDF5;
+  }
 
   /* Compute default output format */
   ptr = MMG5_Get_filenameExt(parmesh->meshout);
 
   /* Format from output mesh name */
   fmtout = MMG5_Get_format(ptr,fmtin);
+  if ( ptr && !strcmp(ptr,".h5") ) {
+    fmtout = PMMG_FMT_HDF5;
+  }
+
+  if ( parmesh->chkptin ) {
+    /* Restart from a checkpoint: the input mesh is not read */
+    fmtin = PMMG_FMT_Checkpoint;
+  }
 
   distributedInput = 0;
+  parallelInput    = 0;
 
   switch ( fmtin ) {
   case ( MMG5_FMT_MeditASCII ): case ( MMG5_FMT_MeditBinary ):
 
+    iermesh = -1;
+    if ( parmesh->info.parallelInput && fmtin == MMG5_FMT_MeditASCII &&
+         grp->mesh->info.lag < 0 && !grp->mesh->info.iso &&
+         !( parmesh->fieldin && *parmesh->fieldin ) ) {
+      /* Centralized mesh (and metric) read on all the processes: if the file
+       * content is not supported (-1), it is read on the root process */
+      iermesh = PMMG_loadMesh_parallel(parmesh,parmesh->meshin,parmesh->metin);
+      if ( iermesh == 1 ) {
+        distributedInput = 1;
+        parallelInput    = 1;
+      }
+      else if ( iermesh == -1 && rank == parmesh->info.root &&
+                parmesh->info.imprim > PMMG_VERB_VERSION ) {
+        fprintf(stdout,"  %%%% %s CAN'T BE READ IN PARALLEL: READING ON RANK %d.\n",
+                parmesh->meshin,parmesh->info.root);
+      }
+    }
+
+    if ( parallelInput ) {
+      /* Centralized input: same output format as for a mesh loaded on root */
+      if ( parmesh->info.fmtout == PMMG_FMT_Distributed ) {
+        if ( fmtout == MMG5_FMT_MeditASCII ) {
+          parmesh->info.fmtout = PMMG_FMT_DistributedMeditASCII;
+        }
+        else if ( fmtout == MMG5_FMT_MeditBinary ) {
+          parmesh->info.fmtout = PMMG_FMT_DistributedMeditBinary;
+        }
+        else {
+          parmesh->info.fmtout = fmtout;
+        }
+      }
+      else if ( parmesh->info.fmtout != PMMG_UNSET ){
+        parmesh->info.fmtout = fmtout;
+      }
+      break;
+    }
+    else if ( iermesh == 0 ) {
+      ier = 0;
+      goto check_mesh_loading;
+    }
+
     // Algiane: Dirty (to be discussed, I don't have a clean solution)
     iermesh = PMMG_loadMesh_centralized(parmesh,parmesh->meshin);
     MPI_Bcast( &iermesh,     1, MPI_INT, parmesh->info.root, parmesh->comm );
@@ -241,10 +294,8 @@ int main( int argc, char *argv[] )
         iermesh = ( PMMG_loadSol_centralized( parmesh, NULL ) );
       }
       else {
-        printf("  ## Error: Distributed input not yet implemented for displacement.\n");
-        //int ier_loc = PMMG_loadSol_distributed( parmesh, NULL );
-        //MPI_Allreduce( &ier_loc, &iermesh, 1, MPI_INT, MPI_MIN, parmesh->comm);
-        iermesh = 0;
+        int ier_loc = PMMG_loadSol_distributed( parmesh, NULL );
+        MPI_Allreduce( &ier_loc, &iermesh, 1, MPI_INT, MPI_MIN, parmesh->comm);
       }
       if ( iermesh < 1 ) {
         if ( rank == parmesh->info.root ) {
@@ -295,10 +346,8 @@ int main( int argc, char *argv[] )
         iermesh = PMMG_loadAllSols_centralized(parmesh,parmesh->fieldin);
       }
       else {
-        //int ier_loc = PMMG_loadAllSols_distributed(parmesh,parmesh->fieldin);
-        //MPI_Allreduce( &ier_loc, &iermesh, 1, MPI_INT, MPI_MIN, parmesh->comm);
-        printf("  ## Error: Distributed fields input not yet implemented.\n");
-        iermesh = 0;
+        int ier_loc = PMMG_loadAllSols_distributed(parmesh,parmesh->fieldin);
+        MPI_Allreduce( &ier_loc, &iermesh, 1, MPI_INT, MPI_MIN, parmesh->comm);
       }
       if ( iermesh < 1 ) {
         ier = 0;
@@ -307,6 +356,60 @@ int main( int argc, char *argv[] )
     }
     break;
 
+  case ( PMMG_FMT_HDF5 ):
+    /* Each process reads a block of tetrahedra: metric and fields are stored
+     * in the same file */
+    iermesh = PMMG_loadMesh_hdf5(parmesh,parmesh->meshin);
+
+    if ( 1 != iermesh ) {
+      if ( rank == parmesh->info.root ) {
+        fprintf(stderr,"  ** UNABLE TO READ INPUT FILE %s.\n",parmesh->meshin);
+      }
+      ier = 0;
+      goto check_mesh_loading;
+    }
+    distributedInput = 1;
+
+    if ( parmesh->info.fmtout == PMMG_FMT_Distributed ) {
+      /* Force distribution */
+      if ( fmtout == MMG5_FMT_MeditASCII ) {
+        parmesh->info.fmtout = PMMG_FMT_DistributedMeditASCII;
+      }
+      else if ( fmtout == MMG5_FMT_MeditBinary ) {
+        parmesh->info.fmtout = PMMG_FMT_DistributedMeditBinary;
+      }
+      else {
+        parmesh->info.fmtout = fmtout;
+      }
+    }
+    else if ( parmesh->info.fmtout != PMMG_UNSET ) {
+      parmesh->info.fmtout = fmtout;
+    }
+    break;
+
+  case ( PMMG_FMT_Checkpoint ):
+    /* Distributed groups, metrics and fields are stored in the checkpoint */
+    iermesh = PMMG_loadCheckpoint(parmesh,parmesh->chkptin);
+    if ( 1 != iermesh ) {
+      ier = 0;
+      goto check_mesh_loading;
+    }
+    distributedInput = 1;
+
+    if ( parmesh->info.fmtout == PMMG_FMT_Centralized ) {
+      parmesh->info.fmtout = fmtout;
+    }
+    else if ( fmtout == MMG5_FMT_MeditASCII ) {
+      parmesh->info.fmtout = PMMG_FMT_DistributedMeditASCII;
+    }
+    else if ( fmtout == MMG5_FMT_MeditBinary ) {
+      parmesh->info.fmtout = PMMG_FMT_DistributedMeditBinary;
+    }
+    else if ( parmesh->info.fmtout != PMMG_UNSET ) {
+      parmesh->info.fmtout = fmtout;
+    }
+    break;
+
   default:
     if ( rank == parmesh->info.root ) {
       fprintf(stderr,"  ** I/O AT FORMAT %s NOT IMPLEMENTED.\n",MMG5_Get_formatName(fmtin) );
@@ -315,7 +418,8 @@ int main( int argc, char *argv[] )
     goto check_mesh_loading;
   }
 
-  if ( !PMMG_parsop(parmesh) ) {
+  /* Local parameters of a checkpoint are stored in its groups */
+  if ( fmtin != PMMG_FMT_Checkpoint && !PMMG_parsop(parmesh) ) {
     ier = 0;
     goto check_mesh_loading;
   }
@@ -332,7 +436,7 @@ check_mesh_loading:
     PMMG_RETURN_AND_FREE( parmesh, PMMG_LOWFAILURE );
 
   /** Main call */
-  if ( parmesh->listgrp[0].mesh->mark ) {
+  if ( parmesh->ngrp && parmesh->listgrp[0].mesh->mark ) {
     /* Save a local parameters file containing the default parameters */
     printf("  ## Error: default parameter file saving not yet implemented.\n");
     ier = 2;//PMMG_defaultOption(grp->mesh,grp->met);
@@ -384,6 +488,13 @@ check_mesh_loading:
     case ( MMG5_FMT_VtkPvtu ):
       PMMG_savePvtuMesh(parmesh,parmesh->meshout);
       break;
+    case ( PMMG_FMT_HDF5 ):
+      /* Collective save of the mesh, metric and fields */
+      ierSave = PMMG_saveMesh_hdf5(parmesh,parmesh->meshout);
+      if ( 1 != ierSave ) {
+        PMMG_RETURN_AND_FREE(parmesh,PMMG_STRONGFAILURE);
+      }
+      break;
     case ( MMG5_FMT_GmshASCII ): case ( MMG5_FMT_GmshBinary ):
     case ( MMG5_FMT_VtkVtu ):
     case ( MMG5_FMT_VtkVtk ):
@@ -410,9 +521,7 @@ check_mesh_loading:
         }
       }
       if ( ierSave &&  grp->field ) {
-        fprintf(stderr,"  ## Error: %s: PMMG_saveAllSols_distributed function"
-                " not yet implemented."
-                " Ignored.\n",__func__);
+        ierSave = PMMG_saveAllSols_distributed(parmesh,parmesh->fieldout);
       }
       MPI_Allreduce( &ierSave, &ier, 1, MPI_INT, MPI_MIN, parmesh->comm );
       if ( !ier ) {
@@ -176,6 +176,42 @@ extern "C" {
  */
 #define PMMG_GRPSPL_MMG_TARGET 2
 
+/**
+ *
+ * Maximal number of remeshing iterations added when some groups have reached
+ * their memory capacity during the last iteration
+ *
+ */
+#define PMMG_REMESH_NRETRY_MAX 2
+
+/**
+ * \param parmesh pointer toward the parmesh structure
+ *
+ * Number of iterations of the current call: user number of iterations plus the
+ * iterations added when some groups have reached their memory capacity.
+ *
+ */
+#define PMMG_niter_eff(parmesh) ((parmesh)->niter + (parmesh)->nretry)
+
+/**
+ *
+ * Margin applied to the metric-based estimation of the adapted mesh sizes
+ * when preallocating the group meshes, and minimal growth allowed with respect
+ * to the current mesh sizes
+ *
+ */
+#define PMMG_MEMEST_MARGIN 1.5
+#define PMMG_MEMEST_MIN    1.2
+
+/**
+ *
+ * Volume of the regular tetrahedron of unit edge length (sqrt(2)/12) and
+ * ratio between the number of tetra and the number of vertices of a mesh
+ *
+ */
+#define PMMG_MEMEST_UNITVOL 0.117851130197757920
+#define PMMG_MEMEST_NE2NP   6.
+
 /**
  *
  * Use custom partitioning saved in the reference field (1=yes, 0=no)
@@ -202,6 +238,8 @@ enum PMMG_Format {
   PMMG_FMT_Distributed,                       /*!< Distributed Setters/Getters */
   PMMG_FMT_DistributedMeditASCII,             /*!< Distributed ASCII Medit (.mesh) */
   PMMG_FMT_DistributedMeditBinary,            /*!< Distributed Binary Medit (.meshb) */
+  PMMG_FMT_HDF5,                              /*!< Parallel HDF5 with XDMF descriptor (.h5) */
+  PMMG_FMT_Checkpoint,                        /*!< ParMmg checkpoint (restart) */
   PMMG_FMT_Unknown,                           /*!< Unrecognized */
 };
 
@@ -211,6 +249,42 @@ static const int PMMG_REMESHER_TARGET_MESH_SIZE = -30000000;
 /**< Subgroups target size for a fast remeshing step */
 static const int PMMG_REMESHER_NGRPS_MAX = 100;
 
+/**
+ * \def PMMG_SOLPREC_SIZEOF
+ *
+ * Size of a solution value packed with the precision \a prec (see
+ * PMMG_SOLPREC_*)
+ *
+ */
+#define PMMG_SOLPREC_SIZEOF(prec) \
+  ( ((prec) == PMMG_SOLPREC_float) ? sizeof(float) : sizeof(double) )
+
+/**
+ * \def PMMG_MARK_flag, PMMG_MARK_tmp, PMMG_MARK_s
+ *
+ * Point marker fields stored in a \ref PMMG_ptMarkers structure
+ *
+ */
+#define PMMG_MARK_flag (1<<0)
+#define PMMG_MARK_tmp  (1<<1)
+#define PMMG_MARK_s    (1<<2)
+
+/**
+ * \struct PMMG_ptMarkers
+ *
+ * \brief Compact arrays (indexed from 1 to np) replacing the flag, tmp and s
+ * fields of the Mmg points in the ParMmg traversals that only need a marker:
+ * they stream a contiguous integer array instead of the whole point structure
+ * and leave the Mmg points untouched.
+ *
+ */
+typedef struct {
+  int np;    /*!< number of points */
+  int *flag; /*!< point flags */
+  int *tmp;  /*!< point temporary integers */
+  int *s;    /*!< point integer markers */
+} PMMG_ptMarkers;
+
 /**< Number of metis node per mmg mesh... to test*/
 static const int PMMG_RATIO_MMG_METIS = -100;
 
@@ -430,13 +504,14 @@ int PMMG_Set_name(PMMG_pParMesh,char **,const char* name,const char* defname);
 int PMMG_check_inputData ( PMMG_pParMesh parmesh );
 int PMMG_preprocessMesh( PMMG_pParMesh parmesh );
 int PMMG_preprocessMesh_distributed( PMMG_pParMesh parmesh );
+int PMMG_preprocessMesh_persistent( PMMG_pParMesh parmesh );
 int PMMG_parsar( int argc, char *argv[], PMMG_pParMesh parmesh );
 void PMMG_setfunc( PMMG_pParMesh parmesh );
 
 /* Mesh analysis */
 void PMMG_Analys_Init_SurfNormIndex( MMG5_pTetra pt );
 int PMMG_Analys_Get_SurfNormalIndex( MMG5_pTetra pt,int ifac,int i );
-int PMMG_boulernm(PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_Hash *hash,int start,int ip,int *ng,int *nr);
+int PMMG_boulernm(PMMG_pParMesh parmesh,MMG5_pMesh mesh,int start,int ip,int8_t skipPar,int *ng,int *nr);
 int PMMG_boulen(PMMG_pParMesh parmesh,MMG5_pMesh mesh,int start,int ip,int iface,double t[3]);
 int PMMG_analys_tria(PMMG_pParMesh parmesh,MMG5_pMesh mesh);
 int PMMG_analys(PMMG_pParMesh parmesh,MMG5_pMesh mesh);
@@ -457,9 +532,9 @@ int PMMG_splitPart_grps( PMMG_pParMesh,int,int,int );
 int PMMG_split_grps( PMMG_pParMesh parmesh,int grpIdOld,int ngrp,idx_t *part,int fitMesh );
 
 /* Load Balancing */
-int PMMG_interactionMap(PMMG_pParMesh parmesh,int **interactions,int **interaction_map);
 int PMMG_transfer_all_grps(PMMG_pParMesh parmesh,idx_t *part,int);
 int PMMG_distribute_grps( PMMG_pParMesh parmesh );
+int PMMG_asyncPartitioning( PMMG_pParMesh parmesh );
 int PMMG_loadBalancing( PMMG_pParMesh parmesh );
 int PMMG_split_n2mGrps( PMMG_pParMesh,int,int );
 double PMMG_computeWgt( MMG5_pMesh mesh,MMG5_pSol met,MMG5_pTetra pt,int ifac );
@@ -479,6 +554,7 @@ void PMMG_grp_comm_free( PMMG_pParMesh ,int**,int**,int*);
 void PMMG_node_comm_free( PMMG_pParMesh );
 void PMMG_edge_comm_free( PMMG_pParMesh );
 int PMMG_Compute_verticesGloNum( PMMG_pParMesh parmesh );
+int PMMG_Compute_trianglesGloNum( PMMG_pParMesh parmesh );
 int PMMG_color_commNodes( PMMG_pParMesh parmesh );
 void PMMG_tria2elmFace_flags( PMMG_pParMesh parmesh );
 void PMMG_tria2elmFace_coords( PMMG_pParMesh parmesh );
@@ -489,6 +565,7 @@ int PMMG_build_faceCommFromNodes( PMMG_pParMesh parmesh );
 int PMMG_build_simpleExtNodeComm( PMMG_pParMesh parmesh );
 int PMMG_build_intNodeComm( PMMG_pParMesh parmesh );
 int PMMG_build_completeExtNodeComm( PMMG_pParMesh parmesh );
+int PMMG_build_completeExtNodeComm_rdv( PMMG_pParMesh parmesh );
 int PMMG_build_edgeComm( PMMG_pParMesh parmesh,MMG5_pMesh mesh,MMG5_HGeom *hpar );
 
 int PMMG_pack_faceCommunicators(PMMG_pParMesh parmesh);
@@ -511,6 +588,7 @@ void PMMG_untag_par_edge(MMG5_pxTetra pxt,int j);
 void PMMG_untag_par_face(MMG5_pxTetra pxt,int j);
 int  PMMG_resetOldTag(PMMG_pParMesh parmesh);
 int  PMMG_updateTag(PMMG_pParMesh parmesh);
+int  PMMG_updateTag_incr(PMMG_pParMesh parmesh,int *nleft,int **left);
 int  PMMG_parbdySet( PMMG_pParMesh parmesh );
 int  PMMG_parbdyTria( PMMG_pParMesh parmesh );
 
@@ -559,6 +637,9 @@ int  PMMG_resize_extCommArray ( PMMG_pParMesh,PMMG_pExt_comm*,int,int*);
 
 /* Tools */
 int PMMG_copy_mmgInfo ( MMG5_Info *info, MMG5_Info *info_cpy );
+int  PMMG_ptMarkers_init( PMMG_pParMesh parmesh,MMG5_pMesh mesh,
+                          PMMG_ptMarkers *markers,int fields );
+void PMMG_ptMarkers_free( PMMG_pParMesh parmesh,PMMG_ptMarkers *markers );
 
 /* Quality */
 int PMMG_qualhisto( PMMG_pParMesh parmesh,int,int );
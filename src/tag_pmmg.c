@@ -450,6 +450,323 @@ int PMMG_updateTag(PMMG_pParMesh parmesh) {
   return 1;
 }
 
+/**
+ * \param a pointer toward an integer.
+ * \param b pointer toward an integer.
+ *
+ * \return 1 if a is greater than b, -1 if b is greater than a, 0 if they are
+ * equal.
+ *
+ */
+static
+int PMMG_updateTag_compareInt( const void *a,const void *b ) {
+  const int i1 = *(const int*)a;
+  const int i2 = *(const int*)b;
+
+  if ( i1 != i2 ) return i1 > i2 ? 1 : -1;
+  return 0;
+}
+
+/**
+ * \param ip index of a point.
+ * \param affected sorted list of the points whose tags have to be recomputed.
+ * \param naffected number of affected points.
+ *
+ * \return 1 if the point is affected, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_updateTag_isAffected(int ip,int *affected,int naffected) {
+  return ( NULL != bsearch(&ip,affected,naffected,sizeof(int),
+                           PMMG_updateTag_compareInt) );
+}
+
+/**
+ * \param pt pointer toward the tetra.
+ * \param ia local index of the edge on the tetra.
+ * \param affected sorted list of the points whose tags have to be recomputed.
+ * \param naffected number of affected points.
+ *
+ * \return 1 if the tags of the two extremities of the edge have to be
+ * recomputed, 0 otherwise.
+ *
+ */
+static inline
+int PMMG_updateTag_isAffectedEdge(MMG5_pTetra pt,int ia,int *affected,
+                                  int naffected) {
+  return ( PMMG_updateTag_isAffected(pt->v[MMG5_iare[ia][0]],affected,naffected) &&
+           PMMG_updateTag_isAffected(pt->v[MMG5_iare[ia][1]],affected,naffected) );
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure.
+ * \param nleft number of faces that have left the face communicator in each
+ * group.
+ * \param left for each group, list of the faces (12*iel+3*ifac+iploc, as in the
+ * face2int_face_comm_index1 arrays) that have left the face communicator.
+ *
+ * \return 0 if fail, 1 otherwise
+ *
+ * Incremental version of \ref PMMG_updateTag, to be called after the merge of
+ * the groups (see \ref PMMG_merge_grps2send): a merge only removes from the
+ * face communicator the faces shared by the merged groups, which are recorded
+ * in \a left, no face enters it.
+ *
+ * Only the vertices of these faces, the edges joining two of them and the
+ * xtetra touching them are retagged, with the same rules as in \ref
+ * PMMG_updateTag: the tags of the faces that stay on the interface and of the
+ * entities far from the changes are left untouched. A group whose interface
+ * didn't change is not visited at all. For the other groups, the xtetra
+ * touching an affected vertex are found with one pass on the tetra (the
+ * adjacency is not available at this stage), the untagging, the edge hashing
+ * and the retagging are restricted to them.
+ *
+ */
+int PMMG_updateTag_incr(PMMG_pParMesh parmesh,int *nleft,int **left) {
+  PMMG_pGrp       grp;
+  MMG5_pMesh      mesh;
+  MMG5_pTetra     pt;
+  MMG5_pxTetra    pxt;
+  MMG5_pPoint     ppt;
+  MMG5_HGeom      hash;
+  int             *affected,*list;
+  int             grpid,iel,ifac,ia,ip,ip0,ip1,k,j,i,l,nlist,naffected;
+  int             getref,ier;
+  int16_t         gettag;
+  int8_t          isbdy,isTrue;
+
+  ier = 1;
+
+  /* Loop on groups */
+  for ( grpid=0; grpid<parmesh->ngrp; grpid++ ) {
+    grp  = &parmesh->listgrp[grpid];
+    mesh = grp->mesh;
+
+    /* Unchanged interface: nothing to do */
+    if ( !mesh || !mesh->xt || !nleft[grpid] ) continue;
+
+    affected  = NULL;
+    list      = NULL;
+    hash.geom = NULL;
+
+    /** Step 1: List the vertices of the faces that have left the
+     * communicator */
+    PMMG_MALLOC(parmesh,affected,3*nleft[grpid],int,"affected points",
+                return 0);
+    naffected = 0;
+    for ( i=0; i<nleft[grpid]; i++ ) {
+      iel  =   left[grpid][i] / 12;
+      ifac = ( left[grpid][i] % 12 ) / 3;
+      pt   = &mesh->tetra[iel];
+      assert( MG_EOK(pt) && pt->xt );
+      for ( j=0; j<3; j++ )
+        affected[naffected++] = pt->v[MMG5_idir[ifac][j]];
+    }
+    qsort(affected,naffected,sizeof(int),PMMG_updateTag_compareInt);
+    k = 0;
+    for ( i=0; i<naffected; i++ ) {
+      if ( k && affected[i] == affected[k-1] ) continue;
+      affected[k++] = affected[i];
+    }
+    naffected = k;
+
+    /** Step 2: List the xtetra touching an affected point */
+    PMMG_MALLOC(parmesh,list,mesh->xt,int,"affected xtetra",
+                ier = 0; goto end);
+    nlist = 0;
+    for ( k=1; k<=mesh->ne; k++ ) {
+      pt = &mesh->tetra[k];
+      if ( !pt->xt ) continue;
+      for ( j=0; j<4; j++ ) {
+        if ( PMMG_updateTag_isAffected(pt->v[j],affected,naffected) ) {
+          assert ( nlist < mesh->xt );
+          list[nlist++] = k;
+          break;
+        }
+      }
+    }
+
+    /** Step 3: Untag the affected entities and the faces that have left the
+     * communicator, hash the affected edges */
+    if ( !MMG5_hNew(mesh, &hash, 6*nlist, 8*nlist) ) {
+      ier = 0;
+      goto end;
+    }
+    for ( l=0; l<nlist; l++ ) {
+      pt  = &mesh->tetra[list[l]];
+      pxt = &mesh->xtetra[pt->xt];
+      for ( j=0 ; j<4 ; j++ ) {
+        if ( PMMG_updateTag_isAffected(pt->v[j],affected,naffected) )
+          PMMG_untag_par_node(&mesh->point[pt->v[j]]);
+      }
+      for ( j=0 ; j<6 ; j++ ) {
+        if ( !PMMG_updateTag_isAffectedEdge(pt,j,affected,naffected) ) continue;
+        PMMG_untag_par_edge(pxt,j);
+        ip0 = pt->v[MMG5_iare[j][0]];
+        ip1 = pt->v[MMG5_iare[j][1]];
+        if( !MMG5_hEdge( mesh, &hash, ip0, ip1, 0, MG_NOTAG ) ) {
+          ier = 0;
+          goto end;
+        }
+      }
+    }
+    for ( i=0; i<nleft[grpid]; i++ ) {
+      iel  =   left[grpid][i] / 12;
+      ifac = ( left[grpid][i] % 12 ) / 3;
+      pt   = &mesh->tetra[iel];
+      PMMG_untag_par_face(&mesh->xtetra[pt->xt],ifac);
+    }
+
+    /** Step 4: Re-tag the affected entities of the "true" boundary faces */
+    for ( l=0; l<nlist; l++ ) {
+      pt  = &mesh->tetra[list[l]];
+      pxt = &mesh->xtetra[pt->xt];
+      for ( ifac=0 ; ifac<4 ; ifac++ ) {
+        /* Faces that have left the communicator and were internal boundaries
+         * (the PARBDYBDY tag has been removed from the affected points by
+         * the untagging) */
+        if ( (pxt->ftag[ifac] & MG_PARBDYBDY) && !(pxt->ftag[ifac] & MG_PARBDY) ) {
+          pxt->ftag[ifac] &= ~MG_PARBDYBDY;
+          pxt->ftag[ifac] |= MG_BDY;
+        }
+        /* Faces that stay in the communicator are still tagged MG_BDY, only
+         * the internal boundaries among them are true boundaries */
+        if ( !(pxt->ftag[ifac] & MG_BDY) ) continue;
+        if ( (pxt->ftag[ifac] & MG_PARBDY) &&
+             !(pxt->ftag[ifac] & MG_PARBDYBDY) ) continue;
+
+        /* Constrain boundary if -nosurf option */
+        if( mesh->info.nosurf ) {
+          if( !(pxt->ftag[ifac] & MG_REQ) ) {
+            /* do not add the MG_NOSURF tag on a required entity */
+            pxt->ftag[ifac] |= MG_REQ + MG_NOSURF;
+          }
+        }
+        /* Tag face edges */
+        for ( j=0; j<3; j++ ) {
+          ia = MMG5_iarf[ifac][j];
+          if ( !PMMG_updateTag_isAffectedEdge(pt,ia,affected,naffected) )
+            continue;
+          ip0 = pt->v[MMG5_iare[ia][0]];
+          ip1 = pt->v[MMG5_iare[ia][1]];
+          if( !MMG5_hTag( &hash, ip0, ip1, 0, MG_BDY ) ) {
+            ier = 0;
+            goto end;
+          }
+          /* Constrain boundary if -nosurf option */
+          if( mesh->info.nosurf ) {
+            if( !MMG5_hGet( &hash, ip0, ip1, &getref, &gettag ) ) {
+              ier = 0;
+              goto end;
+            }
+            if( !(gettag & MG_REQ) ) {
+              /* do not add the MG_NOSURF tag on a required entity */
+              if( !MMG5_hTag( &hash, ip0, ip1, 0, MG_REQ + MG_NOSURF ) ) {
+                ier = 0;
+                goto end;
+              }
+            }
+          }
+        }
+        /* Tag face nodes */
+        for ( j=0 ; j<3 ; j++) {
+          ip = pt->v[MMG5_idir[ifac][j]];
+          if ( !PMMG_updateTag_isAffected(ip,affected,naffected) ) continue;
+          ppt = &mesh->point[ip];
+          ppt->tag |= MG_BDY;
+          /* Constrain boundary if -nosurf option */
+          if( mesh->info.nosurf ) {
+            if( !(ppt->tag & MG_REQ) ) {
+              /* do not add the MG_NOSURF tag on a required entity */
+              ppt->tag |= MG_REQ + MG_NOSURF;
+            }
+          }
+        }
+      }
+    }
+
+    /** Step 5: Re-tag the affected entities of the faces that stay in the
+     * communicator (they all touch an affected point so they belong to a
+     * listed xtetra) */
+    for ( l=0; l<nlist; l++ ) {
+      pt  = &mesh->tetra[list[l]];
+      pxt = &mesh->xtetra[pt->xt];
+      for ( ifac=0 ; ifac<4 ; ifac++ ) {
+        if ( !(pxt->ftag[ifac] & MG_PARBDY) ) continue;
+
+        isTrue = ( pxt->ftag[ifac] & MG_PARBDYBDY ) ? 1 : 0;
+
+        /* Tag affected face edges */
+        for ( j=0; j<3; j++ ) {
+          ia = MMG5_iarf[ifac][j];
+          if ( !PMMG_updateTag_isAffectedEdge(pt,ia,affected,naffected) )
+            continue;
+          if( !PMMG_tag_par_edge_hash(pt,hash,ia) ) {
+            ier = 0;
+            goto end;
+          }
+        }
+        /* Tag affected face nodes */
+        for ( j=0 ; j<3 ; j++) {
+          ip = pt->v[MMG5_idir[ifac][j]];
+          if ( !PMMG_updateTag_isAffected(ip,affected,naffected) ) continue;
+          ppt = &mesh->point[ip];
+          if ( isTrue ) ppt->tag |= MG_PARBDYBDY;
+          PMMG_tag_par_node(ppt);
+        }
+      }
+    }
+
+    /** Step 6: Get the affected edge tags from the hash table and unreference
+     * the xtetra that are not on the boundary anymore */
+    for ( l=0; l<nlist; l++ ) {
+      pt  = &mesh->tetra[list[l]];
+      pxt = &mesh->xtetra[pt->xt];
+      isbdy = 0;
+      for( ifac = 0; ifac < 4; ifac++ ) {
+        if( pxt->ftag[ifac] & MG_BDY ) {
+          isbdy = 1;
+          break;
+        }
+      }
+      if( !isbdy ) {
+        pt->xt = 0;
+        continue;
+      }
+      for ( j=0; j<6; j++ ) {
+        if ( !PMMG_updateTag_isAffectedEdge(pt,j,affected,naffected) ) continue;
+        ip0 = pt->v[MMG5_iare[j][0]];
+        ip1 = pt->v[MMG5_iare[j][1]];
+        if( !MMG5_hGet( &hash, ip0, ip1, &getref, &gettag ) ) {
+          ier = 0;
+          goto end;
+        }
+        /* the hash table should only contain boundary/parallel related tags,
+         * so remove the MG_NOSURF tag if the edge is truly required */
+        if( pxt->tag[j] & MG_REQ )
+          gettag &= ~MG_NOSURF;
+        pxt->tag[j] |= gettag;
+      }
+    }
+
+    /** Step 7: Unreference affected xpoints not on BDY (or PARBDY) */
+    for ( i=0; i<naffected; i++ ) {
+      ppt = &mesh->point[affected[i]];
+      if( ppt->tag & MG_BDY ) continue;
+      if( ppt->xp ) ppt->xp = 0;
+    }
+
+  end:
+    PMMG_DEL_MEM( mesh, hash.geom, MMG5_hgeom, "Edge hash table" );
+    PMMG_DEL_MEM(parmesh,list,int,"affected xtetra");
+    PMMG_DEL_MEM(parmesh,affected,int,"affected points");
+
+    if ( !ier ) return 0;
+  }
+
+  return 1;
+}
+
 /**
  * \param parmesh pointer to parmesh structure.
  * \return 0 if fail, 1 if success.
@@ -143,3 +143,52 @@ int PMMG_copy_mmgInfo ( MMG5_Info *info, MMG5_Info *info_cpy ) {
 
   return 1;
 }
+
+/**
+ * \param parmesh pointer toward the parmesh structure (memory count).
+ * \param mesh pointer toward the mesh whose points are marked.
+ * \param markers pointer toward the point markers.
+ * \param fields marker fields to allocate (combination of PMMG_MARK_*).
+ *
+ * \return 1 if success, 0 if fail.
+ *
+ * Allocate the requested point markers of \a mesh, initialized to 0.
+ *
+ */
+int PMMG_ptMarkers_init( PMMG_pParMesh parmesh,MMG5_pMesh mesh,
+                         PMMG_ptMarkers *markers,int fields ) {
+
+  markers->np   = mesh->np;
+  markers->flag = markers->tmp = markers->s = NULL;
+
+  if ( fields & PMMG_MARK_flag ) {
+    PMMG_CALLOC(parmesh,markers->flag,mesh->np+1,int,"point flags",goto fail);
+  }
+  if ( fields & PMMG_MARK_tmp ) {
+    PMMG_CALLOC(parmesh,markers->tmp,mesh->np+1,int,"point tmp",goto fail);
+  }
+  if ( fields & PMMG_MARK_s ) {
+    PMMG_CALLOC(parmesh,markers->s,mesh->np+1,int,"point markers",goto fail);
+  }
+
+  return 1;
+
+fail:
+  PMMG_ptMarkers_free(parmesh,markers);
+  return 0;
+}
+
+/**
+ * \param parmesh pointer toward the parmesh structure (memory count).
+ * \param markers pointer toward the point markers.
+ *
+ * Free the point markers.
+ *
+ */
+void PMMG_ptMarkers_free( PMMG_pParMesh parmesh,PMMG_ptMarkers *markers ) {
+
+  PMMG_DEL_MEM(parmesh,markers->flag,int,"point flags");
+  PMMG_DEL_MEM(parmesh,markers->tmp,int,"point tmp");
+  PMMG_DEL_MEM(parmesh,markers->s,int,"point markers");
+  markers->np = 0;
+}
@@ -480,13 +480,85 @@ int PMMG_fitMeshSize( PMMG_pParMesh parmesh, PMMG_pGrp grp ) {
   return ier;
 }
 
+/**
+ * \param mesh pointer toward the mesh structure
+ * \param met pointer toward the metric structure
+ * \param npest pointer toward the estimated number of vertices
+ * \param neest pointer toward the estimated number of tetra
+ *
+ * \return 1 if the sizes have been estimated, 0 if no metric is available
+ *
+ * Estimate the sizes of the mesh adapted to the metric \a met: the number of
+ * tetra is the volume of the mesh in the metric (integral of sqrt(det M), with
+ * sqrt(det M) averaged over the tetra vertices) divided by the volume of the
+ * regular unit tetra. Both volumes are true volumes (MMG5_orvol returns the
+ * determinant of the edge vectors, i.e. 6 times the volume of the tetra).
+ *
+ */
+static
+int PMMG_estimateMeshSize( MMG5_pMesh mesh,MMG5_pSol met,
+                           double *npest,double *neest ) {
+  MMG5_pTetra pt;
+  double      *m,det,dens,vol;
+  int         k,i,ip;
+
+  if ( (!mesh->ne) || (!met) || (!met->m) || (met->np != mesh->np) ) return 0;
+  if ( met->size != 1 && met->size != 6 ) return 0;
+
+  vol = 0.;
+  for ( k=1; k<=mesh->ne; ++k ) {
+    pt = &mesh->tetra[k];
+    if ( !MG_EOK(pt) ) continue;
+
+    dens = 0.;
+    for ( i=0; i<4; ++i ) {
+      ip = pt->v[i];
+      m  = &met->m[met->size*ip];
+      if ( met->size == 1 ) {
+        if ( m[0] <= 0. ) return 0;
+        dens += 1./(m[0]*m[0]*m[0]);
+      }
+      else {
+        det = m[0]*(m[3]*m[5]-m[4]*m[4]) - m[1]*(m[1]*m[5]-m[2]*m[4])
+          + m[2]*(m[1]*m[4]-m[2]*m[3]);
+        if ( det > 0. ) dens += sqrt(det);
+      }
+    }
+    vol += 0.25*dens*fabs(MMG5_orvol(mesh->point,pt->v))/6.;
+  }
+
+  *neest = vol/PMMG_MEMEST_UNITVOL;
+  *npest = *neest/PMMG_MEMEST_NE2NP;
+
+  return 1;
+}
+
+/**
+ * \param est estimated size of an entity array
+ * \param cur current number of entities
+ *
+ * \return the maximal number of entities to allocate
+ *
+ * Apply the margins to the estimated size and clip it to the integer range.
+ *
+ */
+static inline
+int PMMG_estimateMax( double est,int cur ) {
+  double nmax;
+
+  nmax = MG_MAX(PMMG_MEMEST_MARGIN*est,PMMG_MEMEST_MIN*cur);
+  return (int)MG_MIN(nmax,(double)(INT_MAX-1));
+}
+
 /**
  * \param parmesh parmesh structure to adjust
  * \param fitMesh if 1, set maximum mesh size at its exact size.
  *
  * \return 1 if success, 0 if fail
  *
- * Update the size of the group meshes.
+ * Update the size of the group meshes. If the meshes are not fitted, their
+ * maximal sizes are estimated from the metric when it is available (1.5 times
+ * the current sizes otherwise).
  *
  */
 int PMMG_updateMeshSize( PMMG_pParMesh parmesh, int fitMesh )
@@ -494,6 +566,7 @@ int PMMG_updateMeshSize( PMMG_pParMesh parmesh, int fitMesh )
   MMG5_pMesh mesh;
   MMG5_pSol  met,ls,disp,field,psl;
   size_t     available,used,delta;
+  double     npest,neest,surf;
   int        remaining_ngrps,npmax_old,xpmax_old,nemax_old,xtmax_old;
   int        i,is;
 
@@ -515,6 +588,14 @@ int PMMG_updateMeshSize( PMMG_pParMesh parmesh, int fitMesh )
       mesh->nemax = mesh->ne;
       mesh->xtmax = mesh->xt;
     }
+    else if ( PMMG_estimateMeshSize(mesh,parmesh->listgrp[i].met,&npest,&neest) ) {
+      /* Boundary entities grow with the surface of the mesh */
+      surf = pow(neest/mesh->ne,2./3.);
+      mesh->npmax = PMMG_estimateMax(npest,mesh->np);
+      mesh->xpmax = PMMG_estimateMax(surf*mesh->xp,mesh->xp);
+      mesh->nemax = PMMG_estimateMax(neest,mesh->ne);
+      mesh->xtmax = PMMG_estimateMax(surf*mesh->xt,mesh->xt);
+    }
     else {
       mesh->npmax = 1.5*mesh->np;
       mesh->xpmax = 1.5*mesh->xp;